@@ -5,14 +5,61 @@
 
 // CONTAINER
 #include <std/container/iterator.hpp>
+#include <std/container/reverse_iterator.hpp>
+#include <std/container/bits.hpp>
+#include <std/container/span.hpp>
 #include <std/container/fixed/base.hpp>
 #include <std/container/fixed/array.hpp>
+#include <std/container/fixed/bitset.hpp>
 #include <std/container/dynamic/base.hpp>
+#include <std/container/dynamic/bitset.hpp>
+#include <std/container/dynamic/forward_list.hpp>
+#include <std/container/dynamic/growable_vector.hpp>
+#include <std/container/dynamic/indexed_priority_queue.hpp>
+#include <std/container/dynamic/list.hpp>
 #include <std/container/dynamic/map.hpp>
+#include <std/container/dynamic/pool.hpp>
+#include <std/container/dynamic/priority_queue.hpp>
 #include <std/container/dynamic/set.hpp>
+#include <std/container/dynamic/slot_map.hpp>
+#include <std/container/dynamic/small_vector.hpp>
+#include <std/container/dynamic/sparse_set.hpp>
 #include <std/container/dynamic/vector.hpp>
+#include <std/container/dynamic/vector_bool.hpp>
+#include <std/container/intrusive/list.hpp>
+#include <std/container/progmem/read.hpp>
+#include <std/container/progmem/iterator.hpp>
+#include <std/container/progmem/array.hpp>
+#include <std/container/progmem/map.hpp>
+#include <std/container/string/string_view.hpp>
+#include <std/container/string/base.hpp>
+#include <std/container/string/string.hpp>
+#include <std/container/string/fixed_string.hpp>
+
+// ALGORITHM
+#include <std/algorithm/binary_search.hpp>
+#include <std/algorithm/compare.hpp>
+#include <std/algorithm/heap.hpp>
+#include <std/algorithm/remove.hpp>
+#include <std/algorithm/sort.hpp>
+
+// NUMERIC
+#include <std/numeric/widen.hpp>
+#include <std/numeric/accumulate.hpp>
+#include <std/numeric/partial_sum.hpp>
+#include <std/numeric/iota.hpp>
+
+// RANGES
+#include <std/ranges/base.hpp>
+#include <std/ranges/drop.hpp>
+#include <std/ranges/filter.hpp>
+#include <std/ranges/reverse.hpp>
+#include <std/ranges/take.hpp>
+#include <std/ranges/transform.hpp>
+#include <std/ranges/zip.hpp>
 
 // MEMORY
+#include <std/memory/construct_at.hpp>
 #include <std/memory/smart_ptr/base.hpp>
 #include <std/memory/smart_ptr/unique_ptr.hpp>
 #include <std/memory/smart_ptr/shared_ptr.hpp>
@@ -21,13 +68,28 @@
 #include <std/functional/callable/base.hpp>
 #include <std/functional/callable/global.hpp>
 #include <std/functional/callable/member.hpp>
+#include <std/functional/comparison.hpp>
 #include <std/functional/function.hpp>
 
 // UTILITY
+#include <std/utility/declval.hpp>
+#include <std/utility/enable_if.hpp>
+#include <std/utility/errc.hpp>
+#include <std/utility/expected.hpp>
 #include <std/utility/forward.hpp>
+#include <std/utility/has_unique_object_representations.hpp>
+#include <std/utility/integer_sequence.hpp>
+#include <std/utility/is_empty.hpp>
+#include <std/utility/is_final.hpp>
+#include <std/utility/is_trivially_copyable.hpp>
 #include <std/utility/move.hpp>
+#include <std/utility/optional.hpp>
 #include <std/utility/pair.hpp>
 #include <std/utility/remove_reference.hpp>
+#include <std/utility/swap.hpp>
+#include <std/utility/tuple.hpp>
+#include <std/utility/variadic.hpp>
+#include <std/utility/variant.hpp>
 
 // DEFINITIONS
 #include <std/stddef.hpp>
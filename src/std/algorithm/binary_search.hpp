@@ -0,0 +1,223 @@
+/// \file std/algorithm/binary_search.hpp
+/// \brief Defines the std::lower_bound, std::upper_bound, std::equal_range, std::binary_search, and std::branchless_lower_bound template functions.
+#ifndef STD___ALGORITHM___BINARY_SEARCH_H
+#define STD___ALGORITHM___BINARY_SEARCH_H
+
+// std
+#include <std/functional/comparison.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/pair.hpp>
+
+namespace std {
+
+/// \brief Finds the first element in a sorted range that is not ordered before a value.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be partitioned with respect to compare(element, value).
+/// \param[in] value The value to search for.
+/// \param[in] compare The comparison function object.
+/// \return An iterator to the found element, or last if no element is found.
+/// \details Runs in O(log n).
+template <typename iterator_type, typename object_type, typename compare_type>
+iterator_type lower_bound(iterator_type first, iterator_type last, const object_type& value, compare_type compare)
+{
+    for(std::size_t count = last - first; count > 0;)
+    {
+        // Compare the midpoint of the remaining range.
+        std::size_t half = count / 2;
+        if(compare(first[half], value))
+        {
+            // Element is in the upper half.
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            // Element is in the lower half.
+            count = half;
+        }
+    }
+
+    return first;
+}
+/// \brief Finds the first element in a sorted range that is not less than a value.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be sorted in ascending order.
+/// \param[in] value The value to search for.
+/// \return An iterator to the found element, or last if no element is found.
+template <typename iterator_type, typename object_type>
+iterator_type lower_bound(iterator_type first, iterator_type last, const object_type& value)
+{
+    return std::lower_bound(first, last, value, std::less<void>());
+}
+/// \brief Finds the first element in a sorted range that is ordered after a value.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be partitioned with respect to !compare(value, element).
+/// \param[in] value The value to search for.
+/// \param[in] compare The comparison function object.
+/// \return An iterator to the found element, or last if no element is found.
+/// \details Runs in O(log n).
+template <typename iterator_type, typename object_type, typename compare_type>
+iterator_type upper_bound(iterator_type first, iterator_type last, const object_type& value, compare_type compare)
+{
+    for(std::size_t count = last - first; count > 0;)
+    {
+        // Compare the midpoint of the remaining range.
+        std::size_t half = count / 2;
+        if(!compare(value, first[half]))
+        {
+            // Element is in the upper half.
+            first += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            // Element is in the lower half.
+            count = half;
+        }
+    }
+
+    return first;
+}
+/// \brief Finds the first element in a sorted range that is greater than a value.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be sorted in ascending order.
+/// \param[in] value The value to search for.
+/// \return An iterator to the found element, or last if no element is found.
+template <typename iterator_type, typename object_type>
+iterator_type upper_bound(iterator_type first, iterator_type last, const object_type& value)
+{
+    return std::upper_bound(first, last, value, std::less<void>());
+}
+/// \brief Finds the range of elements in a sorted range that are equivalent to a value.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be partitioned with respect to the value.
+/// \param[in] value The value to search for.
+/// \param[in] compare The comparison function object.
+/// \return A pair of iterators to the beginning and end of the equivalent elements.
+template <typename iterator_type, typename object_type, typename compare_type>
+std::pair<iterator_type,iterator_type> equal_range(iterator_type first, iterator_type last, const object_type& value, compare_type compare)
+{
+    for(std::size_t count = last - first; count > 0;)
+    {
+        // Compare the midpoint of the remaining range.
+        std::size_t half = count / 2;
+        iterator_type middle = first + half;
+        if(compare(*middle, value))
+        {
+            // Range is in the upper half.
+            first = middle + 1;
+            count -= half + 1;
+        }
+        else if(compare(value, *middle))
+        {
+            // Range is in the lower half.
+            count = half;
+        }
+        else
+        {
+            // Middle is in the range, so search for each end on either side of it.
+            return std::pair<iterator_type,iterator_type>(std::lower_bound(first, middle, value, compare), std::upper_bound(middle + 1, first + count, value, compare));
+        }
+    }
+
+    return std::pair<iterator_type,iterator_type>(first, first);
+}
+/// \brief Finds the range of elements in a sorted range that are equal to a value.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be sorted in ascending order.
+/// \param[in] value The value to search for.
+/// \return A pair of iterators to the beginning and end of the equal elements.
+template <typename iterator_type, typename object_type>
+std::pair<iterator_type,iterator_type> equal_range(iterator_type first, iterator_type last, const object_type& value)
+{
+    return std::equal_range(first, last, value, std::less<void>());
+}
+/// \brief Checks if a sorted range contains an element equivalent to a value.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be partitioned with respect to the value.
+/// \param[in] value The value to search for.
+/// \param[in] compare The comparison function object.
+/// \return TRUE if an equivalent element is found, otherwise FALSE.
+template <typename iterator_type, typename object_type, typename compare_type>
+bool binary_search(iterator_type first, iterator_type last, const object_type& value, compare_type compare)
+{
+    first = std::lower_bound(first, last, value, compare);
+    return first != last && !compare(value, *first);
+}
+/// \brief Checks if a sorted range contains an element equal to a value.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be sorted in ascending order.
+/// \param[in] value The value to search for.
+/// \return TRUE if an equal element is found, otherwise FALSE.
+template <typename iterator_type, typename object_type>
+bool binary_search(iterator_type first, iterator_type last, const object_type& value)
+{
+    return std::binary_search(first, last, value, std::less<void>());
+}
+/// \brief Finds the first element in a sorted range that is not ordered before a value, without data-dependent branches.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be partitioned with respect to compare(element, value).
+/// \param[in] value The value to search for.
+/// \param[in] compare The comparison function object.
+/// \return An iterator to the found element, or last if no element is found.
+/// \details The loop runs a fixed ceil(log2(n)) times for a given size, with each comparison selecting an offset
+/// rather than a branch. This suits keys that are cheap to compare (e.g. integers), where it avoids the pipeline
+/// stalls of mispredicted branches and gives a search time independent of the value.
+template <typename iterator_type, typename object_type, typename compare_type>
+iterator_type branchless_lower_bound(iterator_type first, iterator_type last, const object_type& value, compare_type compare)
+{
+    std::size_t count = last - first;
+    if(count == 0)
+    {
+        return first;
+    }
+
+    // Halve the range each step, advancing to the midpoint if it is ordered before the value.
+    while(count > 1)
+    {
+        std::size_t half = count / 2;
+        first += compare(first[half], value) ? half : 0;
+        count -= half;
+    }
+
+    return first + compare(*first, value);
+}
+/// \brief Finds the first element in a sorted range that is not less than a value, without data-dependent branches.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam object_type The type of the value.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range must be sorted in ascending order.
+/// \param[in] value The value to search for.
+/// \return An iterator to the found element, or last if no element is found.
+template <typename iterator_type, typename object_type>
+iterator_type branchless_lower_bound(iterator_type first, iterator_type last, const object_type& value)
+{
+    return std::branchless_lower_bound(first, last, value, std::less<void>());
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,322 @@
+/// \file std/algorithm/compare.hpp
+/// \brief Defines the std::equal, std::mismatch, and std::lexicographical_compare template functions.
+#ifndef STD___ALGORITHM___COMPARE_H
+#define STD___ALGORITHM___COMPARE_H
+
+// std
+#include <std/container/iterator.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/has_unique_object_representations.hpp>
+#include <std/utility/pair.hpp>
+
+// arduino
+#include <Arduino.h>
+
+namespace std {
+
+namespace algorithm {
+
+/// \brief Contains all code for comparison components.
+namespace compare {
+
+/// \brief The number of bytes compared per memcmp call when searching for a mismatch bytewise.
+/// \details Equal blocks are skipped with a single memcmp, and only the block containing the mismatch is searched one
+/// element at a time.
+constexpr std::size_t block_size = 16;
+
+/// \brief Provides comparison kernels for ranges.
+/// \tparam bytewise TRUE if the ranges are pointers to objects that can be compared by their bytes, otherwise FALSE.
+template <bool bytewise>
+struct block
+{
+    /// \brief Finds the first pair of unequal elements in two ranges.
+    /// \tparam iterator_type_a The input iterator type of the first range.
+    /// \tparam iterator_type_b The input iterator type of the second range.
+    /// \param[in] first_a The beginning of the first range.
+    /// \param[in] last_a The end of the first range.
+    /// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+    /// \return A pair of iterators to the first unequal elements, or last_a and its counterpart if no elements differ.
+    template <typename iterator_type_a, typename iterator_type_b>
+    static std::pair<iterator_type_a,iterator_type_b> mismatch(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b)
+    {
+        while(first_a != last_a && *first_a == *first_b)
+        {
+            ++first_a;
+            ++first_b;
+        }
+
+        return std::pair<iterator_type_a,iterator_type_b>(first_a, first_b);
+    }
+    /// \brief Checks if two ranges are equal.
+    /// \tparam iterator_type_a The input iterator type of the first range.
+    /// \tparam iterator_type_b The input iterator type of the second range.
+    /// \param[in] first_a The beginning of the first range.
+    /// \param[in] last_a The end of the first range.
+    /// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+    /// \return TRUE if all elements are equal, otherwise FALSE.
+    template <typename iterator_type_a, typename iterator_type_b>
+    static bool equal(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b)
+    {
+        for(; first_a != last_a; ++first_a, ++first_b)
+        {
+            if(!(*first_a == *first_b))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+/// \brief Provides comparison kernels for ranges of objects that can be compared by their bytes.
+template <>
+struct block<true>
+{
+    /// \brief Finds the first pair of unequal elements in two ranges.
+    /// \tparam object_type The type of the elements.
+    /// \param[in] first_a The beginning of the first range.
+    /// \param[in] last_a The end of the first range.
+    /// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+    /// \return A pair of pointers to the first unequal elements, or last_a and its counterpart if no elements differ.
+    template <typename object_type>
+    static std::pair<object_type*,object_type*> mismatch(object_type* first_a, object_type* last_a, object_type* first_b)
+    {
+        // Skip equal blocks with memcmp.
+        constexpr std::size_t count = (std::algorithm::compare::block_size < sizeof(object_type)) ? 1 : std::algorithm::compare::block_size / sizeof(object_type);
+        while(static_cast<std::size_t>(last_a - first_a) >= count && memcmp(first_a, first_b, count * sizeof(object_type)) == 0)
+        {
+            first_a += count;
+            first_b += count;
+        }
+
+        // Find the mismatch within the remaining block.
+        return std::algorithm::compare::block<false>::mismatch(first_a, last_a, first_b);
+    }
+    /// \brief Checks if two ranges are equal.
+    /// \tparam object_type The type of the elements.
+    /// \param[in] first_a The beginning of the first range.
+    /// \param[in] last_a The end of the first range.
+    /// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+    /// \return TRUE if all elements are equal, otherwise FALSE.
+    template <typename object_type>
+    static bool equal(object_type* first_a, object_type* last_a, object_type* first_b)
+    {
+        return memcmp(first_a, first_b, (last_a - first_a) * sizeof(object_type)) == 0;
+    }
+};
+
+/// \brief Finds the first pair of unequal elements in two ranges.
+/// \tparam iterator_type_a The input iterator type of the first range.
+/// \tparam iterator_type_b The input iterator type of the second range.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \return A pair of iterators to the first unequal elements, or last_a and its counterpart if no elements differ.
+template <typename iterator_type_a, typename iterator_type_b>
+std::pair<iterator_type_a,iterator_type_b> mismatch(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b)
+{
+    return std::algorithm::compare::block<false>::mismatch(first_a, last_a, first_b);
+}
+/// \brief Finds the first pair of unequal elements in two ranges of pointers to the same type.
+/// \tparam object_type The type of the elements.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \return A pair of pointers to the first unequal elements, or last_a and its counterpart if no elements differ.
+/// \details Compares bytewise if the type has unique object representations.
+template <typename object_type>
+std::pair<object_type*,object_type*> mismatch(object_type* first_a, object_type* last_a, object_type* first_b)
+{
+    return std::algorithm::compare::block<std::has_unique_object_representations<object_type>::value>::mismatch(first_a, last_a, first_b);
+}
+/// \brief Checks if two ranges are equal.
+/// \tparam iterator_type_a The input iterator type of the first range.
+/// \tparam iterator_type_b The input iterator type of the second range.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \return TRUE if all elements are equal, otherwise FALSE.
+template <typename iterator_type_a, typename iterator_type_b>
+bool equal(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b)
+{
+    return std::algorithm::compare::block<false>::equal(first_a, last_a, first_b);
+}
+/// \brief Checks if two ranges of pointers to the same type are equal.
+/// \tparam object_type The type of the elements.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \return TRUE if all elements are equal, otherwise FALSE.
+/// \details Compares with memcmp if the type has unique object representations.
+template <typename object_type>
+bool equal(object_type* first_a, object_type* last_a, object_type* first_b)
+{
+    return std::algorithm::compare::block<std::has_unique_object_representations<object_type>::value>::equal(first_a, last_a, first_b);
+}
+
+}}
+
+/// \brief Checks if two ranges are equal.
+/// \tparam iterator_type_a The input iterator type of the first range.
+/// \tparam iterator_type_b The input iterator type of the second range.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \return TRUE if all elements are equal, otherwise FALSE.
+/// \details Ranges of integers (or other types with unique object representations) accessed through pointers of the
+/// same type are compared with memcmp.
+template <typename iterator_type_a, typename iterator_type_b>
+bool equal(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b)
+{
+    return std::algorithm::compare::equal(first_a, last_a, first_b);
+}
+/// \brief Checks if two ranges are equal.
+/// \tparam iterator_type_a The forward iterator type of the first range.
+/// \tparam iterator_type_b The forward iterator type of the second range.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range.
+/// \param[in] last_b The end of the second range.
+/// \return TRUE if the ranges are the same size and all elements are equal, otherwise FALSE.
+/// \details The sizes are compared first, which runs in O(1) for random access iterators.
+template <typename iterator_type_a, typename iterator_type_b>
+bool equal(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b, iterator_type_b last_b)
+{
+    return (std::distance(first_a, last_a) == std::distance(first_b, last_b)) && std::algorithm::compare::equal(first_a, last_a, first_b);
+}
+/// \brief Checks if two ranges are equal with a predicate.
+/// \tparam iterator_type_a The input iterator type of the first range.
+/// \tparam iterator_type_b The input iterator type of the second range.
+/// \tparam predicate_type The type of the binary predicate.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \param[in] predicate The binary predicate, called as predicate(element_a, element_b).
+/// \return TRUE if the predicate holds for all element pairs, otherwise FALSE.
+template <typename iterator_type_a, typename iterator_type_b, typename predicate_type>
+bool equal(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b, predicate_type predicate)
+{
+    for(; first_a != last_a; ++first_a, ++first_b)
+    {
+        if(!predicate(*first_a, *first_b))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+/// \brief Finds the first pair of unequal elements in two ranges.
+/// \tparam iterator_type_a The input iterator type of the first range.
+/// \tparam iterator_type_b The input iterator type of the second range.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \return A pair of iterators to the first unequal elements, or last_a and its counterpart if no elements differ.
+/// \details Ranges of integers (or other types with unique object representations) accessed through pointers of the
+/// same type skip equal blocks with memcmp.
+template <typename iterator_type_a, typename iterator_type_b>
+std::pair<iterator_type_a,iterator_type_b> mismatch(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b)
+{
+    return std::algorithm::compare::mismatch(first_a, last_a, first_b);
+}
+/// \brief Finds the first pair of unequal elements in two ranges.
+/// \tparam iterator_type_a The forward iterator type of the first range.
+/// \tparam iterator_type_b The forward iterator type of the second range.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range.
+/// \param[in] last_b The end of the second range.
+/// \return A pair of iterators to the first unequal elements, or to the end of the shorter range and its counterpart
+/// if no elements differ.
+template <typename iterator_type_a, typename iterator_type_b>
+std::pair<iterator_type_a,iterator_type_b> mismatch(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b, iterator_type_b last_b)
+{
+    // Only compare the length of the shorter range.
+    auto size_b = std::distance(first_b, last_b);
+    if(size_b < std::distance(first_a, last_a))
+    {
+        last_a = std::next(first_a, size_b);
+    }
+
+    return std::algorithm::compare::mismatch(first_a, last_a, first_b);
+}
+/// \brief Finds the first pair of elements in two ranges for which a predicate does not hold.
+/// \tparam iterator_type_a The input iterator type of the first range.
+/// \tparam iterator_type_b The input iterator type of the second range.
+/// \tparam predicate_type The type of the binary predicate.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \param[in] predicate The binary predicate, called as predicate(element_a, element_b).
+/// \return A pair of iterators to the first elements failing the predicate, or last_a and its counterpart if none do.
+template <typename iterator_type_a, typename iterator_type_b, typename predicate_type>
+std::pair<iterator_type_a,iterator_type_b> mismatch(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b, predicate_type predicate)
+{
+    while(first_a != last_a && predicate(*first_a, *first_b))
+    {
+        ++first_a;
+        ++first_b;
+    }
+
+    return std::pair<iterator_type_a,iterator_type_b>(first_a, first_b);
+}
+/// \brief Checks if one range is lexicographically less than another range.
+/// \tparam iterator_type_a The input iterator type of the first range.
+/// \tparam iterator_type_b The input iterator type of the second range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range.
+/// \param[in] last_b The end of the second range.
+/// \param[in] compare The comparison function object.
+/// \return TRUE if the first range is ordered before the second range, otherwise FALSE.
+template <typename iterator_type_a, typename iterator_type_b, typename compare_type>
+bool lexicographical_compare(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b, iterator_type_b last_b, compare_type compare)
+{
+    for(; first_a != last_a && first_b != last_b; ++first_a, ++first_b)
+    {
+        if(compare(*first_a, *first_b))
+        {
+            return true;
+        }
+        if(compare(*first_b, *first_a))
+        {
+            return false;
+        }
+    }
+
+    // A shorter range is ordered before a longer range it prefixes.
+    return first_a == last_a && first_b != last_b;
+}
+/// \brief Checks if one range is lexicographically less than another range.
+/// \tparam iterator_type_a The forward iterator type of the first range.
+/// \tparam iterator_type_b The forward iterator type of the second range.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range.
+/// \param[in] last_b The end of the second range.
+/// \return TRUE if the first range is ordered before the second range, otherwise FALSE.
+/// \details Finds the first mismatch with std::mismatch, so equal prefixes of integer ranges are skipped with memcmp,
+/// and then compares only the mismatched elements with operator<.
+template <typename iterator_type_a, typename iterator_type_b>
+bool lexicographical_compare(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b, iterator_type_b last_b)
+{
+    std::pair<iterator_type_a,iterator_type_b> position = std::mismatch(first_a, last_a, first_b, last_b);
+    if(position.first == last_a)
+    {
+        // The first range is a prefix of the second range.
+        return position.second != last_b;
+    }
+    if(position.second == last_b)
+    {
+        // The second range is a prefix of the first range.
+        return false;
+    }
+
+    return *position.first < *position.second;
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,233 @@
+/// \file std/algorithm/heap.hpp
+/// \brief Defines the std::push_heap, std::pop_heap, std::make_heap, std::sort_heap, and std::is_heap template functions.
+#ifndef STD___ALGORITHM___HEAP_H
+#define STD___ALGORITHM___HEAP_H
+
+// std
+#include <std/functional/comparison.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/move.hpp>
+#include <std/utility/remove_reference.hpp>
+
+namespace std {
+
+/// \brief Contains all code for std algorithm components.
+namespace algorithm {
+
+/// \brief Contains all code for binary heap components.
+/// \details Heaps are stored implicitly in a random access range: the children of the element at index i are at
+/// indices 2i + 1 and 2i + 2. The element for which compare returns FALSE against all others is kept at the front.
+namespace heap {
+
+/// \brief Moves a value up from a hole in a heap until the heap property is restored.
+/// \tparam iterator_type The random access iterator type of the heap.
+/// \tparam object_type The type of object stored in the heap.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the heap.
+/// \param[in] hole The index of the hole to sift up from.
+/// \param[in] value The value to place in the heap. The value is moved from.
+/// \param[in] compare The comparison function object.
+/// \details Parents are moved down into the hole rather than swapped, which halves the number of writes.
+template <typename iterator_type, typename object_type, typename compare_type>
+void sift_up(iterator_type first, std::size_t hole, object_type& value, compare_type& compare)
+{
+    while(hole > 0)
+    {
+        // Stop once the parent is not ordered before the value.
+        std::size_t parent = (hole - 1) / 2;
+        if(!compare(first[parent], value))
+        {
+            break;
+        }
+
+        // Move the parent down into the hole.
+        first[hole] = std::move(first[parent]);
+        hole = parent;
+    }
+
+    // Place the value in the final hole.
+    first[hole] = std::move(value);
+}
+/// \brief Moves a value down from a hole in a heap until the heap property is restored.
+/// \tparam iterator_type The random access iterator type of the heap.
+/// \tparam object_type The type of object stored in the heap.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the heap.
+/// \param[in] size The number of elements in the heap.
+/// \param[in] hole The index of the hole to sift down from.
+/// \param[in] value The value to place in the heap. The value is moved from.
+/// \param[in] compare The comparison function object.
+/// \details Children are moved up into the hole rather than swapped, which halves the number of writes.
+template <typename iterator_type, typename object_type, typename compare_type>
+void sift_down(iterator_type first, std::size_t size, std::size_t hole, object_type& value, compare_type& compare)
+{
+    for(std::size_t child = 2 * hole + 1; child < size; child = 2 * hole + 1)
+    {
+        // Select the child ordered first.
+        if(child + 1 < size && compare(first[child], first[child + 1]))
+        {
+            ++child;
+        }
+
+        // Stop once the value is not ordered after the child.
+        if(!compare(value, first[child]))
+        {
+            break;
+        }
+
+        // Move the child up into the hole.
+        first[hole] = std::move(first[child]);
+        hole = child;
+    }
+
+    // Place the value in the final hole.
+    first[hole] = std::move(value);
+}
+
+}}
+
+/// \brief Inserts the last element of a range into the heap formed by the preceding elements.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range [first, last - 1) must be a heap.
+/// \param[in] compare The comparison function object.
+/// \details Runs in O(log n).
+template <typename iterator_type, typename compare_type>
+void push_heap(iterator_type first, iterator_type last, compare_type compare)
+{
+    // Verify the range is not empty.
+    if(last == first)
+    {
+        return;
+    }
+
+    // Sift the last element up.
+    auto value = std::move(*(last - 1));
+    std::algorithm::heap::sift_up(first, last - first - 1, value, compare);
+}
+/// \brief Inserts the last element of a range into the heap formed by the preceding elements using operator<.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range [first, last - 1) must be a heap.
+template <typename iterator_type>
+void push_heap(iterator_type first, iterator_type last)
+{
+    std::push_heap(first, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+/// \brief Moves the front element of a heap to the end of the range, and re-forms the heap from the remaining elements.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range [first, last) must be a heap.
+/// \param[in] compare The comparison function object.
+/// \details Runs in O(log n).
+template <typename iterator_type, typename compare_type>
+void pop_heap(iterator_type first, iterator_type last, compare_type compare)
+{
+    // Verify the heap has more than one element.
+    std::size_t size = last - first;
+    if(size < 2)
+    {
+        return;
+    }
+
+    // Move the front to the end, and sift the displaced last element down from the front.
+    auto value = std::move(*(last - 1));
+    *(last - 1) = std::move(*first);
+    std::algorithm::heap::sift_down(first, size - 1, 0, value, compare);
+}
+/// \brief Moves the front element of a heap to the end of the range using operator<.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range [first, last) must be a heap.
+template <typename iterator_type>
+void pop_heap(iterator_type first, iterator_type last)
+{
+    std::pop_heap(first, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+/// \brief Arranges a range into a heap.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+/// \details Runs in O(n) by sifting down each parent, starting from the last.
+template <typename iterator_type, typename compare_type>
+void make_heap(iterator_type first, iterator_type last, compare_type compare)
+{
+    std::size_t size = last - first;
+    for(std::size_t parent = size / 2; parent-- > 0;)
+    {
+        auto value = std::move(first[parent]);
+        std::algorithm::heap::sift_down(first, size, parent, value, compare);
+    }
+}
+/// \brief Arranges a range into a heap using operator<.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+template <typename iterator_type>
+void make_heap(iterator_type first, iterator_type last)
+{
+    std::make_heap(first, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+/// \brief Sorts a heap into ascending order with respect to a comparison.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range [first, last) must be a heap.
+/// \param[in] compare The comparison function object.
+/// \details Runs in O(n log n) without additional memory.
+template <typename iterator_type, typename compare_type>
+void sort_heap(iterator_type first, iterator_type last, compare_type compare)
+{
+    for(; last - first > 1; --last)
+    {
+        std::pop_heap(first, last, compare);
+    }
+}
+/// \brief Sorts a heap into ascending order using operator<.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range. The range [first, last) must be a heap.
+template <typename iterator_type>
+void sort_heap(iterator_type first, iterator_type last)
+{
+    std::sort_heap(first, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+/// \brief Checks if a range is a heap.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+/// \return TRUE if the range is a heap, otherwise FALSE.
+template <typename iterator_type, typename compare_type>
+bool is_heap(iterator_type first, iterator_type last, compare_type compare)
+{
+    std::size_t size = last - first;
+    for(std::size_t child = 1; child < size; ++child)
+    {
+        if(compare(first[(child - 1) / 2], first[child]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+/// \brief Checks if a range is a heap using operator<.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \return TRUE if the range is a heap, otherwise FALSE.
+template <typename iterator_type>
+bool is_heap(iterator_type first, iterator_type last)
+{
+    return std::is_heap(first, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+
+}
+
+#endif
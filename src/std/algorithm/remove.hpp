@@ -0,0 +1,74 @@
+/// \file std/algorithm/remove.hpp
+/// \brief Defines the std::remove and std::remove_if template functions.
+#ifndef STD___ALGORITHM___REMOVE_H
+#define STD___ALGORITHM___REMOVE_H
+
+// std
+#include <std/utility/move.hpp>
+
+namespace std {
+
+/// \brief Removes all elements satisfying a predicate from a range.
+/// \tparam iterator_type The forward iterator type of the range.
+/// \tparam predicate_type The type of the unary predicate.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] predicate The unary predicate, returning TRUE for elements to remove.
+/// \return An iterator to the new end of the range. Elements from the new end to last are left in a moved-from state.
+/// \details Kept elements are moved forward in a single compaction pass, preserving their order. Runs in O(n).
+template <typename iterator_type, typename predicate_type>
+iterator_type remove_if(iterator_type first, iterator_type last, predicate_type predicate)
+{
+    // Skip elements that are already in place.
+    while(first != last && !predicate(*first))
+    {
+        ++first;
+    }
+
+    // Move each kept element into the next free position.
+    iterator_type destination = first;
+    for(; first != last; ++first)
+    {
+        if(!predicate(*first))
+        {
+            *destination = std::move(*first);
+            ++destination;
+        }
+    }
+
+    return destination;
+}
+/// \brief Removes all elements equal to a value from a range.
+/// \tparam iterator_type The forward iterator type of the range.
+/// \tparam object_type The type of the value to remove.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] value The value to remove.
+/// \return An iterator to the new end of the range. Elements from the new end to last are left in a moved-from state.
+/// \details Kept elements are moved forward in a single compaction pass, preserving their order. Runs in O(n).
+template <typename iterator_type, typename object_type>
+iterator_type remove(iterator_type first, iterator_type last, const object_type& value)
+{
+    // Skip elements that are already in place.
+    while(first != last && !(*first == value))
+    {
+        ++first;
+    }
+
+    // Move each kept element into the next free position.
+    iterator_type destination = first;
+    for(; first != last; ++first)
+    {
+        if(!(*first == value))
+        {
+            *destination = std::move(*first);
+            ++destination;
+        }
+    }
+
+    return destination;
+}
+
+}
+
+#endif
\ No newline at end of file
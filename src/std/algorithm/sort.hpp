@@ -0,0 +1,440 @@
+/// \file std/algorithm/sort.hpp
+/// \brief Defines the std::sort, std::stable_sort, std::partial_sort, std::nth_element, and std::is_sorted template functions.
+#ifndef STD___ALGORITHM___SORT_H
+#define STD___ALGORITHM___SORT_H
+
+// std
+#include <std/algorithm/binary_search.hpp>
+#include <std/algorithm/heap.hpp>
+#include <std/functional/comparison.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/move.hpp>
+#include <std/utility/remove_reference.hpp>
+#include <std/utility/swap.hpp>
+
+namespace std {
+
+namespace algorithm {
+
+/// \brief Contains all code for sorting components.
+namespace sort {
+
+/// \brief The range size at or below which sorts switch to insertion sort.
+/// \details Insertion sort has the lowest overhead on small ranges, particularly on AVR where calls are expensive.
+constexpr std::size_t insertion_threshold = 16;
+
+/// \brief Sorts a range with insertion sort.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+/// \details Stable, and runs in O(n) on nearly sorted ranges. Larger elements are moved up into a hole rather than
+/// swapped.
+template <typename iterator_type, typename compare_type>
+void insertion_sort(iterator_type first, iterator_type last, compare_type& compare)
+{
+    if(first == last)
+    {
+        return;
+    }
+
+    for(iterator_type next = first + 1; next < last; ++next)
+    {
+        // Move larger elements up until the hole is in position.
+        auto value = std::move(*next);
+        iterator_type hole = next;
+        for(; hole > first && compare(value, *(hole - 1)); --hole)
+        {
+            *hole = std::move(*(hole - 1));
+        }
+
+        // Place the value in the hole.
+        *hole = std::move(value);
+    }
+}
+/// \brief Moves the median of three elements to the beginning of a range.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] result The position to move the median to.
+/// \param[in] a The first candidate.
+/// \param[in] b The second candidate.
+/// \param[in] c The third candidate.
+/// \param[in] compare The comparison function object.
+template <typename iterator_type, typename compare_type>
+void move_median_to_first(iterator_type result, iterator_type a, iterator_type b, iterator_type c, compare_type& compare)
+{
+    if(compare(*a, *b))
+    {
+        if(compare(*b, *c))
+        {
+            std::swap(*result, *b);
+        }
+        else if(compare(*a, *c))
+        {
+            std::swap(*result, *c);
+        }
+        else
+        {
+            std::swap(*result, *a);
+        }
+    }
+    else if(compare(*a, *c))
+    {
+        std::swap(*result, *a);
+    }
+    else if(compare(*b, *c))
+    {
+        std::swap(*result, *c);
+    }
+    else
+    {
+        std::swap(*result, *b);
+    }
+}
+/// \brief Partitions a range around the median of its first, middle, and last elements.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range. The range must contain at least three elements.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+/// \return The partition point. Elements before it are not ordered after elements from it onward.
+/// \details The median is placed at the front, and the other two candidates bound the scans, so neither scan needs
+/// to check for the end of the range.
+template <typename iterator_type, typename compare_type>
+iterator_type partition_pivot(iterator_type first, iterator_type last, compare_type& compare)
+{
+    // Select the pivot.
+    std::algorithm::sort::move_median_to_first(first, first + 1, first + (last - first) / 2, last - 1, compare);
+
+    // Partition the remainder around the pivot.
+    iterator_type left = first + 1;
+    iterator_type right = last;
+    while(true)
+    {
+        while(compare(*left, *first))
+        {
+            ++left;
+        }
+        --right;
+        while(compare(*first, *right))
+        {
+            --right;
+        }
+        if(!(left < right))
+        {
+            return left;
+        }
+        std::swap(*left, *right);
+        ++left;
+    }
+}
+/// \brief Gets the recursion depth limit for introsort and introselect.
+/// \param[in] size The number of elements in the range.
+/// \return Twice the base-2 logarithm of the size.
+inline std::size_t depth_limit(std::size_t size)
+{
+    std::size_t depth = 0;
+    for(; size > 1; size >>= 1)
+    {
+        depth += 2;
+    }
+
+    return depth;
+}
+/// \brief Partially sorts a range with introsort, leaving small partitions for a final insertion sort.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] depth The remaining recursion depth before switching to heap sort.
+/// \param[in] compare The comparison function object.
+template <typename iterator_type, typename compare_type>
+void introsort(iterator_type first, iterator_type last, std::size_t depth, compare_type& compare)
+{
+    while(static_cast<std::size_t>(last - first) > std::algorithm::sort::insertion_threshold)
+    {
+        // Fall back to heap sort if partitioning is degenerating.
+        if(depth == 0)
+        {
+            std::make_heap(first, last, compare);
+            std::sort_heap(first, last, compare);
+            return;
+        }
+        --depth;
+
+        // Recurse into the upper partition, and loop on the lower partition.
+        iterator_type cut = std::algorithm::sort::partition_pivot(first, last, compare);
+        std::algorithm::sort::introsort(cut, last, depth, compare);
+        last = cut;
+    }
+}
+/// \brief Reverses the order of elements in a range.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+template <typename iterator_type>
+void reverse(iterator_type first, iterator_type last)
+{
+    while(first < last)
+    {
+        std::swap(*first++, *--last);
+    }
+}
+/// \brief Rotates a range so that a middle element becomes the first element.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] middle The element to rotate to the beginning.
+/// \param[in] last The end of the range.
+/// \return The new position of the element originally at first.
+template <typename iterator_type>
+iterator_type rotate(iterator_type first, iterator_type middle, iterator_type last)
+{
+    std::algorithm::sort::reverse(first, middle);
+    std::algorithm::sort::reverse(middle, last);
+    std::algorithm::sort::reverse(first, last);
+
+    return first + (last - middle);
+}
+/// \brief Merges two consecutive sorted ranges in place, without a buffer.
+/// \tparam iterator_type The random access iterator type of the ranges.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the first range.
+/// \param[in] middle The end of the first range, and beginning of the second range.
+/// \param[in] last The end of the second range.
+/// \param[in] compare The comparison function object.
+/// \details The larger range is split in half, the matching split point of the other range is found by binary
+/// search, and the inner halves are rotated into place before recursing. Stable, and runs in O(n log n).
+template <typename iterator_type, typename compare_type>
+void merge(iterator_type first, iterator_type middle, iterator_type last, compare_type& compare)
+{
+    std::size_t size_a = middle - first;
+    std::size_t size_b = last - middle;
+    if(size_a == 0 || size_b == 0)
+    {
+        return;
+    }
+    if(size_a + size_b == 2)
+    {
+        if(compare(*middle, *first))
+        {
+            std::swap(*first, *middle);
+        }
+        return;
+    }
+
+    // Split the larger range in half, and find the matching split in the other range.
+    iterator_type cut_a;
+    iterator_type cut_b;
+    if(size_a > size_b)
+    {
+        cut_a = first + size_a / 2;
+        cut_b = std::lower_bound(middle, last, *cut_a, compare);
+    }
+    else
+    {
+        cut_b = middle + size_b / 2;
+        cut_a = std::upper_bound(first, middle, *cut_b, compare);
+    }
+
+    // Swap the inner halves, and merge each side.
+    iterator_type split = std::algorithm::sort::rotate(cut_a, middle, cut_b);
+    std::algorithm::sort::merge(first, cut_a, split, compare);
+    std::algorithm::sort::merge(split, cut_b, last, compare);
+}
+/// \brief Sorts a range with an in-place merge sort.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+template <typename iterator_type, typename compare_type>
+void merge_sort(iterator_type first, iterator_type last, compare_type& compare)
+{
+    if(static_cast<std::size_t>(last - first) <= std::algorithm::sort::insertion_threshold)
+    {
+        std::algorithm::sort::insertion_sort(first, last, compare);
+        return;
+    }
+
+    iterator_type middle = first + (last - first) / 2;
+    std::algorithm::sort::merge_sort(first, middle, compare);
+    std::algorithm::sort::merge_sort(middle, last, compare);
+    std::algorithm::sort::merge(first, middle, last, compare);
+}
+
+}}
+
+/// \brief Sorts a range into ascending order with respect to a comparison.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+/// \details Uses introsort: quicksort with median-of-three pivots, falling back to heap sort if the recursion grows
+/// too deep, and finishing with insertion sort over small partitions. Runs in O(n log n) without additional memory.
+/// The order of equal elements is not preserved.
+template <typename iterator_type, typename compare_type>
+void sort(iterator_type first, iterator_type last, compare_type compare)
+{
+    std::algorithm::sort::introsort(first, last, std::algorithm::sort::depth_limit(last - first), compare);
+    std::algorithm::sort::insertion_sort(first, last, compare);
+}
+/// \brief Sorts a range into ascending order using operator<.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+template <typename iterator_type>
+void sort(iterator_type first, iterator_type last)
+{
+    std::sort(first, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+/// \brief Sorts a range into ascending order with respect to a comparison, preserving the order of equal elements.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+/// \details Uses a merge sort that merges in place rather than allocating a buffer. Runs in O(n log^2 n).
+template <typename iterator_type, typename compare_type>
+void stable_sort(iterator_type first, iterator_type last, compare_type compare)
+{
+    std::algorithm::sort::merge_sort(first, last, compare);
+}
+/// \brief Sorts a range into ascending order using operator<, preserving the order of equal elements.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+template <typename iterator_type>
+void stable_sort(iterator_type first, iterator_type last)
+{
+    std::stable_sort(first, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+/// \brief Sorts the smallest elements of a range into ascending order with respect to a comparison.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] middle The end of the sorted portion of the range.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+/// \details The smallest elements are selected through a heap of size middle - first, so the sort runs in
+/// O(n log k). The order of the remaining elements is unspecified.
+template <typename iterator_type, typename compare_type>
+void partial_sort(iterator_type first, iterator_type middle, iterator_type last, compare_type compare)
+{
+    // Build a heap of the first elements, and replace its largest element with each smaller remaining element.
+    std::make_heap(first, middle, compare);
+    std::size_t size = middle - first;
+    for(iterator_type next = middle; next < last; ++next)
+    {
+        if(compare(*next, *first))
+        {
+            auto value = std::move(*next);
+            *next = std::move(*first);
+            std::algorithm::heap::sift_down(first, size, 0, value, compare);
+        }
+    }
+
+    // Sort the selected elements.
+    std::sort_heap(first, middle, compare);
+}
+/// \brief Sorts the smallest elements of a range into ascending order using operator<.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] middle The end of the sorted portion of the range.
+/// \param[in] last The end of the range.
+template <typename iterator_type>
+void partial_sort(iterator_type first, iterator_type middle, iterator_type last)
+{
+    std::partial_sort(first, middle, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+/// \brief Places the element that would be at a position in a sorted range at that position.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] nth The position to place the element at.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+/// \details Elements before nth are not ordered after it, and elements after nth are not ordered before it. Uses
+/// introselect, which runs in O(n) on average, falling back to a heap selection if partitioning degenerates.
+template <typename iterator_type, typename compare_type>
+void nth_element(iterator_type first, iterator_type nth, iterator_type last, compare_type compare)
+{
+    if(nth == last)
+    {
+        return;
+    }
+
+    for(std::size_t depth = std::algorithm::sort::depth_limit(last - first); last - first > 3;)
+    {
+        // Fall back to heap selection if partitioning is degenerating.
+        if(depth == 0)
+        {
+            std::partial_sort(first, nth + 1, last, compare);
+            return;
+        }
+        --depth;
+
+        // Continue into the partition containing nth.
+        iterator_type cut = std::algorithm::sort::partition_pivot(first, last, compare);
+        if(cut <= nth)
+        {
+            first = cut;
+        }
+        else
+        {
+            last = cut;
+        }
+    }
+
+    std::algorithm::sort::insertion_sort(first, last, compare);
+}
+/// \brief Places the element that would be at a position in a sorted range at that position using operator<.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] nth The position to place the element at.
+/// \param[in] last The end of the range.
+template <typename iterator_type>
+void nth_element(iterator_type first, iterator_type nth, iterator_type last)
+{
+    std::nth_element(first, nth, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+/// \brief Checks if a range is sorted into ascending order with respect to a comparison.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \tparam compare_type The type of the comparison function object.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] compare The comparison function object.
+/// \return TRUE if the range is sorted, otherwise FALSE.
+template <typename iterator_type, typename compare_type>
+bool is_sorted(iterator_type first, iterator_type last, compare_type compare)
+{
+    if(first == last)
+    {
+        return true;
+    }
+
+    for(iterator_type next = first + 1; next < last; ++next)
+    {
+        if(compare(*next, *(next - 1)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+/// \brief Checks if a range is sorted into ascending order using operator<.
+/// \tparam iterator_type The random access iterator type of the range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \return TRUE if the range is sorted, otherwise FALSE.
+template <typename iterator_type>
+bool is_sorted(iterator_type first, iterator_type last)
+{
+    return std::is_sorted(first, last, std::less<typename std::remove_reference<decltype(*first)>::type>());
+}
+
+}
+
+#endif
\ No newline at end of file
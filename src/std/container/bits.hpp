@@ -0,0 +1,620 @@
+/// \file std/container/bits.hpp
+/// \brief Defines word-level kernels shared by the bit-packed containers.
+#ifndef STD___CONTAINER___BITS_H
+#define STD___CONTAINER___BITS_H
+
+// std
+#include <std/container/iterator.hpp>
+#include <std/stddef.hpp>
+
+// arduino
+#include <Arduino.h>
+
+namespace std::container {
+
+/// \brief Contains all code for bit-packed container components.
+namespace bits {
+
+// WORDS
+/// \brief The machine word type that bits are packed into.
+using word = unsigned int;
+/// \brief The number of bits in a word.
+constexpr std::size_t word_size = sizeof(std::container::bits::word) * 8;
+/// \brief Gets the number of words required to store a number of bits.
+/// \param[in] bits The number of bits.
+/// \return The number of words required.
+constexpr std::size_t word_count(std::size_t bits)
+{
+    return (bits + std::container::bits::word_size - 1) / std::container::bits::word_size;
+}
+/// \brief Gets the index of the word containing a bit.
+/// \param[in] position The position of the bit.
+/// \return The index of the word containing the bit.
+constexpr std::size_t word_index(std::size_t position)
+{
+    return position / std::container::bits::word_size;
+}
+/// \brief Gets the mask that selects a bit within its word.
+/// \param[in] position The position of the bit.
+/// \return The mask that selects the bit.
+constexpr std::container::bits::word mask(std::size_t position)
+{
+    return std::container::bits::word(1) << (position % std::container::bits::word_size);
+}
+
+// REFERENCE
+/// \brief A proxy reference to a single bit within a word.
+class reference
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new reference instance.
+    /// \param[in] word The word containing the bit.
+    /// \param[in] mask The mask that selects the bit within the word.
+    reference(std::container::bits::word* word, std::container::bits::word mask)
+        : m_word(word),
+          m_mask(mask)
+    {}
+    /// \brief Copy-constructs a new reference instance that refers to the same bit as another reference.
+    /// \param[in] other The other reference to copy-construct from.
+    reference(const std::container::bits::reference& other) = default;
+
+    // ACCESS
+    /// \brief Reads the value of the referenced bit.
+    /// \return The value of the bit.
+    operator bool() const
+    {
+        return (*reference::m_word & reference::m_mask) != 0;
+    }
+    /// \brief Reads the inverted value of the referenced bit.
+    /// \return The inverted value of the bit.
+    bool operator~() const
+    {
+        return (*reference::m_word & reference::m_mask) == 0;
+    }
+
+    // MODIFIERS
+    /// \brief Assigns a value to the referenced bit.
+    /// \param[in] value The value to assign.
+    /// \return A reference to this reference.
+    std::container::bits::reference& operator=(bool value)
+    {
+        if(value)
+        {
+            *reference::m_word |= reference::m_mask;
+        }
+        else
+        {
+            *reference::m_word &= ~reference::m_mask;
+        }
+
+        return *this;
+    }
+    /// \brief Assigns the value of another referenced bit to the referenced bit.
+    /// \param[in] other The other reference to assign the value of.
+    /// \return A reference to this reference.
+    std::container::bits::reference& operator=(const std::container::bits::reference& other)
+    {
+        return reference::operator=(static_cast<bool>(other));
+    }
+    /// \brief Flips the referenced bit.
+    /// \return A reference to this reference.
+    std::container::bits::reference& flip()
+    {
+        *reference::m_word ^= reference::m_mask;
+
+        return *this;
+    }
+
+private:
+    /// \brief The word containing the referenced bit.
+    std::container::bits::word* const m_word;
+    /// \brief The mask that selects the referenced bit within the word.
+    const std::container::bits::word m_mask;
+};
+
+// ITERATORS
+/// \brief An iterator for traversing through the bits of a bit-packed container.
+class iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = bool;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->, which bits do not provide.
+    using pointer = void;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = std::container::bits::reference;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new iterator instance.
+    /// \param[in] data The container's words.
+    /// \param[in] position The position of the bit to point to.
+    iterator(std::container::bits::word* data = nullptr, std::size_t position = 0)
+        : m_data(data),
+          m_position(position)
+    {}
+
+    // ACCESS
+    /// \brief Gets a reference to the bit pointed to by this iterator.
+    /// \return A proxy reference to the bit.
+    std::container::bits::reference operator*() const
+    {
+        return std::container::bits::reference(&iterator::m_data[std::container::bits::word_index(iterator::m_position)], std::container::bits::mask(iterator::m_position));
+    }
+    /// \brief Gets a reference to a bit at an offset from this iterator.
+    /// \param[in] offset The offset of the bit.
+    /// \return A proxy reference to the bit.
+    std::container::bits::reference operator[](std::ptrdiff_t offset) const
+    {
+        return *(*this + offset);
+    }
+    /// \brief Gets the position of the bit pointed to by this iterator.
+    /// \return The position of the bit.
+    std::size_t position() const
+    {
+        return iterator::m_position;
+    }
+    /// \brief Gets the words of the container this iterator traverses.
+    /// \return The container's words.
+    std::container::bits::word* data() const
+    {
+        return iterator::m_data;
+    }
+
+    // ARITHMETIC
+    /// \brief Increments this iterator.
+    /// \return A reference to this iterator.
+    std::container::bits::iterator& operator++()
+    {
+        ++iterator::m_position;
+        return *this;
+    }
+    /// \brief Post-increments this iterator.
+    /// \return A copy of this iterator prior to incrementing.
+    std::container::bits::iterator operator++(int)
+    {
+        return std::container::bits::iterator(iterator::m_data, iterator::m_position++);
+    }
+    /// \brief Decrements this iterator.
+    /// \return A reference to this iterator.
+    std::container::bits::iterator& operator--()
+    {
+        --iterator::m_position;
+        return *this;
+    }
+    /// \brief Post-decrements this iterator.
+    /// \return A copy of this iterator prior to decrementing.
+    std::container::bits::iterator operator--(int)
+    {
+        return std::container::bits::iterator(iterator::m_data, iterator::m_position--);
+    }
+    /// \brief Advances this iterator by an offset.
+    /// \param[in] offset The offset to advance by.
+    /// \return A reference to this iterator.
+    std::container::bits::iterator& operator+=(std::ptrdiff_t offset)
+    {
+        iterator::m_position += offset;
+        return *this;
+    }
+    /// \brief Retreats this iterator by an offset.
+    /// \param[in] offset The offset to retreat by.
+    /// \return A reference to this iterator.
+    std::container::bits::iterator& operator-=(std::ptrdiff_t offset)
+    {
+        iterator::m_position -= offset;
+        return *this;
+    }
+    /// \brief Gets an iterator advanced by an offset.
+    /// \param[in] offset The offset to advance by.
+    /// \return The advanced iterator.
+    std::container::bits::iterator operator+(std::ptrdiff_t offset) const
+    {
+        return std::container::bits::iterator(iterator::m_data, iterator::m_position + offset);
+    }
+    /// \brief Gets an iterator retreated by an offset.
+    /// \param[in] offset The offset to retreat by.
+    /// \return The retreated iterator.
+    std::container::bits::iterator operator-(std::ptrdiff_t offset) const
+    {
+        return std::container::bits::iterator(iterator::m_data, iterator::m_position - offset);
+    }
+    /// \brief Gets the distance between this iterator and another iterator.
+    /// \param[in] other The other iterator.
+    /// \return The number of bits between the two iterators.
+    std::ptrdiff_t operator-(const std::container::bits::iterator& other) const
+    {
+        return static_cast<std::ptrdiff_t>(iterator::m_position) - static_cast<std::ptrdiff_t>(other.m_position);
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator is equal to another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators point to the same bit, otherwise FALSE.
+    bool operator==(const std::container::bits::iterator& other) const
+    {
+        return iterator::m_position == other.m_position;
+    }
+    /// \brief Checks if this iterator is unequal with another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators point to different bits, otherwise FALSE.
+    bool operator!=(const std::container::bits::iterator& other) const
+    {
+        return iterator::m_position != other.m_position;
+    }
+    /// \brief Checks if this iterator points before another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points before the other iterator, otherwise FALSE.
+    bool operator<(const std::container::bits::iterator& other) const
+    {
+        return iterator::m_position < other.m_position;
+    }
+    /// \brief Checks if this iterator points after another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points after the other iterator, otherwise FALSE.
+    bool operator>(const std::container::bits::iterator& other) const
+    {
+        return iterator::m_position > other.m_position;
+    }
+    /// \brief Checks if this iterator points before or to the same bit as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points before or to the same bit as the other iterator, otherwise FALSE.
+    bool operator<=(const std::container::bits::iterator& other) const
+    {
+        return iterator::m_position <= other.m_position;
+    }
+    /// \brief Checks if this iterator points after or to the same bit as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points after or to the same bit as the other iterator, otherwise FALSE.
+    bool operator>=(const std::container::bits::iterator& other) const
+    {
+        return iterator::m_position >= other.m_position;
+    }
+
+private:
+    /// \brief The container's words.
+    std::container::bits::word* m_data;
+    /// \brief The position of the bit pointed to by this iterator.
+    std::size_t m_position;
+};
+/// \brief A const iterator for traversing through the bits of a bit-packed container.
+class const_iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = bool;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->, which bits do not provide.
+    using pointer = void;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = bool;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new const iterator instance.
+    /// \param[in] data The container's words.
+    /// \param[in] position The position of the bit to point to.
+    const_iterator(const std::container::bits::word* data = nullptr, std::size_t position = 0)
+        : m_data(data),
+          m_position(position)
+    {}
+    /// \brief Constructs a new const iterator instance from an iterator.
+    /// \param[in] other The iterator to construct from.
+    const_iterator(const std::container::bits::iterator& other)
+        : m_data(other.data()),
+          m_position(other.position())
+    {}
+
+    // ACCESS
+    /// \brief Gets the value of the bit pointed to by this iterator.
+    /// \return The value of the bit.
+    bool operator*() const
+    {
+        return (const_iterator::m_data[std::container::bits::word_index(const_iterator::m_position)] & std::container::bits::mask(const_iterator::m_position)) != 0;
+    }
+    /// \brief Gets the value of a bit at an offset from this iterator.
+    /// \param[in] offset The offset of the bit.
+    /// \return The value of the bit.
+    bool operator[](std::ptrdiff_t offset) const
+    {
+        return *(*this + offset);
+    }
+    /// \brief Gets the position of the bit pointed to by this iterator.
+    /// \return The position of the bit.
+    std::size_t position() const
+    {
+        return const_iterator::m_position;
+    }
+
+    // ARITHMETIC
+    /// \brief Increments this iterator.
+    /// \return A reference to this iterator.
+    std::container::bits::const_iterator& operator++()
+    {
+        ++const_iterator::m_position;
+        return *this;
+    }
+    /// \brief Post-increments this iterator.
+    /// \return A copy of this iterator prior to incrementing.
+    std::container::bits::const_iterator operator++(int)
+    {
+        return std::container::bits::const_iterator(const_iterator::m_data, const_iterator::m_position++);
+    }
+    /// \brief Decrements this iterator.
+    /// \return A reference to this iterator.
+    std::container::bits::const_iterator& operator--()
+    {
+        --const_iterator::m_position;
+        return *this;
+    }
+    /// \brief Post-decrements this iterator.
+    /// \return A copy of this iterator prior to decrementing.
+    std::container::bits::const_iterator operator--(int)
+    {
+        return std::container::bits::const_iterator(const_iterator::m_data, const_iterator::m_position--);
+    }
+    /// \brief Advances this iterator by an offset.
+    /// \param[in] offset The offset to advance by.
+    /// \return A reference to this iterator.
+    std::container::bits::const_iterator& operator+=(std::ptrdiff_t offset)
+    {
+        const_iterator::m_position += offset;
+        return *this;
+    }
+    /// \brief Retreats this iterator by an offset.
+    /// \param[in] offset The offset to retreat by.
+    /// \return A reference to this iterator.
+    std::container::bits::const_iterator& operator-=(std::ptrdiff_t offset)
+    {
+        const_iterator::m_position -= offset;
+        return *this;
+    }
+    /// \brief Gets an iterator advanced by an offset.
+    /// \param[in] offset The offset to advance by.
+    /// \return The advanced iterator.
+    std::container::bits::const_iterator operator+(std::ptrdiff_t offset) const
+    {
+        return std::container::bits::const_iterator(const_iterator::m_data, const_iterator::m_position + offset);
+    }
+    /// \brief Gets an iterator retreated by an offset.
+    /// \param[in] offset The offset to retreat by.
+    /// \return The retreated iterator.
+    std::container::bits::const_iterator operator-(std::ptrdiff_t offset) const
+    {
+        return std::container::bits::const_iterator(const_iterator::m_data, const_iterator::m_position - offset);
+    }
+    /// \brief Gets the distance between this iterator and another iterator.
+    /// \param[in] other The other iterator.
+    /// \return The number of bits between the two iterators.
+    std::ptrdiff_t operator-(const std::container::bits::const_iterator& other) const
+    {
+        return static_cast<std::ptrdiff_t>(const_iterator::m_position) - static_cast<std::ptrdiff_t>(other.m_position);
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator is equal to another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators point to the same bit, otherwise FALSE.
+    bool operator==(const std::container::bits::const_iterator& other) const
+    {
+        return const_iterator::m_position == other.m_position;
+    }
+    /// \brief Checks if this iterator is unequal with another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators point to different bits, otherwise FALSE.
+    bool operator!=(const std::container::bits::const_iterator& other) const
+    {
+        return const_iterator::m_position != other.m_position;
+    }
+    /// \brief Checks if this iterator points before another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points before the other iterator, otherwise FALSE.
+    bool operator<(const std::container::bits::const_iterator& other) const
+    {
+        return const_iterator::m_position < other.m_position;
+    }
+    /// \brief Checks if this iterator points after another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points after the other iterator, otherwise FALSE.
+    bool operator>(const std::container::bits::const_iterator& other) const
+    {
+        return const_iterator::m_position > other.m_position;
+    }
+    /// \brief Checks if this iterator points before or to the same bit as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points before or to the same bit as the other iterator, otherwise FALSE.
+    bool operator<=(const std::container::bits::const_iterator& other) const
+    {
+        return const_iterator::m_position <= other.m_position;
+    }
+    /// \brief Checks if this iterator points after or to the same bit as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points after or to the same bit as the other iterator, otherwise FALSE.
+    bool operator>=(const std::container::bits::const_iterator& other) const
+    {
+        return const_iterator::m_position >= other.m_position;
+    }
+
+private:
+    /// \brief The container's words.
+    const std::container::bits::word* m_data;
+    /// \brief The position of the bit pointed to by this iterator.
+    std::size_t m_position;
+};
+
+// KERNELS
+/// \brief Clears the unused bits in the last word of a bit array.
+/// \param[in] data The bit array's words.
+/// \param[in] bits The number of used bits in the bit array.
+inline void trim(std::container::bits::word* data, std::size_t bits)
+{
+    // Mask the last word if it is partially used.
+    std::size_t used = bits % std::container::bits::word_size;
+    if(used != 0)
+    {
+        data[bits / std::container::bits::word_size] &= (std::container::bits::word(1) << used) - 1;
+    }
+}
+/// \brief Sets all words in a bit array to a specified value.
+/// \param[in] data The bit array's words.
+/// \param[in] words The number of words in the bit array.
+/// \param[in] value The value to set each word to.
+inline void fill(std::container::bits::word* data, std::size_t words, std::container::bits::word value)
+{
+    for(auto entry = data; entry != data + words; ++entry)
+    {
+        *entry = value;
+    }
+}
+/// \brief Counts the set bits in a bit array.
+/// \param[in] data The bit array's words.
+/// \param[in] words The number of words in the bit array.
+/// \return The number of set bits.
+inline std::size_t count(const std::container::bits::word* data, std::size_t words)
+{
+    // Sum the population count of each word.
+    std::size_t count = 0;
+    for(auto entry = data; entry != data + words; ++entry)
+    {
+        count += __builtin_popcount(*entry);
+    }
+
+    return count;
+}
+/// \brief Checks if any bit is set in a bit array.
+/// \param[in] data The bit array's words.
+/// \param[in] words The number of words in the bit array.
+/// \return TRUE if any bit is set, otherwise FALSE.
+inline bool any(const std::container::bits::word* data, std::size_t words)
+{
+    for(auto entry = data; entry != data + words; ++entry)
+    {
+        if(*entry != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+/// \brief Finds the first set bit at or after a starting position in a bit array.
+/// \param[in] data The bit array's words.
+/// \param[in] bits The number of used bits in the bit array.
+/// \param[in] start The position to start searching from.
+/// \return The position of the found bit, or bits if no set bit was found.
+/// \note Unused bits in the last word must be clear.
+inline std::size_t find(const std::container::bits::word* data, std::size_t bits, std::size_t start)
+{
+    // Verify start is within the bit array.
+    if(start >= bits)
+    {
+        return bits;
+    }
+
+    // Mask off bits before the start in the first word.
+    std::size_t index = start / std::container::bits::word_size;
+    std::container::bits::word value = data[index] & (~std::container::bits::word(0) << (start % std::container::bits::word_size));
+
+    // Skip empty words and locate the bit with count-trailing-zeros.
+    std::size_t words = std::container::bits::word_count(bits);
+    while(true)
+    {
+        if(value != 0)
+        {
+            return index * std::container::bits::word_size + __builtin_ctz(value);
+        }
+        if(++index == words)
+        {
+            return bits;
+        }
+        value = data[index];
+    }
+}
+/// \brief Shifts a bit array towards higher positions, filling with zeros.
+/// \param[in] data The bit array's words.
+/// \param[in] words The number of words in the bit array.
+/// \param[in] shift The number of positions to shift.
+/// \note Unused bits in the last word must be trimmed afterwards.
+inline void shift_left(std::container::bits::word* data, std::size_t words, std::size_t shift)
+{
+    // Split shift into whole words and remaining bits.
+    std::size_t word_shift = shift / std::container::bits::word_size;
+    std::size_t bit_shift = shift % std::container::bits::word_size;
+
+    // Check if the entire array is shifted out.
+    if(word_shift >= words)
+    {
+        std::container::bits::fill(data, words, 0);
+        return;
+    }
+
+    // Move words from low to high, starting at the top.
+    if(bit_shift == 0)
+    {
+        for(std::size_t i = words - 1; i >= word_shift + 1; --i)
+        {
+            data[i] = data[i - word_shift];
+        }
+    }
+    else
+    {
+        for(std::size_t i = words - 1; i >= word_shift + 1; --i)
+        {
+            data[i] = (data[i - word_shift] << bit_shift) | (data[i - word_shift - 1] >> (std::container::bits::word_size - bit_shift));
+        }
+    }
+    data[word_shift] = data[0] << bit_shift;
+
+    // Clear vacated words.
+    std::container::bits::fill(data, word_shift, 0);
+}
+/// \brief Shifts a bit array towards lower positions, filling with zeros.
+/// \param[in] data The bit array's words.
+/// \param[in] words The number of words in the bit array.
+/// \param[in] shift The number of positions to shift.
+/// \note Unused bits in the last word must be clear.
+inline void shift_right(std::container::bits::word* data, std::size_t words, std::size_t shift)
+{
+    // Split shift into whole words and remaining bits.
+    std::size_t word_shift = shift / std::container::bits::word_size;
+    std::size_t bit_shift = shift % std::container::bits::word_size;
+
+    // Check if the entire array is shifted out.
+    if(word_shift >= words)
+    {
+        std::container::bits::fill(data, words, 0);
+        return;
+    }
+
+    // Move words from high to low, starting at the bottom.
+    std::size_t last = words - word_shift - 1;
+    if(bit_shift == 0)
+    {
+        for(std::size_t i = 0; i < last; ++i)
+        {
+            data[i] = data[i + word_shift];
+        }
+    }
+    else
+    {
+        for(std::size_t i = 0; i < last; ++i)
+        {
+            data[i] = (data[i + word_shift] >> bit_shift) | (data[i + word_shift + 1] << (std::container::bits::word_size - bit_shift));
+        }
+    }
+    data[last] = data[words - 1] >> bit_shift;
+
+    // Clear vacated words.
+    std::container::bits::fill(data + last + 1, word_shift, 0);
+}
+
+}}
+
+#endif
\ No newline at end of file
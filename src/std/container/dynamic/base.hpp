@@ -4,8 +4,12 @@
 #define STD___CONTAINER___DYNAMIC___BASE_H
 
 // std
+#include <std/algorithm/compare.hpp>
 #include <std/container/iterator.hpp>
+#include <std/container/reverse_iterator.hpp>
 #include <std/stddef.hpp>
+#include <std/utility/is_trivially_copyable.hpp>
+#include <std/utility/move.hpp>
 
 // arduino
 #include <Arduino.h>
@@ -19,6 +23,67 @@ namespace container {
 /// \brief Contains all code for dynamic container components.
 namespace dynamic {
 
+/// \brief Moves blocks of objects within a container's memory, one object at a time.
+/// \tparam trivial TRUE if the objects are trivially copyable, otherwise FALSE.
+template <bool trivial>
+struct block
+{
+    /// \brief Moves a block of objects to a lower address.
+    /// \tparam object_type The type of the objects to move.
+    /// \param[in] destination The beginning of the destination.
+    /// \param[in] source The beginning of the block to move.
+    /// \param[in] count The number of objects to move.
+    template <typename object_type>
+    static void move(object_type* destination, object_type* source, std::size_t count)
+    {
+        // Move objects front to back, so an overlapping source is read before it is overwritten.
+        for(object_type* end = source + count; source < end;)
+        {
+            *destination++ = std::move(*source++);
+        }
+    }
+    /// \brief Moves a block of objects to a higher address.
+    /// \tparam object_type The type of the objects to move.
+    /// \param[in] destination The beginning of the destination.
+    /// \param[in] source The beginning of the block to move.
+    /// \param[in] count The number of objects to move.
+    template <typename object_type>
+    static void move_backward(object_type* destination, object_type* source, std::size_t count)
+    {
+        // Move objects back to front, so an overlapping source is read before it is overwritten.
+        while(count-- > 0)
+        {
+            destination[count] = std::move(source[count]);
+        }
+    }
+};
+
+/// \brief Moves blocks of trivially copyable objects within a container's memory with a single memmove.
+template <>
+struct block<true>
+{
+    /// \brief Moves a block of objects to a lower address.
+    /// \tparam object_type The type of the objects to move.
+    /// \param[in] destination The beginning of the destination.
+    /// \param[in] source The beginning of the block to move.
+    /// \param[in] count The number of objects to move.
+    template <typename object_type>
+    static void move(object_type* destination, object_type* source, std::size_t count)
+    {
+        memmove(destination, source, count * sizeof(object_type));
+    }
+    /// \brief Moves a block of objects to a higher address.
+    /// \tparam object_type The type of the objects to move.
+    /// \param[in] destination The beginning of the destination.
+    /// \param[in] source The beginning of the block to move.
+    /// \param[in] count The number of objects to move.
+    template <typename object_type>
+    static void move_backward(object_type* destination, object_type* source, std::size_t count)
+    {
+        memmove(destination, source, count * sizeof(object_type));
+    }
+};
+
 /// \brief A base dynamic-sized container.
 /// \tparam object_type The object type stored in the container.
 template <typename object_type>
@@ -93,6 +158,42 @@ public:
     {
         return base::m_end;
     }
+    /// \brief Gets a reverse_iterator to the beginning of the reversed container, which is its last element.
+    /// \return The reverse begin iterator.
+    std::reverse_iterator<std::iterator<object_type>> rbegin()
+    {
+        return std::reverse_iterator<std::iterator<object_type>>(base::m_end);
+    }
+    /// \brief Gets a reverse_iterator to the end of the reversed container, which is before its first element.
+    /// \return The reverse end iterator.
+    std::reverse_iterator<std::iterator<object_type>> rend()
+    {
+        return std::reverse_iterator<std::iterator<object_type>>(base::m_begin);
+    }
+    /// \brief Gets a const reverse_iterator to the beginning of the reversed container, which is its last element.
+    /// \return The reverse begin const iterator.
+    std::reverse_iterator<std::const_iterator<object_type>> rbegin() const
+    {
+        return std::reverse_iterator<std::const_iterator<object_type>>(base::m_end);
+    }
+    /// \brief Gets a const reverse_iterator to the end of the reversed container, which is before its first element.
+    /// \return The reverse end const iterator.
+    std::reverse_iterator<std::const_iterator<object_type>> rend() const
+    {
+        return std::reverse_iterator<std::const_iterator<object_type>>(base::m_begin);
+    }
+    /// \brief Gets a const reverse_iterator to the beginning of the reversed container, which is its last element.
+    /// \return The reverse begin const iterator.
+    std::reverse_iterator<std::const_iterator<object_type>> crbegin() const
+    {
+        return std::reverse_iterator<std::const_iterator<object_type>>(base::m_end);
+    }
+    /// \brief Gets a const reverse_iterator to the end of the reversed container, which is before its first element.
+    /// \return The reverse end const iterator.
+    std::reverse_iterator<std::const_iterator<object_type>> crend() const
+    {
+        return std::reverse_iterator<std::const_iterator<object_type>>(base::m_begin);
+    }
 
     // MODIFIERS
     /// \brief Erases an element from the container.
@@ -119,24 +220,26 @@ public:
     }
     /// \brief Erases a range of elements from the container.
     /// \param[in] begin The iterator to the beginning of the range.
-    /// \param[in] end The iterator to the end of the range.
+    /// \param[in] end The iterator to the end of the range (exclusive).
     /// \return An iterator to the element after the last erased element.
+    /// \details The elements after the range are moved down in a single block.
     std::iterator<object_type> erase(std::iterator<object_type> begin, std::iterator<object_type> end)
     {
-        // Shift left by number of elements in the inclusive range.
-        base::shift_left(end + 1, end - begin + 1);
+        // Shift left by number of elements in the half-open range.
+        base::shift_left(end, end - begin);
 
         // Begin now points to the next element.
         return begin;
     }
     /// \brief Erases a range of elements from the container.
     /// \param[in] begin The const iterator to the beginning of the range.
-    /// \param[in] end The const iterator to the end of the range.
+    /// \param[in] end The const iterator to the end of the range (exclusive).
     /// \return An iterator to the element after the last erased element.
+    /// \details The elements after the range are moved down in a single block.
     std::const_iterator<object_type> erase(std::const_iterator<object_type> begin, std::const_iterator<object_type> end)
     {
-        // Shift left by number of elements in the inclusive range.
-        base::shift_left(const_cast<std::iterator<object_type>>(end + 1), end - begin + 1);
+        // Shift left by number of elements in the half-open range.
+        base::shift_left(const_cast<std::iterator<object_type>>(end), end - begin);
 
         // Begin now points to the next element.
         return begin;
@@ -244,53 +347,58 @@ public:
     /// \return TRUE if the two containers are equal, otherwise FALSE.
     bool operator==(const std::container::dynamic::base<object_type>& other) const
     {
-        // Verify container sizes match.
-        if(base::m_end - base::m_begin != other.m_end - other.m_begin)
-        {
-            return false;
-        }
-
-        // Compare values.
-        auto this_entry = base::m_begin;
-        auto other_entry = other.m_begin;
-        while(this_entry < base::m_end)
-        {
-            if(*this_entry++ != *other_entry++)
-            {
-                return false;
-            }
-        }
-
-        // Indicate equal.
-        return true;
+        // Verify container sizes match, then compare values (with memcmp where the type allows).
+        return base::m_end - base::m_begin == other.m_end - other.m_begin && std::equal(base::m_begin, base::m_end, other.m_begin);
     }
     /// \brief Checks if this container is unequal with another container.
     /// \param[in] other The other container to compare with.
     /// \return TRUE if the two containers are unequal, otherwise FALSE.
     bool operator!=(const std::container::dynamic::base<object_type>& other) const
     {
-        // Check for size difference shortcut.
-        if(base::m_end - base::m_begin != other.m_end - other.m_begin)
-        {
-            return true;
-        }
-
-        // Compare values.
-        auto this_entry = base::m_begin;
-        auto other_entry = other.m_begin;
-        while(this_entry < base::m_end)
-        {
-            if(*this_entry++ != *other_entry++)
-            {
-                return true;
-            }
-        }
-
-        // Indicate equal.
-        return false;
+        return !base::operator==(other);
+    }
+    /// \brief Checks if this container is lexicographically less than another container.
+    /// \param[in] other The other container to compare with.
+    /// \return TRUE if this container is ordered before the other container, otherwise FALSE.
+    bool operator<(const std::container::dynamic::base<object_type>& other) const
+    {
+        return std::lexicographical_compare(base::m_begin, base::m_end, other.m_begin, other.m_end);
+    }
+    /// \brief Checks if this container is lexicographically less than or equal to another container.
+    /// \param[in] other The other container to compare with.
+    /// \return TRUE if this container is not ordered after the other container, otherwise FALSE.
+    bool operator<=(const std::container::dynamic::base<object_type>& other) const
+    {
+        return !other.operator<(*this);
+    }
+    /// \brief Checks if this container is lexicographically greater than another container.
+    /// \param[in] other The other container to compare with.
+    /// \return TRUE if this container is ordered after the other container, otherwise FALSE.
+    bool operator>(const std::container::dynamic::base<object_type>& other) const
+    {
+        return other.operator<(*this);
+    }
+    /// \brief Checks if this container is lexicographically greater than or equal to another container.
+    /// \param[in] other The other container to compare with.
+    /// \return TRUE if this container is not ordered before the other container, otherwise FALSE.
+    bool operator>=(const std::container::dynamic::base<object_type>& other) const
+    {
+        return !base::operator<(other);
     }
 
 protected:
+    // CONSTRUCTORS
+    /// \brief Constructs a new base container instance over storage provided by a derived container.
+    /// \param[in] storage The storage for the container.
+    /// \param[in] capacity The number of objects the storage can hold.
+    /// \note The storage is deleted with delete[] on destruction, so a derived container that provides storage not
+    /// allocated with new[] must reset m_begin to nullptr in its own destructor.
+    base(object_type* storage, std::size_t capacity)
+        : m_begin(storage),
+          m_end(storage),
+          m_capacity(storage + capacity)
+    {}
+
     // MEMORY
     /// \brief Stores a pointer to the beginning of the container's contiguous memory.
     object_type* m_begin;
@@ -299,6 +407,30 @@ protected:
     /// \brief Stores a pointer to the capacity limit of the container's contiguous memory.
     object_type* m_capacity;
     
+    /// \brief Moves the container's elements into a new allocation.
+    /// \param[in] capacity The capacity of the new allocation, which must be at least the container's size.
+    /// \return A pointer to the container's previous storage, which the caller is responsible for releasing.
+    object_type* relocate(std::size_t capacity)
+    {
+        // Create the new allocation.
+        object_type* storage = new object_type[capacity];
+
+        // Move elements into the new allocation.
+        auto destination = storage;
+        for(auto source = base::m_begin; source < base::m_end; ++source)
+        {
+            *destination++ = std::move(*source);
+        }
+
+        // Point the container at the new allocation.
+        object_type* previous = base::m_begin;
+        base::m_begin = storage;
+        base::m_end = destination;
+        base::m_capacity = storage + capacity;
+
+        return previous;
+    }
+
     // SHIFT
     /// \brief Shifts elements in the container left and reduces the size of the container.
     /// \param[in] position The position (inclusive) to begin the left-shift.
@@ -324,15 +456,8 @@ protected:
             return true;
         }
 
-        // Create source and destination iterators.
-        std::iterator<object_type> source = position;
-        std::iterator<object_type> destination = position - count;
-
-        // Shift elements left.
-        while(source < base::m_end)
-        {
-            *destination++ = *source++;
-        }
+        // Shift elements left in a single block.
+        std::container::dynamic::block<std::is_trivially_copyable<object_type>::value>::move(position - count, position, base::m_end - position);
 
         // Update container end.
         base::m_end -= count;
@@ -364,19 +489,8 @@ protected:
             return true;
         }
 
-        // Shift elements right if container is not empty.
-        if(base::m_end != base::m_begin)
-        {
-            // Create source and destination iterators.
-            std::iterator<object_type> source = base::m_end - 1;
-            std::iterator<object_type> destination = base::m_end + count - 1;
-
-            // Shift elements right.
-            while(source >= position)
-            {
-                *destination-- = *source--;
-            }
-        }
+        // Shift elements right in a single block.
+        std::container::dynamic::block<std::is_trivially_copyable<object_type>::value>::move_backward(position + count, position, base::m_end - position);
 
         // Update container end.
         base::m_end += count;
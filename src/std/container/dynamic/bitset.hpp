@@ -0,0 +1,434 @@
+/// \file std/container/dynamic/bitset.hpp
+/// \brief Defines the std::dynamic_bitset class.
+#ifndef STD___CONTAINER___DYNAMIC___BITSET_H
+#define STD___CONTAINER___DYNAMIC___BITSET_H
+
+// std
+#include <std/container/bits.hpp>
+#include <std/stddef.hpp>
+
+namespace std {
+
+/// \brief A dynamically-sized sequence of bits, packed into machine words.
+/// \details Like other dynamic containers, the bitset takes a capacity at construction which limits its maximum size.
+/// Bitwise operations between two bitsets require both bitsets to have the same size.
+class dynamic_bitset
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty dynamic_bitset instance.
+    /// \param[in] capacity The maximum number of bits the bitset can hold.
+    dynamic_bitset(std::size_t capacity)
+        : m_data(new std::container::bits::word[std::container::bits::word_count(capacity)]),
+          m_size(0),
+          m_capacity(capacity)
+    {}
+    /// \brief Copy-constructs a new dynamic_bitset instance from another dynamic_bitset.
+    /// \param[in] other The other instance to copy-construct from.
+    /// \note This performs a deep copy.
+    dynamic_bitset(const std::dynamic_bitset& other)
+        : m_data(new std::container::bits::word[std::container::bits::word_count(other.m_capacity)]),
+          m_size(other.m_size),
+          m_capacity(other.m_capacity)
+    {
+        // Copy words from other.
+        memcpy(dynamic_bitset::m_data, other.m_data, std::container::bits::word_count(other.m_size) * sizeof(std::container::bits::word));
+    }
+    /// \brief Move-constructs a new dynamic_bitset instance from another dynamic_bitset.
+    /// \param[in] other The other instance to move-construct from.
+    dynamic_bitset(std::dynamic_bitset&& other)
+        : m_data(other.m_data),
+          m_size(other.m_size),
+          m_capacity(other.m_capacity)
+    {
+        // Reset the other bitset to a new allocation.
+        other.m_data = new std::container::bits::word[std::container::bits::word_count(other.m_capacity)];
+        other.m_size = 0;
+    }
+    ~dynamic_bitset()
+    {
+        // Clean up allocated memory.
+        delete [] dynamic_bitset::m_data;
+    }
+
+    // ACCESS
+    /// \brief Gets the value of a bit.
+    /// \param[in] position The position of the bit.
+    /// \return The value of the bit.
+    bool operator[](std::size_t position) const
+    {
+        return (dynamic_bitset::m_data[std::container::bits::word_index(position)] & std::container::bits::mask(position)) != 0;
+    }
+    /// \brief Gets a reference to a bit.
+    /// \param[in] position The position of the bit.
+    /// \return A proxy reference to the bit.
+    std::container::bits::reference operator[](std::size_t position)
+    {
+        return std::container::bits::reference(&dynamic_bitset::m_data[std::container::bits::word_index(position)], std::container::bits::mask(position));
+    }
+    /// \brief Gets the value of a bit.
+    /// \param[in] position The position of the bit.
+    /// \return The value of the bit.
+    /// \note The name is parenthesized so that it is not expanded by function-like test() macros, such as AUnit's.
+    bool (test)(std::size_t position) const
+    {
+        return (dynamic_bitset::m_data[std::container::bits::word_index(position)] & std::container::bits::mask(position)) != 0;
+    }
+    /// \brief Checks if all bits are set.
+    /// \return TRUE if all bits are set, otherwise FALSE.
+    bool all() const
+    {
+        return std::container::bits::count(dynamic_bitset::m_data, dynamic_bitset::words()) == dynamic_bitset::m_size;
+    }
+    /// \brief Checks if any bit is set.
+    /// \return TRUE if any bit is set, otherwise FALSE.
+    bool any() const
+    {
+        return std::container::bits::any(dynamic_bitset::m_data, dynamic_bitset::words());
+    }
+    /// \brief Checks if no bits are set.
+    /// \return TRUE if no bits are set, otherwise FALSE.
+    bool none() const
+    {
+        return !std::container::bits::any(dynamic_bitset::m_data, dynamic_bitset::words());
+    }
+    /// \brief Counts the number of set bits.
+    /// \return The number of set bits.
+    std::size_t count() const
+    {
+        return std::container::bits::count(dynamic_bitset::m_data, dynamic_bitset::words());
+    }
+    /// \brief Finds the first set bit.
+    /// \return The position of the first set bit, or dynamic_bitset::size() if no bits are set.
+    std::size_t find_first() const
+    {
+        return std::container::bits::find(dynamic_bitset::m_data, dynamic_bitset::m_size, 0);
+    }
+    /// \brief Finds the next set bit after a specified position.
+    /// \param[in] position The position to search after.
+    /// \return The position of the next set bit, or dynamic_bitset::size() if no further bits are set.
+    std::size_t find_next(std::size_t position) const
+    {
+        return std::container::bits::find(dynamic_bitset::m_data, dynamic_bitset::m_size, position + 1);
+    }
+
+    // MODIFIERS
+    /// \brief Sets all bits.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& set()
+    {
+        std::container::bits::fill(dynamic_bitset::m_data, dynamic_bitset::words(), ~std::container::bits::word(0));
+        std::container::bits::trim(dynamic_bitset::m_data, dynamic_bitset::m_size);
+
+        return *this;
+    }
+    /// \brief Sets a bit to a specified value.
+    /// \param[in] position The position of the bit.
+    /// \param[in] value The value to set the bit to.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& set(std::size_t position, bool value = true)
+    {
+        dynamic_bitset::operator[](position) = value;
+
+        return *this;
+    }
+    /// \brief Clears all bits.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& reset()
+    {
+        std::container::bits::fill(dynamic_bitset::m_data, dynamic_bitset::words(), 0);
+
+        return *this;
+    }
+    /// \brief Clears a bit.
+    /// \param[in] position The position of the bit.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& reset(std::size_t position)
+    {
+        dynamic_bitset::m_data[std::container::bits::word_index(position)] &= ~std::container::bits::mask(position);
+
+        return *this;
+    }
+    /// \brief Flips all bits.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& flip()
+    {
+        for(auto entry = dynamic_bitset::m_data; entry != dynamic_bitset::m_data + dynamic_bitset::words(); ++entry)
+        {
+            *entry = ~*entry;
+        }
+        std::container::bits::trim(dynamic_bitset::m_data, dynamic_bitset::m_size);
+
+        return *this;
+    }
+    /// \brief Flips a bit.
+    /// \param[in] position The position of the bit.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& flip(std::size_t position)
+    {
+        dynamic_bitset::m_data[std::container::bits::word_index(position)] ^= std::container::bits::mask(position);
+
+        return *this;
+    }
+    /// \brief Appends a bit to the end of the bitset.
+    /// \param[in] value The value of the bit to append.
+    /// \return TRUE if the operation succeeded, FALSE if the bitset is at capacity.
+    bool push_back(bool value)
+    {
+        // Verify capacity.
+        if(dynamic_bitset::m_size == dynamic_bitset::m_capacity)
+        {
+            return false;
+        }
+
+        // Clear a newly used word before writing into it.
+        if(dynamic_bitset::m_size % std::container::bits::word_size == 0)
+        {
+            dynamic_bitset::m_data[std::container::bits::word_index(dynamic_bitset::m_size)] = 0;
+        }
+
+        // Set the new bit and increment size.
+        dynamic_bitset::set(dynamic_bitset::m_size++, value);
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Removes the last bit from the bitset.
+    void pop_back()
+    {
+        // Verify bitset isn't empty.
+        if(dynamic_bitset::m_size == 0)
+        {
+            return;
+        }
+
+        // Clear the removed bit to keep unused bits clear.
+        dynamic_bitset::reset(--dynamic_bitset::m_size);
+    }
+    /// \brief Resizes the bitset to a specified size, using a provided value for additional bits if needed.
+    /// \param[in] size The size to set the bitset to.
+    /// \param[in] value The value to assign to additional bits.
+    /// \return TRUE if the resize succeeded, FALSE if the bitset does not have enough capacity.
+    bool resize(std::size_t size, bool value = false)
+    {
+        // Verify capacity.
+        if(size > dynamic_bitset::m_capacity)
+        {
+            return false;
+        }
+
+        // Check if size is greater than current size.
+        if(size > dynamic_bitset::m_size)
+        {
+            // Clear the newly used words.
+            std::size_t used_words = dynamic_bitset::words();
+            std::container::bits::fill(dynamic_bitset::m_data + used_words, std::container::bits::word_count(size) - used_words, 0);
+
+            // Populate new bits a word at a time.
+            if(value)
+            {
+                // Fill the remainder of the current partial word.
+                std::size_t position = dynamic_bitset::m_size;
+                for(; position < size && position % std::container::bits::word_size != 0; ++position)
+                {
+                    dynamic_bitset::m_data[std::container::bits::word_index(position)] |= std::container::bits::mask(position);
+                }
+
+                // Fill the remaining whole words.
+                if(position % std::container::bits::word_size == 0)
+                {
+                    std::container::bits::fill(dynamic_bitset::m_data + std::container::bits::word_index(position), std::container::bits::word_count(size) - std::container::bits::word_index(position), ~std::container::bits::word(0));
+                }
+            }
+        }
+
+        // Update size and clear unused bits.
+        dynamic_bitset::m_size = size;
+        std::container::bits::trim(dynamic_bitset::m_data, size);
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Clears all bits from the bitset.
+    void clear()
+    {
+        dynamic_bitset::m_size = 0;
+    }
+    /// \brief Swaps the contents of this bitset with another bitset.
+    /// \param[in] other The other bitset to swap with.
+    void swap(std::dynamic_bitset& other)
+    {
+        // Store this bitset's members in temporaries.
+        auto temp_data = dynamic_bitset::m_data;
+        auto temp_size = dynamic_bitset::m_size;
+        auto temp_capacity = dynamic_bitset::m_capacity;
+
+        // Store the other bitset's members in this bitset.
+        dynamic_bitset::m_data = other.m_data;
+        dynamic_bitset::m_size = other.m_size;
+        dynamic_bitset::m_capacity = other.m_capacity;
+
+        // Store this bitset's original members in the other bitset.
+        other.m_data = temp_data;
+        other.m_size = temp_size;
+        other.m_capacity = temp_capacity;
+    }
+    /// \brief Copy-assigns the contents of another bitset to this bitset.
+    /// \param[in] other The other bitset to copy-assign from.
+    /// \return A reference to this bitset.
+    /// \note This performs a deep copy.
+    std::dynamic_bitset& operator=(const std::dynamic_bitset& other)
+    {
+        // Free this bitset's memory.
+        delete [] dynamic_bitset::m_data;
+
+        // Create new memory based on the other bitset's capacity.
+        dynamic_bitset::m_data = new std::container::bits::word[std::container::bits::word_count(other.m_capacity)];
+        dynamic_bitset::m_size = other.m_size;
+        dynamic_bitset::m_capacity = other.m_capacity;
+
+        // Copy words from other.
+        memcpy(dynamic_bitset::m_data, other.m_data, dynamic_bitset::words() * sizeof(std::container::bits::word));
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another bitset to this bitset.
+    /// \param[in] other The other bitset to move-assign from.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& operator=(std::dynamic_bitset&& other)
+    {
+        // Free this bitset's memory.
+        delete [] dynamic_bitset::m_data;
+
+        // Copy other bitset's memory into this bitset.
+        dynamic_bitset::m_data = other.m_data;
+        dynamic_bitset::m_size = other.m_size;
+        dynamic_bitset::m_capacity = other.m_capacity;
+
+        // Reset the other bitset's memory to a new allocation.
+        other.m_data = new std::container::bits::word[std::container::bits::word_count(other.m_capacity)];
+        other.m_size = 0;
+
+        return *this;
+    }
+
+    // OPERATORS
+    /// \brief Performs a bitwise AND with another bitset of the same size.
+    /// \param[in] other The other bitset.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& operator&=(const std::dynamic_bitset& other)
+    {
+        for(std::size_t i = 0; i < dynamic_bitset::words(); ++i)
+        {
+            dynamic_bitset::m_data[i] &= other.m_data[i];
+        }
+
+        return *this;
+    }
+    /// \brief Performs a bitwise OR with another bitset of the same size.
+    /// \param[in] other The other bitset.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& operator|=(const std::dynamic_bitset& other)
+    {
+        for(std::size_t i = 0; i < dynamic_bitset::words(); ++i)
+        {
+            dynamic_bitset::m_data[i] |= other.m_data[i];
+        }
+
+        return *this;
+    }
+    /// \brief Performs a bitwise XOR with another bitset of the same size.
+    /// \param[in] other The other bitset.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& operator^=(const std::dynamic_bitset& other)
+    {
+        for(std::size_t i = 0; i < dynamic_bitset::words(); ++i)
+        {
+            dynamic_bitset::m_data[i] ^= other.m_data[i];
+        }
+
+        return *this;
+    }
+    /// \brief Shifts all bits towards higher positions, filling with zeros.
+    /// \param[in] shift The number of positions to shift.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& operator<<=(std::size_t shift)
+    {
+        std::container::bits::shift_left(dynamic_bitset::m_data, dynamic_bitset::words(), shift);
+        std::container::bits::trim(dynamic_bitset::m_data, dynamic_bitset::m_size);
+
+        return *this;
+    }
+    /// \brief Shifts all bits towards lower positions, filling with zeros.
+    /// \param[in] shift The number of positions to shift.
+    /// \return A reference to this bitset.
+    std::dynamic_bitset& operator>>=(std::size_t shift)
+    {
+        std::container::bits::shift_right(dynamic_bitset::m_data, dynamic_bitset::words(), shift);
+
+        return *this;
+    }
+
+    // CAPACITY
+    /// \brief Gets the number of bits in the bitset.
+    /// \return The number of bits in the bitset.
+    std::size_t size() const
+    {
+        return dynamic_bitset::m_size;
+    }
+    /// \brief Gets the maximum capacity of the bitset.
+    /// \return The capacity of the bitset, in bits.
+    std::size_t capacity() const
+    {
+        return dynamic_bitset::m_capacity;
+    }
+    /// \brief Checks if the bitset is empty.
+    /// \return TRUE if the bitset is empty, otherwise FALSE.
+    bool empty() const
+    {
+        return dynamic_bitset::m_size == 0;
+    }
+    /// \brief Checks if the bitset is at capacity.
+    /// \return TRUE if the bitset is at capacity, otherwise FALSE.
+    bool full() const
+    {
+        return dynamic_bitset::m_size == dynamic_bitset::m_capacity;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this bitset is equal to another bitset.
+    /// \param[in] other The other bitset to compare with.
+    /// \return TRUE if the two bitsets are equal, otherwise FALSE.
+    bool operator==(const std::dynamic_bitset& other) const
+    {
+        return dynamic_bitset::m_size == other.m_size && memcmp(dynamic_bitset::m_data, other.m_data, dynamic_bitset::words() * sizeof(std::container::bits::word)) == 0;
+    }
+    /// \brief Checks if this bitset is unequal with another bitset.
+    /// \param[in] other The other bitset to compare with.
+    /// \return TRUE if the two bitsets are unequal, otherwise FALSE.
+    bool operator!=(const std::dynamic_bitset& other) const
+    {
+        return !dynamic_bitset::operator==(other);
+    }
+
+protected:
+    // MEMORY
+    /// \brief Stores the bits packed into words, lowest position first. Unused bits in the last used word are kept clear.
+    std::container::bits::word* m_data;
+    /// \brief Stores the number of bits in the bitset.
+    std::size_t m_size;
+    /// \brief Stores the maximum number of bits the bitset can hold.
+    std::size_t m_capacity;
+
+    // WORDS
+    /// \brief Gets the number of words used by the bitset's current size.
+    /// \return The number of used words.
+    std::size_t words() const
+    {
+        return std::container::bits::word_count(dynamic_bitset::m_size);
+    }
+};
+
+}
+
+#endif
\ No newline at end of file
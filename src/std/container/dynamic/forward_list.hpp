@@ -0,0 +1,537 @@
+/// \file std/container/dynamic/forward_list.hpp
+/// \brief Defines the std::forward_list template class.
+#ifndef STD___CONTAINER___DYNAMIC___FORWARD_LIST_H
+#define STD___CONTAINER___DYNAMIC___FORWARD_LIST_H
+
+// std
+#include <std/container/dynamic/pool.hpp>
+#include <std/container/iterator.hpp>
+#include <std/utility/move.hpp>
+
+namespace std {
+
+namespace container::dynamic {
+
+/// \brief Contains all code for std::forward_list components.
+namespace forward_list {
+
+/// \brief The link of a singly-linked list node.
+struct links
+{
+    /// \brief The next node in the list, or the next free node while in a pool.
+    std::container::dynamic::forward_list::links* next;
+};
+
+/// \brief A singly-linked list node.
+/// \tparam object_type The object type stored in the node.
+template <typename object_type>
+struct node
+    : public std::container::dynamic::forward_list::links
+{
+    /// \brief The object stored in the node.
+    object_type value;
+};
+
+/// \brief A forward iterator for traversing a std::forward_list.
+/// \tparam object_type The object type stored in the list.
+template <typename object_type>
+class iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::forward_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = object_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = object_type*;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = object_type&;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new iterator instance.
+    /// \param[in] links The node links the iterator points to.
+    iterator(std::container::dynamic::forward_list::links* links = nullptr)
+        : m_links(links)
+    {}
+
+    // ACCESS
+    /// \brief Gets a reference to the object the iterator points to.
+    /// \return A reference to the object.
+    object_type& operator*() const
+    {
+        return static_cast<std::container::dynamic::forward_list::node<object_type>*>(iterator::m_links)->value;
+    }
+    /// \brief Gets a pointer to the object the iterator points to.
+    /// \return A pointer to the object.
+    object_type* operator->() const
+    {
+        return &static_cast<std::container::dynamic::forward_list::node<object_type>*>(iterator::m_links)->value;
+    }
+    /// \brief Gets the node links the iterator points to.
+    /// \return The node links the iterator points to.
+    std::container::dynamic::forward_list::links* links() const
+    {
+        return iterator::m_links;
+    }
+
+    // MODIFIERS
+    /// \brief Advances the iterator to the next object.
+    /// \return A reference to this iterator.
+    iterator& operator++()
+    {
+        iterator::m_links = iterator::m_links->next;
+        return *this;
+    }
+    /// \brief Advances the iterator to the next object.
+    /// \return A copy of the iterator before it was advanced.
+    iterator operator++(int)
+    {
+        iterator previous = *this;
+        iterator::m_links = iterator::m_links->next;
+        return previous;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator points to the same node as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are equal, otherwise FALSE.
+    bool operator==(const iterator& other) const
+    {
+        return iterator::m_links == other.m_links;
+    }
+    /// \brief Checks if this iterator points to a different node than another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are unequal, otherwise FALSE.
+    bool operator!=(const iterator& other) const
+    {
+        return iterator::m_links != other.m_links;
+    }
+
+private:
+    // DATA
+    /// \brief The node links the iterator points to.
+    std::container::dynamic::forward_list::links* m_links;
+};
+
+/// \brief A forward const iterator for traversing a std::forward_list.
+/// \tparam object_type The object type stored in the list.
+template <typename object_type>
+class const_iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::forward_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = object_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = const object_type*;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = const object_type&;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new const iterator instance.
+    /// \param[in] links The node links the iterator points to.
+    const_iterator(const std::container::dynamic::forward_list::links* links = nullptr)
+        : m_links(links)
+    {}
+    /// \brief Constructs a new const iterator instance from an iterator.
+    /// \param[in] other The iterator to convert.
+    const_iterator(const std::container::dynamic::forward_list::iterator<object_type>& other)
+        : m_links(other.links())
+    {}
+
+    // ACCESS
+    /// \brief Gets a const reference to the object the iterator points to.
+    /// \return A const reference to the object.
+    const object_type& operator*() const
+    {
+        return static_cast<const std::container::dynamic::forward_list::node<object_type>*>(const_iterator::m_links)->value;
+    }
+    /// \brief Gets a const pointer to the object the iterator points to.
+    /// \return A const pointer to the object.
+    const object_type* operator->() const
+    {
+        return &static_cast<const std::container::dynamic::forward_list::node<object_type>*>(const_iterator::m_links)->value;
+    }
+    /// \brief Gets the node links the iterator points to.
+    /// \return The node links the iterator points to.
+    const std::container::dynamic::forward_list::links* links() const
+    {
+        return const_iterator::m_links;
+    }
+
+    // MODIFIERS
+    /// \brief Advances the iterator to the next object.
+    /// \return A reference to this iterator.
+    const_iterator& operator++()
+    {
+        const_iterator::m_links = const_iterator::m_links->next;
+        return *this;
+    }
+    /// \brief Advances the iterator to the next object.
+    /// \return A copy of the iterator before it was advanced.
+    const_iterator operator++(int)
+    {
+        const_iterator previous = *this;
+        const_iterator::m_links = const_iterator::m_links->next;
+        return previous;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator points to the same node as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are equal, otherwise FALSE.
+    bool operator==(const const_iterator& other) const
+    {
+        return const_iterator::m_links == other.m_links;
+    }
+    /// \brief Checks if this iterator points to a different node than another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are unequal, otherwise FALSE.
+    bool operator!=(const const_iterator& other) const
+    {
+        return const_iterator::m_links != other.m_links;
+    }
+
+private:
+    // DATA
+    /// \brief The node links the iterator points to.
+    const std::container::dynamic::forward_list::links* m_links;
+};
+
+}}
+
+/// \brief A dynamic container that stores a singly-linked sequence of objects.
+/// \tparam object_type The object type stored by this container.
+/// \details Nodes are preallocated in a single slab at construction and recycled through a free list, so inserting and
+/// erasing run in constant time without allocation. Iterators remain valid until their node is erased.
+template <typename object_type>
+class forward_list
+{
+public:
+    // TYPES
+    /// \brief The iterator type of the list.
+    using iterator = std::container::dynamic::forward_list::iterator<object_type>;
+    /// \brief The const iterator type of the list.
+    using const_iterator = std::container::dynamic::forward_list::const_iterator<object_type>;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty forward list instance.
+    /// \param[in] capacity The maximum capacity of this list.
+    forward_list(std::size_t capacity)
+        : m_pool(capacity),
+          m_size(0)
+    {
+        forward_list::m_root.next = nullptr;
+    }
+    /// \brief Copy-constructs a new forward list from an existing forward list.
+    /// \param[in] other The other list to copy-construct from.
+    /// \note This performs a deep copy.
+    forward_list(const std::forward_list<object_type>& other)
+        : forward_list(other.capacity())
+    {
+        forward_list::append(other);
+    }
+    /// \brief Move-constructs a new forward list from an existing forward list.
+    /// \param[in] other The other list to move-construct from.
+    forward_list(std::forward_list<object_type>&& other)
+        : forward_list(other.capacity())
+    {
+        forward_list::swap(other);
+    }
+
+    // ACCESS
+    /// \brief Gets an iterator to the position before the first object, for use with insert_after and erase_after.
+    /// \return The before begin iterator.
+    iterator before_begin()
+    {
+        return iterator(&(forward_list::m_root));
+    }
+    /// \brief Gets a const_iterator to the position before the first object, for use with insert_after and erase_after.
+    /// \return The before begin const_iterator.
+    const_iterator cbefore_begin() const
+    {
+        return const_iterator(&(forward_list::m_root));
+    }
+    /// \brief Gets an iterator to the beginning of the list.
+    /// \return The begin iterator.
+    iterator begin()
+    {
+        return iterator(forward_list::m_root.next);
+    }
+    /// \brief Gets an iterator to the end of the list.
+    /// \return The end iterator.
+    iterator end()
+    {
+        return iterator(nullptr);
+    }
+    /// \brief Gets a const_iterator to the beginning of the list.
+    /// \return The begin const_iterator.
+    const_iterator cbegin() const
+    {
+        return const_iterator(forward_list::m_root.next);
+    }
+    /// \brief Gets a const_iterator to the end of the list.
+    /// \return The end const_iterator.
+    const_iterator cend() const
+    {
+        return const_iterator(nullptr);
+    }
+    /// \brief Gets a reference to the first object in the list.
+    /// \return A reference to the first object.
+    object_type& front()
+    {
+        return *iterator(forward_list::m_root.next);
+    }
+    /// \brief Gets a const reference to the first object in the list.
+    /// \return A const reference to the first object.
+    const object_type& front() const
+    {
+        return *const_iterator(forward_list::m_root.next);
+    }
+
+    // MODIFIERS
+    /// \brief Adds an object to the front of the list.
+    /// \param[in] value The object to copy into the list.
+    /// \return TRUE if the object was added, FALSE if the list is at capacity.
+    bool push_front(const object_type& value)
+    {
+        return forward_list::insert_after(forward_list::cbefore_begin(), value) != forward_list::end();
+    }
+    /// \brief Adds an object to the front of the list.
+    /// \param[in] value The object to move into the list.
+    /// \return TRUE if the object was added, FALSE if the list is at capacity.
+    bool push_front(object_type&& value)
+    {
+        return forward_list::insert_after(forward_list::cbefore_begin(), std::move(value)) != forward_list::end();
+    }
+    /// \brief Removes the first object from the list.
+    void pop_front()
+    {
+        if(forward_list::m_size)
+        {
+            forward_list::erase_after(forward_list::cbefore_begin());
+        }
+    }
+    /// \brief Inserts an object into the list after a specified position.
+    /// \param[in] position The position to insert the object after.
+    /// \param[in] value The object to copy into the list.
+    /// \return An iterator to the inserted object, or end() if the list is at capacity.
+    iterator insert_after(const_iterator position, const object_type& value)
+    {
+        // Take a node from the pool.
+        auto node = forward_list::m_pool.acquire();
+        if(!node)
+        {
+            return forward_list::end();
+        }
+
+        // Store the value and link the node.
+        node->value = value;
+        forward_list::link(const_cast<std::container::dynamic::forward_list::links*>(position.links()), node);
+        return iterator(node);
+    }
+    /// \brief Inserts an object into the list after a specified position.
+    /// \param[in] position The position to insert the object after.
+    /// \param[in] value The object to move into the list.
+    /// \return An iterator to the inserted object, or end() if the list is at capacity.
+    iterator insert_after(const_iterator position, object_type&& value)
+    {
+        // Take a node from the pool.
+        auto node = forward_list::m_pool.acquire();
+        if(!node)
+        {
+            return forward_list::end();
+        }
+
+        // Store the value and link the node.
+        node->value = std::move(value);
+        forward_list::link(const_cast<std::container::dynamic::forward_list::links*>(position.links()), node);
+        return iterator(node);
+    }
+    /// \brief Erases the object after a specified position.
+    /// \param[in] position The position before the object to erase.
+    /// \return An iterator to the object after the erased object.
+    iterator erase_after(const_iterator position)
+    {
+        // Unlink the node.
+        auto previous = const_cast<std::container::dynamic::forward_list::links*>(position.links());
+        auto links = previous->next;
+        previous->next = links->next;
+        --forward_list::m_size;
+
+        // Return the node to the pool.
+        forward_list::m_pool.release(static_cast<std::container::dynamic::forward_list::node<object_type>*>(links));
+        return iterator(previous->next);
+    }
+    /// \brief Erases the objects between two positions.
+    /// \param[in] begin The position before the first object to erase.
+    /// \param[in] end The position after the last object to erase.
+    /// \return An iterator to the object after the last erased object.
+    iterator erase_after(const_iterator begin, const_iterator end)
+    {
+        while(begin.links()->next != end.links())
+        {
+            forward_list::erase_after(begin);
+        }
+        return iterator(const_cast<std::container::dynamic::forward_list::links*>(end.links()));
+    }
+    /// \brief Clears all objects from the list.
+    void clear()
+    {
+        forward_list::erase_after(forward_list::cbefore_begin(), forward_list::cend());
+    }
+    /// \brief Swaps the contents of this list with another list.
+    /// \param[in] other The other list to swap with.
+    void swap(std::forward_list<object_type>& other)
+    {
+        forward_list::m_pool.swap(other.m_pool);
+        auto next = forward_list::m_root.next;
+        forward_list::m_root.next = other.m_root.next;
+        other.m_root.next = next;
+        std::size_t size = forward_list::m_size;
+        forward_list::m_size = other.m_size;
+        other.m_size = size;
+    }
+    /// \brief Copy-assigns the contents of another list to this list.
+    /// \param[in] other The other list to copy-assign from.
+    /// \return A reference to this list.
+    /// \note This performs a deep copy, reallocating this list to the other list's capacity if they differ.
+    std::forward_list<object_type>& operator=(const std::forward_list<object_type>& other)
+    {
+        // Check for self-assignment.
+        if(&other == this)
+        {
+            return *this;
+        }
+
+        // Clear, and replace the pool if the capacities differ.
+        forward_list::clear();
+        if(forward_list::m_pool.capacity() != other.capacity())
+        {
+            std::container::dynamic::pool<std::container::dynamic::forward_list::node<object_type>> pool(other.capacity());
+            forward_list::m_pool.swap(pool);
+        }
+
+        // Copy objects from other.
+        forward_list::append(other);
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another list to this list.
+    /// \param[in] other The other list to move-assign from.
+    /// \return A reference to this list.
+    std::forward_list<object_type>& operator=(std::forward_list<object_type>&& other)
+    {
+        // Take the other list's contents, leaving it this list's memory.
+        forward_list::swap(other);
+        other.clear();
+
+        return *this;
+    }
+
+    // CAPACITY
+    /// \brief Gets the size of the list.
+    /// \return The size of the list.
+    std::size_t size() const
+    {
+        return forward_list::m_size;
+    }
+    /// \brief Gets the maximum capacity of the list.
+    /// \return The capacity of the list.
+    std::size_t capacity() const
+    {
+        return forward_list::m_pool.capacity();
+    }
+    /// \brief Checks if the list is empty.
+    /// \return TRUE if the list is empty, otherwise FALSE.
+    bool empty() const
+    {
+        return forward_list::m_size == 0;
+    }
+    /// \brief Checks if the list is at capacity.
+    /// \return TRUE if the list is at capacity, otherwise FALSE.
+    bool full() const
+    {
+        return forward_list::m_size == forward_list::m_pool.capacity();
+    }
+
+    // COMPARISON
+    /// \brief Checks if this list is equal to another list.
+    /// \param[in] other The other list to compare with.
+    /// \return TRUE if the two lists are equal, otherwise FALSE.
+    bool operator==(const std::forward_list<object_type>& other) const
+    {
+        // Verify list sizes match.
+        if(forward_list::m_size != other.m_size)
+        {
+            return false;
+        }
+
+        // Compare values.
+        for(auto this_entry = forward_list::cbegin(), other_entry = other.cbegin(); this_entry != forward_list::cend(); ++this_entry, ++other_entry)
+        {
+            if(*this_entry != *other_entry)
+            {
+                return false;
+            }
+        }
+
+        // Indicate equal.
+        return true;
+    }
+    /// \brief Checks if this list is unequal with another list.
+    /// \param[in] other The other list to compare with.
+    /// \return TRUE if the two lists are unequal, otherwise FALSE.
+    bool operator!=(const std::forward_list<object_type>& other) const
+    {
+        return !forward_list::operator==(other);
+    }
+
+private:
+    // MEMORY
+    /// \brief Stores the list's preallocated nodes.
+    std::container::dynamic::pool<std::container::dynamic::forward_list::node<object_type>> m_pool;
+    /// \brief Stores the sentinel link to the first node.
+    std::container::dynamic::forward_list::links m_root;
+    /// \brief Stores the number of objects in the list.
+    std::size_t m_size;
+
+    // LINKS
+    /// \brief Links a node after another node.
+    /// \param[in] previous The node to link after.
+    /// \param[in] links The node to link.
+    void link(std::container::dynamic::forward_list::links* previous, std::container::dynamic::forward_list::links* links)
+    {
+        links->next = previous->next;
+        previous->next = links;
+        ++forward_list::m_size;
+    }
+    /// \brief Appends copies of the objects in another list, preserving their order.
+    /// \param[in] other The other list to copy from.
+    void append(const std::forward_list<object_type>& other)
+    {
+        // Find the last node.
+        const_iterator last = forward_list::cbefore_begin();
+        while(last.links()->next)
+        {
+            ++last;
+        }
+
+        // Insert each object after the last.
+        for(auto entry = other.cbegin(); entry != other.cend(); ++entry)
+        {
+            last = forward_list::insert_after(last, *entry);
+        }
+    }
+};
+
+}
+
+#endif
\ No newline at end of file
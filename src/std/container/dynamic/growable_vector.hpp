@@ -0,0 +1,274 @@
+/// \file std/container/dynamic/growable_vector.hpp
+/// \brief Defines the std::growable_vector template class.
+#ifndef STD___CONTAINER___DYNAMIC___GROWABLE_VECTOR_H
+#define STD___CONTAINER___DYNAMIC___GROWABLE_VECTOR_H
+
+// std
+#include <std/container/dynamic/vector.hpp>
+#include <std/utility/forward.hpp>
+
+namespace std {
+
+/// \brief A vector that reallocates geometrically as it grows, up to a maximum capacity.
+/// \tparam object_type The object type stored by this container.
+/// \details When an insertion exceeds the current capacity, the objects are moved into a new allocation 1.5 times
+/// larger (or as large as the insertion requires), clamped to the maximum capacity. This gives amortized constant
+/// time push_back without allocating the maximum capacity up front.
+/// \note Reallocation invalidates all iterators and references into the vector.
+/// \note The growing modifiers hide rather than override those of std::vector, so a growable_vector accessed through
+/// a std::vector reference will not grow.
+template <typename object_type>
+class growable_vector
+    : public std::vector<object_type>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty growable vector instance.
+    /// \param[in] capacity The initial capacity of this vector.
+    /// \param[in] max_capacity The capacity this vector may grow to.
+    growable_vector(std::size_t capacity, std::size_t max_capacity)
+        : std::vector<object_type>(capacity < max_capacity ? capacity : max_capacity),
+          m_max_capacity(max_capacity)
+    {}
+    /// \brief Copy-constructs a new growable vector from an existing growable vector.
+    /// \param[in] other The other growable vector to copy-construct from.
+    /// \note This performs a deep copy at the other vector's current capacity.
+    growable_vector(const std::growable_vector<object_type>& other)
+        : std::vector<object_type>(other),
+          m_max_capacity(other.m_max_capacity)
+    {}
+    /// \brief Move-constructs a new growable vector from an existing growable vector.
+    /// \param[in] other The other growable vector to move-construct from.
+    growable_vector(std::growable_vector<object_type>&& other)
+        : std::vector<object_type>(std::forward<std::growable_vector<object_type>>(other)),
+          m_max_capacity(other.m_max_capacity)
+    {}
+
+    // MODIFIERS
+    /// \brief Appends a new object to the end of this vector, growing if needed.
+    /// \param[in] value The value to append.
+    /// \return TRUE if the operation succeeded, FALSE if this vector is at its maximum capacity.
+    bool push_back(const object_type& value)
+    {
+        return growable_vector::grow(growable_vector::size() + 1) && std::vector<object_type>::push_back(value);
+    }
+    /// \brief Appends a new object to the end of this vector, growing if needed, or reports why it could not.
+    /// \param[in] value The value to append.
+    /// \return An iterator to the appended object, or std::errc::no_buffer_space if this vector is at its maximum
+    /// capacity.
+    std::expected<std::iterator<object_type>,std::errc> try_push_back(const object_type& value)
+    {
+        if(!growable_vector::push_back(value))
+        {
+            return std::make_unexpected(std::errc::no_buffer_space);
+        }
+        return growable_vector::m_end - 1;
+    }
+    /// \brief Inserts an object into this vector at a specified position, growing if needed.
+    /// \param[in] position The position to insert the object at.
+    /// \param[in] value The object to insert.
+    /// \return An iterator to the inserted object. NULLPTR if vector is at its maximum capacity.
+    std::iterator<object_type> insert(std::iterator<object_type> position, const object_type& value)
+    {
+        // Grow if needed, and rebase the position onto the new storage.
+        std::size_t index = position - growable_vector::m_begin;
+        if(!growable_vector::grow(growable_vector::size() + 1))
+        {
+            return nullptr;
+        }
+        return std::vector<object_type>::insert(growable_vector::m_begin + index, value);
+    }
+    /// \brief Inserts copies of a value into this vector at a specified position.
+    /// \param[in] position The position to insert the values at.
+    /// \param[in] count The number of copies to insert.
+    /// \param[in] value The value to insert.
+    /// \return An iterator to the first inserted object. NULLPTR if vector does not have enough maximum capacity.
+    std::iterator<object_type> insert(std::iterator<object_type> position, std::size_t count, const object_type& value)
+    {
+        // Grow if needed, and rebase the position onto the new storage.
+        std::size_t index = position - growable_vector::m_begin;
+        if(!growable_vector::grow(growable_vector::size() + count))
+        {
+            return nullptr;
+        }
+        return std::vector<object_type>::insert(growable_vector::m_begin + index, count, value);
+    }
+    /// \brief Inserts a range of values into this vector at a specified position.
+    /// \param[in] position The position to insert the values at.
+    /// \param[in] begin An iterator to the beginning of the range to copy.
+    /// \param[in] end An iterator to the end of the range to copy.
+    /// \return An iterator to the first inserted object. NULLPTR if vector does not have enough maximum capacity.
+    /// \note The range must not be part of this vector.
+    std::iterator<object_type> insert(std::iterator<object_type> position, std::const_iterator<object_type> begin, std::const_iterator<object_type> end)
+    {
+        // Grow if needed, and rebase the position onto the new storage.
+        std::size_t index = position - growable_vector::m_begin;
+        if(!growable_vector::grow(growable_vector::size() + (end - begin)))
+        {
+            return nullptr;
+        }
+        return std::vector<object_type>::insert(growable_vector::m_begin + index, begin, end);
+    }
+    /// \brief Appends a range of values to the end of this vector.
+    /// \param[in] begin An iterator to the beginning of the range to copy.
+    /// \param[in] end An iterator to the end of the range to copy.
+    /// \return TRUE if the operation succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool append(std::const_iterator<object_type> begin, std::const_iterator<object_type> end)
+    {
+        return growable_vector::grow(growable_vector::size() + (end - begin)) && std::vector<object_type>::append(begin, end);
+    }
+    /// \brief Assigns a size and value to this vector, growing if needed.
+    /// \param[in] value The value to set all elements to.
+    /// \param[in] count The size to set this vector to.
+    /// \return TRUE if the assignment succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool assign(const object_type& value, std::size_t count)
+    {
+        return growable_vector::reserve(count) && std::vector<object_type>::assign(value, count);
+    }
+    /// \brief Assigns a range of values to this vector, growing if needed.
+    /// \param[in] begin An iterator to the beginning of the range to copy.
+    /// \param[in] end An iterator to the end of the range to copy.
+    /// \return TRUE if the assignment succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool assign(std::const_iterator<object_type> begin, std::const_iterator<object_type> end)
+    {
+        return growable_vector::reserve(end - begin) && std::vector<object_type>::assign(begin, end);
+    }
+    /// \brief Resizes this vector to a specified size, default-constructing additional elements if needed.
+    /// \param[in] size The size to set this vector to.
+    /// \return TRUE if the resize succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool resize(std::size_t size)
+    {
+        return growable_vector::resize(size, object_type());
+    }
+    /// \brief Resizes this vector to a specified size, using a provided value for additional elements if needed.
+    /// \param[in] size The size to set this vector to.
+    /// \param[in] value The value to assign to additional elements.
+    /// \return TRUE if the resize succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool resize(std::size_t size, const object_type& value)
+    {
+        return growable_vector::grow(size) && std::vector<object_type>::resize(size, value);
+    }
+    /// \brief Swaps the contents of this vector with another vector.
+    /// \param[in] other The other vector to swap with.
+    void swap(std::growable_vector<object_type>& other)
+    {
+        // Use base container's swap method, then swap maximum capacities.
+        std::container::dynamic::base<object_type>::swap(other);
+        std::size_t temp_max_capacity = growable_vector::m_max_capacity;
+        growable_vector::m_max_capacity = other.m_max_capacity;
+        other.m_max_capacity = temp_max_capacity;
+    }
+    /// \brief Copy-assigns the contents of another growable vector to this growable vector.
+    /// \param[in] other The other growable vector to copy-assign from.
+    /// \return A reference to this vector.
+    std::growable_vector<object_type>& operator=(const std::growable_vector<object_type>& other)
+    {
+        // Check for self-assignment.
+        if(&other == this)
+        {
+            return *this;
+        }
+
+        // Use base container's operator= method.
+        std::container::dynamic::base<object_type>::operator=(other);
+        growable_vector::m_max_capacity = other.m_max_capacity;
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another growable vector to this growable vector.
+    /// \param[in] other The other growable vector to move-assign from.
+    /// \return A reference to this vector.
+    std::growable_vector<object_type>& operator=(std::growable_vector<object_type>&& other)
+    {
+        // Use base container's operator= method.
+        std::container::dynamic::base<object_type>::operator=(std::forward<std::growable_vector<object_type>>(other));
+        growable_vector::m_max_capacity = other.m_max_capacity;
+
+        return *this;
+    }
+
+    // CAPACITY
+    /// \brief Reallocates this vector to hold at least a specified number of objects.
+    /// \param[in] capacity The number of objects to make room for.
+    /// \return TRUE if this vector can hold the objects, FALSE if it exceeds the maximum capacity.
+    /// \note Unlike automatic growth, this allocates exactly the requested capacity.
+    bool reserve(std::size_t capacity)
+    {
+        // Check if the current allocation suffices.
+        if(capacity <= growable_vector::capacity())
+        {
+            return true;
+        }
+
+        // Verify the maximum capacity suffices.
+        if(capacity > growable_vector::m_max_capacity)
+        {
+            return false;
+        }
+
+        // Move into the larger allocation and release the previous one.
+        delete [] growable_vector::relocate(capacity);
+        return true;
+    }
+    /// \brief Reallocates this vector to release capacity beyond its current size.
+    void shrink_to_fit()
+    {
+        if(growable_vector::size() < growable_vector::capacity())
+        {
+            delete [] growable_vector::relocate(growable_vector::size());
+        }
+    }
+    /// \brief Checks if this vector is at its maximum capacity.
+    /// \return TRUE if this vector is at its maximum capacity, otherwise FALSE.
+    bool full() const
+    {
+        return growable_vector::size() == growable_vector::m_max_capacity;
+    }
+    /// \brief Gets the maximum capacity this vector may grow to.
+    /// \return The maximum capacity of this vector.
+    std::size_t max_capacity() const
+    {
+        return growable_vector::m_max_capacity;
+    }
+
+private:
+    // DATA
+    /// \brief The maximum capacity this vector may grow to.
+    std::size_t m_max_capacity;
+
+    /// \brief Grows this vector geometrically to hold at least a specified number of objects.
+    /// \param[in] size The number of objects to make room for.
+    /// \return TRUE if this vector can hold the objects, FALSE if it exceeds the maximum capacity.
+    bool grow(std::size_t size)
+    {
+        // Check if the current allocation suffices.
+        std::size_t capacity = growable_vector::capacity();
+        if(size <= capacity)
+        {
+            return true;
+        }
+
+        // Verify the maximum capacity suffices.
+        if(size > growable_vector::m_max_capacity)
+        {
+            return false;
+        }
+
+        // Grow by 1.5x, or to the requested size if larger, clamped to the maximum capacity.
+        capacity += capacity / 2;
+        if(capacity < size)
+        {
+            capacity = size;
+        }
+        if(capacity > growable_vector::m_max_capacity)
+        {
+            capacity = growable_vector::m_max_capacity;
+        }
+
+        return growable_vector::reserve(capacity);
+    }
+};
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,387 @@
+/// \file std/container/dynamic/indexed_priority_queue.hpp
+/// \brief Defines the std::indexed_priority_queue template class.
+#ifndef STD___CONTAINER___DYNAMIC___INDEXED_PRIORITY_QUEUE_H
+#define STD___CONTAINER___DYNAMIC___INDEXED_PRIORITY_QUEUE_H
+
+// std
+#include <std/functional/comparison.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/move.hpp>
+
+namespace std {
+
+/// \brief A dynamic priority queue whose objects can be updated or removed through handles.
+/// \tparam object_type The object type stored by this container.
+/// \tparam compare_type The comparison function object type. The top object is the one for which compare returns
+/// FALSE against all others, so std::less orders the largest object first and std::greater orders the smallest first.
+/// \details Objects are stored in fixed slots, and a binary heap of slot indices orders them. A handle is the slot of
+/// an object, and remains valid until the object is popped or erased. The heap array doubles as the free list: slots
+/// at heap positions [size, capacity) are unused. push, pop, erase, update, and decrease_key all run in O(log n).
+template <typename object_type, typename compare_type = std::less<object_type>>
+class indexed_priority_queue
+{
+public:
+    // TYPES
+    /// \brief A handle to an object in the priority queue.
+    using handle_type = std::size_t;
+
+    // CONSTANTS
+    /// \brief Indicates an invalid handle.
+    static constexpr handle_type npos = static_cast<handle_type>(-1);
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty indexed priority queue instance.
+    /// \param[in] capacity The maximum capacity of this priority queue.
+    /// \param[in] compare The comparison function object.
+    indexed_priority_queue(std::size_t capacity, const compare_type& compare = compare_type())
+        : m_size(0),
+          m_capacity(capacity),
+          m_compare(compare)
+    {
+        indexed_priority_queue::allocate();
+    }
+    /// \brief Copy-constructs a new indexed priority queue from an existing indexed priority queue.
+    /// \param[in] other The other priority queue to copy-construct from.
+    /// \note This performs a deep copy, and handles from the other priority queue are valid for this one.
+    indexed_priority_queue(const std::indexed_priority_queue<object_type,compare_type>& other)
+        : m_size(other.m_size),
+          m_capacity(other.m_capacity),
+          m_compare(other.m_compare)
+    {
+        indexed_priority_queue::allocate();
+        indexed_priority_queue::copy(other);
+    }
+    /// \brief Move-constructs a new indexed priority queue from an existing indexed priority queue.
+    /// \param[in] other The other priority queue to move-construct from.
+    indexed_priority_queue(std::indexed_priority_queue<object_type,compare_type>&& other)
+        : m_values(other.m_values),
+          m_heap(other.m_heap),
+          m_positions(other.m_positions),
+          m_size(other.m_size),
+          m_capacity(other.m_capacity),
+          m_compare(other.m_compare)
+    {
+        // Reset the other priority queue to a new allocation.
+        other.allocate();
+        other.m_size = 0;
+    }
+    ~indexed_priority_queue()
+    {
+        // Clean up allocated memory.
+        indexed_priority_queue::deallocate();
+    }
+
+    // ACCESS
+    /// \brief Gets a const reference to the highest priority object.
+    /// \return A const reference to the highest priority object.
+    const object_type& top() const
+    {
+        return indexed_priority_queue::m_values[indexed_priority_queue::m_heap[0]];
+    }
+    /// \brief Gets the handle of the highest priority object.
+    /// \return The handle of the highest priority object, or npos if the priority queue is empty.
+    handle_type top_handle() const
+    {
+        return indexed_priority_queue::m_size ? indexed_priority_queue::m_heap[0] : npos;
+    }
+    /// \brief Gets a const reference to the object referenced by a handle.
+    /// \param[in] handle The handle of the object.
+    /// \return A const reference to the object.
+    /// \note Objects are read-only through handles; use update or decrease_key to change an object's priority.
+    const object_type& operator[](handle_type handle) const
+    {
+        return indexed_priority_queue::m_values[handle];
+    }
+    /// \brief Checks if a handle references an object in the priority queue.
+    /// \param[in] handle The handle to check.
+    /// \return TRUE if the handle references an object, otherwise FALSE.
+    bool contains(handle_type handle) const
+    {
+        return handle < indexed_priority_queue::m_capacity && indexed_priority_queue::m_positions[handle] < indexed_priority_queue::m_size;
+    }
+
+    // MODIFIERS
+    /// \brief Adds an object to the priority queue.
+    /// \param[in] value The object to copy into the priority queue.
+    /// \return The handle of the added object, or npos if the priority queue is at capacity.
+    handle_type push(const object_type& value)
+    {
+        // Verify capacity.
+        if(indexed_priority_queue::m_size == indexed_priority_queue::m_capacity)
+        {
+            return npos;
+        }
+
+        // Take the first free slot, which sits just past the end of the heap.
+        handle_type slot = indexed_priority_queue::m_heap[indexed_priority_queue::m_size];
+        indexed_priority_queue::m_values[slot] = value;
+
+        // Sift the slot into place.
+        indexed_priority_queue::sift_up(indexed_priority_queue::m_size++);
+
+        return slot;
+    }
+    /// \brief Removes the highest priority object from the priority queue.
+    void pop()
+    {
+        // Verify the priority queue isn't empty.
+        if(indexed_priority_queue::m_size == 0)
+        {
+            return;
+        }
+
+        indexed_priority_queue::erase(indexed_priority_queue::m_heap[0]);
+    }
+    /// \brief Removes an object from the priority queue.
+    /// \param[in] handle The handle of the object to remove.
+    /// \return TRUE if the object was removed, FALSE if the handle is invalid.
+    bool erase(handle_type handle)
+    {
+        // Verify the handle.
+        if(!indexed_priority_queue::contains(handle))
+        {
+            return false;
+        }
+
+        // Exchange the slot with the last slot in the heap, moving it to the free region.
+        std::size_t position = indexed_priority_queue::m_positions[handle];
+        handle_type last = indexed_priority_queue::m_heap[--indexed_priority_queue::m_size];
+        indexed_priority_queue::place(indexed_priority_queue::m_size, handle);
+        indexed_priority_queue::place(position, last);
+
+        // Restore the heap around the moved slot.
+        if(position < indexed_priority_queue::m_size)
+        {
+            indexed_priority_queue::sift_up(position);
+            indexed_priority_queue::sift_down(indexed_priority_queue::m_positions[last]);
+        }
+
+        return true;
+    }
+    /// \brief Changes the value of an object in the priority queue.
+    /// \param[in] handle The handle of the object to change.
+    /// \param[in] value The new value of the object.
+    /// \return TRUE if the object was changed, FALSE if the handle is invalid.
+    bool update(handle_type handle, const object_type& value)
+    {
+        // Verify the handle.
+        if(!indexed_priority_queue::contains(handle))
+        {
+            return false;
+        }
+
+        // Assign the value and restore the heap in whichever direction is needed.
+        indexed_priority_queue::m_values[handle] = value;
+        indexed_priority_queue::sift_up(indexed_priority_queue::m_positions[handle]);
+        indexed_priority_queue::sift_down(indexed_priority_queue::m_positions[handle]);
+
+        return true;
+    }
+    /// \brief Changes the value of an object in the priority queue to one of higher or equal priority.
+    /// \param[in] handle The handle of the object to change.
+    /// \param[in] value The new value of the object, which must not be ordered after its current value.
+    /// \return TRUE if the object was changed, FALSE if the handle is invalid.
+    /// \details With std::greater as the comparison, this is the classic decrease-key operation. Only a sift up is
+    /// performed, so it is cheaper than update.
+    bool decrease_key(handle_type handle, const object_type& value)
+    {
+        // Verify the handle.
+        if(!indexed_priority_queue::contains(handle))
+        {
+            return false;
+        }
+
+        // Assign the value and sift toward the top.
+        indexed_priority_queue::m_values[handle] = value;
+        indexed_priority_queue::sift_up(indexed_priority_queue::m_positions[handle]);
+
+        return true;
+    }
+    /// \brief Clears all objects from the priority queue.
+    /// \note All handles are invalidated.
+    void clear()
+    {
+        indexed_priority_queue::m_size = 0;
+    }
+    /// \brief Copy-assigns the contents of another indexed priority queue to this priority queue.
+    /// \param[in] other The other priority queue to copy-assign from.
+    /// \return A reference to this priority queue.
+    /// \note This performs a deep copy, and handles from the other priority queue are valid for this one.
+    std::indexed_priority_queue<object_type,compare_type>& operator=(const std::indexed_priority_queue<object_type,compare_type>& other)
+    {
+        // Check for self-assignment.
+        if(&other == this)
+        {
+            return *this;
+        }
+
+        // Create new memory based on the other priority queue's capacity.
+        indexed_priority_queue::deallocate();
+        indexed_priority_queue::m_capacity = other.m_capacity;
+        indexed_priority_queue::allocate();
+
+        // Copy the other priority queue.
+        indexed_priority_queue::m_size = other.m_size;
+        indexed_priority_queue::m_compare = other.m_compare;
+        indexed_priority_queue::copy(other);
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another indexed priority queue to this priority queue.
+    /// \param[in] other The other priority queue to move-assign from.
+    /// \return A reference to this priority queue.
+    std::indexed_priority_queue<object_type,compare_type>& operator=(std::indexed_priority_queue<object_type,compare_type>&& other)
+    {
+        // Free this priority queue's memory.
+        indexed_priority_queue::deallocate();
+
+        // Take the other priority queue's memory.
+        indexed_priority_queue::m_values = other.m_values;
+        indexed_priority_queue::m_heap = other.m_heap;
+        indexed_priority_queue::m_positions = other.m_positions;
+        indexed_priority_queue::m_size = other.m_size;
+        indexed_priority_queue::m_capacity = other.m_capacity;
+        indexed_priority_queue::m_compare = other.m_compare;
+
+        // Reset the other priority queue to a new allocation.
+        other.allocate();
+        other.m_size = 0;
+
+        return *this;
+    }
+
+    // CAPACITY
+    /// \brief Gets the number of objects in the priority queue.
+    /// \return The number of objects in the priority queue.
+    std::size_t size() const
+    {
+        return indexed_priority_queue::m_size;
+    }
+    /// \brief Gets the maximum capacity of the priority queue.
+    /// \return The capacity of the priority queue.
+    std::size_t capacity() const
+    {
+        return indexed_priority_queue::m_capacity;
+    }
+    /// \brief Checks if the priority queue is empty.
+    /// \return TRUE if the priority queue is empty, otherwise FALSE.
+    bool empty() const
+    {
+        return indexed_priority_queue::m_size == 0;
+    }
+    /// \brief Checks if the priority queue is at capacity.
+    /// \return TRUE if the priority queue is at capacity, otherwise FALSE.
+    bool full() const
+    {
+        return indexed_priority_queue::m_size == indexed_priority_queue::m_capacity;
+    }
+
+private:
+    // MEMORY
+    /// \brief Stores the objects, indexed by handle.
+    object_type* m_values;
+    /// \brief Stores the handles in heap order, followed by the free handles.
+    handle_type* m_heap;
+    /// \brief Stores the heap position of each handle.
+    std::size_t* m_positions;
+    /// \brief Stores the number of objects in the priority queue.
+    std::size_t m_size;
+    /// \brief Stores the maximum capacity of the priority queue.
+    std::size_t m_capacity;
+    /// \brief The comparison function object.
+    compare_type m_compare;
+
+    /// \brief Allocates memory for the current capacity, with all slots free.
+    void allocate()
+    {
+        indexed_priority_queue::m_values = new object_type[indexed_priority_queue::m_capacity];
+        indexed_priority_queue::m_heap = new handle_type[indexed_priority_queue::m_capacity];
+        indexed_priority_queue::m_positions = new std::size_t[indexed_priority_queue::m_capacity];
+        for(std::size_t i = 0; i < indexed_priority_queue::m_capacity; ++i)
+        {
+            indexed_priority_queue::m_heap[i] = i;
+            indexed_priority_queue::m_positions[i] = i;
+        }
+    }
+    /// \brief Frees allocated memory.
+    void deallocate()
+    {
+        delete [] indexed_priority_queue::m_values;
+        delete [] indexed_priority_queue::m_heap;
+        delete [] indexed_priority_queue::m_positions;
+    }
+    /// \brief Copies the slots and heap of another priority queue with the same capacity.
+    /// \param[in] other The other priority queue to copy from.
+    void copy(const std::indexed_priority_queue<object_type,compare_type>& other)
+    {
+        for(std::size_t i = 0; i < indexed_priority_queue::m_capacity; ++i)
+        {
+            indexed_priority_queue::m_values[i] = other.m_values[i];
+            indexed_priority_queue::m_heap[i] = other.m_heap[i];
+            indexed_priority_queue::m_positions[i] = other.m_positions[i];
+        }
+    }
+
+    // HEAP
+    /// \brief Places a handle at a heap position.
+    /// \param[in] position The heap position.
+    /// \param[in] handle The handle to place.
+    void place(std::size_t position, handle_type handle)
+    {
+        indexed_priority_queue::m_heap[position] = handle;
+        indexed_priority_queue::m_positions[handle] = position;
+    }
+    /// \brief Moves the handle at a heap position up until the heap property is restored.
+    /// \param[in] position The heap position of the handle.
+    void sift_up(std::size_t position)
+    {
+        handle_type slot = indexed_priority_queue::m_heap[position];
+        while(position > 0)
+        {
+            // Stop once the parent is not ordered before the slot.
+            std::size_t parent = (position - 1) / 2;
+            if(!indexed_priority_queue::m_compare(indexed_priority_queue::m_values[indexed_priority_queue::m_heap[parent]], indexed_priority_queue::m_values[slot]))
+            {
+                break;
+            }
+
+            // Move the parent down.
+            indexed_priority_queue::place(position, indexed_priority_queue::m_heap[parent]);
+            position = parent;
+        }
+        indexed_priority_queue::place(position, slot);
+    }
+    /// \brief Moves the handle at a heap position down until the heap property is restored.
+    /// \param[in] position The heap position of the handle.
+    void sift_down(std::size_t position)
+    {
+        handle_type slot = indexed_priority_queue::m_heap[position];
+        for(std::size_t child = 2 * position + 1; child < indexed_priority_queue::m_size; child = 2 * position + 1)
+        {
+            // Select the child ordered first.
+            if(child + 1 < indexed_priority_queue::m_size && indexed_priority_queue::m_compare(indexed_priority_queue::m_values[indexed_priority_queue::m_heap[child]], indexed_priority_queue::m_values[indexed_priority_queue::m_heap[child + 1]]))
+            {
+                ++child;
+            }
+
+            // Stop once the slot is not ordered after the child.
+            if(!indexed_priority_queue::m_compare(indexed_priority_queue::m_values[slot], indexed_priority_queue::m_values[indexed_priority_queue::m_heap[child]]))
+            {
+                break;
+            }
+
+            // Move the child up.
+            indexed_priority_queue::place(position, indexed_priority_queue::m_heap[child]);
+            position = child;
+        }
+        indexed_priority_queue::place(position, slot);
+    }
+};
+
+/// \brief Indicates an invalid handle.
+template <typename object_type, typename compare_type>
+constexpr typename indexed_priority_queue<object_type,compare_type>::handle_type indexed_priority_queue<object_type,compare_type>::npos;
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,636 @@
+/// \file std/container/dynamic/list.hpp
+/// \brief Defines the std::list template class.
+#ifndef STD___CONTAINER___DYNAMIC___LIST_H
+#define STD___CONTAINER___DYNAMIC___LIST_H
+
+// std
+#include <std/container/dynamic/pool.hpp>
+#include <std/container/iterator.hpp>
+#include <std/utility/move.hpp>
+
+namespace std {
+
+namespace container::dynamic {
+
+/// \brief Contains all code for std::list components.
+namespace list {
+
+/// \brief The links of a doubly-linked list node.
+struct links
+{
+    /// \brief The previous node in the list.
+    std::container::dynamic::list::links* previous;
+    /// \brief The next node in the list, or the next free node while in a pool.
+    std::container::dynamic::list::links* next;
+};
+
+/// \brief A doubly-linked list node.
+/// \tparam object_type The object type stored in the node.
+template <typename object_type>
+struct node
+    : public std::container::dynamic::list::links
+{
+    /// \brief The object stored in the node.
+    object_type value;
+};
+
+/// \brief A bidirectional iterator for traversing a std::list.
+/// \tparam object_type The object type stored in the list.
+template <typename object_type>
+class iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::bidirectional_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = object_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = object_type*;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = object_type&;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new iterator instance.
+    /// \param[in] links The node links the iterator points to.
+    iterator(std::container::dynamic::list::links* links = nullptr)
+        : m_links(links)
+    {}
+
+    // ACCESS
+    /// \brief Gets a reference to the object the iterator points to.
+    /// \return A reference to the object.
+    object_type& operator*() const
+    {
+        return static_cast<std::container::dynamic::list::node<object_type>*>(iterator::m_links)->value;
+    }
+    /// \brief Gets a pointer to the object the iterator points to.
+    /// \return A pointer to the object.
+    object_type* operator->() const
+    {
+        return &static_cast<std::container::dynamic::list::node<object_type>*>(iterator::m_links)->value;
+    }
+    /// \brief Gets the node links the iterator points to.
+    /// \return The node links the iterator points to.
+    std::container::dynamic::list::links* links() const
+    {
+        return iterator::m_links;
+    }
+
+    // MODIFIERS
+    /// \brief Advances the iterator to the next object.
+    /// \return A reference to this iterator.
+    iterator& operator++()
+    {
+        iterator::m_links = iterator::m_links->next;
+        return *this;
+    }
+    /// \brief Advances the iterator to the next object.
+    /// \return A copy of the iterator before it was advanced.
+    iterator operator++(int)
+    {
+        iterator previous = *this;
+        iterator::m_links = iterator::m_links->next;
+        return previous;
+    }
+    /// \brief Moves the iterator to the previous object.
+    /// \return A reference to this iterator.
+    iterator& operator--()
+    {
+        iterator::m_links = iterator::m_links->previous;
+        return *this;
+    }
+    /// \brief Moves the iterator to the previous object.
+    /// \return A copy of the iterator before it was moved.
+    iterator operator--(int)
+    {
+        iterator next = *this;
+        iterator::m_links = iterator::m_links->previous;
+        return next;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator points to the same node as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are equal, otherwise FALSE.
+    bool operator==(const iterator& other) const
+    {
+        return iterator::m_links == other.m_links;
+    }
+    /// \brief Checks if this iterator points to a different node than another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are unequal, otherwise FALSE.
+    bool operator!=(const iterator& other) const
+    {
+        return iterator::m_links != other.m_links;
+    }
+
+private:
+    // DATA
+    /// \brief The node links the iterator points to.
+    std::container::dynamic::list::links* m_links;
+};
+
+/// \brief A bidirectional const iterator for traversing a std::list.
+/// \tparam object_type The object type stored in the list.
+template <typename object_type>
+class const_iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::bidirectional_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = object_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = const object_type*;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = const object_type&;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new const iterator instance.
+    /// \param[in] links The node links the iterator points to.
+    const_iterator(const std::container::dynamic::list::links* links = nullptr)
+        : m_links(links)
+    {}
+    /// \brief Constructs a new const iterator instance from an iterator.
+    /// \param[in] other The iterator to convert.
+    const_iterator(const std::container::dynamic::list::iterator<object_type>& other)
+        : m_links(other.links())
+    {}
+
+    // ACCESS
+    /// \brief Gets a const reference to the object the iterator points to.
+    /// \return A const reference to the object.
+    const object_type& operator*() const
+    {
+        return static_cast<const std::container::dynamic::list::node<object_type>*>(const_iterator::m_links)->value;
+    }
+    /// \brief Gets a const pointer to the object the iterator points to.
+    /// \return A const pointer to the object.
+    const object_type* operator->() const
+    {
+        return &static_cast<const std::container::dynamic::list::node<object_type>*>(const_iterator::m_links)->value;
+    }
+    /// \brief Gets the node links the iterator points to.
+    /// \return The node links the iterator points to.
+    const std::container::dynamic::list::links* links() const
+    {
+        return const_iterator::m_links;
+    }
+
+    // MODIFIERS
+    /// \brief Advances the iterator to the next object.
+    /// \return A reference to this iterator.
+    const_iterator& operator++()
+    {
+        const_iterator::m_links = const_iterator::m_links->next;
+        return *this;
+    }
+    /// \brief Advances the iterator to the next object.
+    /// \return A copy of the iterator before it was advanced.
+    const_iterator operator++(int)
+    {
+        const_iterator previous = *this;
+        const_iterator::m_links = const_iterator::m_links->next;
+        return previous;
+    }
+    /// \brief Moves the iterator to the previous object.
+    /// \return A reference to this iterator.
+    const_iterator& operator--()
+    {
+        const_iterator::m_links = const_iterator::m_links->previous;
+        return *this;
+    }
+    /// \brief Moves the iterator to the previous object.
+    /// \return A copy of the iterator before it was moved.
+    const_iterator operator--(int)
+    {
+        const_iterator next = *this;
+        const_iterator::m_links = const_iterator::m_links->previous;
+        return next;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator points to the same node as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are equal, otherwise FALSE.
+    bool operator==(const const_iterator& other) const
+    {
+        return const_iterator::m_links == other.m_links;
+    }
+    /// \brief Checks if this iterator points to a different node than another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are unequal, otherwise FALSE.
+    bool operator!=(const const_iterator& other) const
+    {
+        return const_iterator::m_links != other.m_links;
+    }
+
+private:
+    // DATA
+    /// \brief The node links the iterator points to.
+    const std::container::dynamic::list::links* m_links;
+};
+
+}}
+
+/// \brief A dynamic container that stores a doubly-linked sequence of objects.
+/// \tparam object_type The object type stored by this container.
+/// \details Nodes are preallocated in a single slab at construction and recycled through a free list, so inserting and
+/// erasing run in constant time without allocation. Iterators remain valid until their node is erased.
+template <typename object_type>
+class list
+{
+public:
+    // TYPES
+    /// \brief The iterator type of the list.
+    using iterator = std::container::dynamic::list::iterator<object_type>;
+    /// \brief The const iterator type of the list.
+    using const_iterator = std::container::dynamic::list::const_iterator<object_type>;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty list instance.
+    /// \param[in] capacity The maximum capacity of this list.
+    list(std::size_t capacity)
+        : m_pool(capacity),
+          m_size(0)
+    {
+        list::reset(list::m_root);
+    }
+    /// \brief Copy-constructs a new list from an existing list.
+    /// \param[in] other The other list to copy-construct from.
+    /// \note This performs a deep copy.
+    list(const std::list<object_type>& other)
+        : list(other.capacity())
+    {
+        list::append(other);
+    }
+    /// \brief Move-constructs a new list from an existing list.
+    /// \param[in] other The other list to move-construct from.
+    list(std::list<object_type>&& other)
+        : list(other.capacity())
+    {
+        list::swap(other);
+    }
+
+    // ACCESS
+    /// \brief Gets an iterator to the beginning of the list.
+    /// \return The begin iterator.
+    iterator begin()
+    {
+        return iterator(list::m_root.next);
+    }
+    /// \brief Gets an iterator to the end of the list.
+    /// \return The end iterator.
+    iterator end()
+    {
+        return iterator(&(list::m_root));
+    }
+    /// \brief Gets a const_iterator to the beginning of the list.
+    /// \return The begin const_iterator.
+    const_iterator cbegin() const
+    {
+        return const_iterator(list::m_root.next);
+    }
+    /// \brief Gets a const_iterator to the end of the list.
+    /// \return The end const_iterator.
+    const_iterator cend() const
+    {
+        return const_iterator(&(list::m_root));
+    }
+    /// \brief Gets a reference to the first object in the list.
+    /// \return A reference to the first object.
+    object_type& front()
+    {
+        return *iterator(list::m_root.next);
+    }
+    /// \brief Gets a const reference to the first object in the list.
+    /// \return A const reference to the first object.
+    const object_type& front() const
+    {
+        return *const_iterator(list::m_root.next);
+    }
+    /// \brief Gets a reference to the last object in the list.
+    /// \return A reference to the last object.
+    object_type& back()
+    {
+        return *iterator(list::m_root.previous);
+    }
+    /// \brief Gets a const reference to the last object in the list.
+    /// \return A const reference to the last object.
+    const object_type& back() const
+    {
+        return *const_iterator(list::m_root.previous);
+    }
+
+    // MODIFIERS
+    /// \brief Adds an object to the front of the list.
+    /// \param[in] value The object to copy into the list.
+    /// \return TRUE if the object was added, FALSE if the list is at capacity.
+    bool push_front(const object_type& value)
+    {
+        return list::insert(list::cbegin(), value) != list::end();
+    }
+    /// \brief Adds an object to the front of the list.
+    /// \param[in] value The object to move into the list.
+    /// \return TRUE if the object was added, FALSE if the list is at capacity.
+    bool push_front(object_type&& value)
+    {
+        return list::insert(list::cbegin(), std::move(value)) != list::end();
+    }
+    /// \brief Adds an object to the back of the list.
+    /// \param[in] value The object to copy into the list.
+    /// \return TRUE if the object was added, FALSE if the list is at capacity.
+    bool push_back(const object_type& value)
+    {
+        return list::insert(list::cend(), value) != list::end();
+    }
+    /// \brief Adds an object to the back of the list.
+    /// \param[in] value The object to move into the list.
+    /// \return TRUE if the object was added, FALSE if the list is at capacity.
+    bool push_back(object_type&& value)
+    {
+        return list::insert(list::cend(), std::move(value)) != list::end();
+    }
+    /// \brief Removes the first object from the list.
+    void pop_front()
+    {
+        if(list::m_size)
+        {
+            list::erase(list::cbegin());
+        }
+    }
+    /// \brief Removes the last object from the list.
+    void pop_back()
+    {
+        if(list::m_size)
+        {
+            list::erase(const_iterator(list::m_root.previous));
+        }
+    }
+    /// \brief Inserts an object into the list before a specified position.
+    /// \param[in] position The position to insert the object before.
+    /// \param[in] value The object to copy into the list.
+    /// \return An iterator to the inserted object, or end() if the list is at capacity.
+    iterator insert(const_iterator position, const object_type& value)
+    {
+        // Take a node from the pool.
+        auto node = list::m_pool.acquire();
+        if(!node)
+        {
+            return list::end();
+        }
+
+        // Store the value and link the node.
+        node->value = value;
+        list::link(const_cast<std::container::dynamic::list::links*>(position.links()), node);
+        return iterator(node);
+    }
+    /// \brief Inserts an object into the list before a specified position.
+    /// \param[in] position The position to insert the object before.
+    /// \param[in] value The object to move into the list.
+    /// \return An iterator to the inserted object, or end() if the list is at capacity.
+    iterator insert(const_iterator position, object_type&& value)
+    {
+        // Take a node from the pool.
+        auto node = list::m_pool.acquire();
+        if(!node)
+        {
+            return list::end();
+        }
+
+        // Store the value and link the node.
+        node->value = std::move(value);
+        list::link(const_cast<std::container::dynamic::list::links*>(position.links()), node);
+        return iterator(node);
+    }
+    /// \brief Erases an object from the list.
+    /// \param[in] position The position of the object to erase.
+    /// \return An iterator to the object after the erased object.
+    iterator erase(const_iterator position)
+    {
+        // Unlink the node.
+        auto links = const_cast<std::container::dynamic::list::links*>(position.links());
+        auto next = links->next;
+        links->previous->next = next;
+        next->previous = links->previous;
+        --list::m_size;
+
+        // Return the node to the pool.
+        list::m_pool.release(static_cast<std::container::dynamic::list::node<object_type>*>(links));
+        return iterator(next);
+    }
+    /// \brief Erases a range of objects from the list.
+    /// \param[in] begin The position of the first object to erase.
+    /// \param[in] end The position after the last object to erase.
+    /// \return An iterator to the object after the last erased object.
+    iterator erase(const_iterator begin, const_iterator end)
+    {
+        while(begin != end)
+        {
+            begin = list::erase(begin);
+        }
+        return iterator(const_cast<std::container::dynamic::list::links*>(end.links()));
+    }
+    /// \brief Moves an object within the list to before a specified position.
+    /// \param[in] position The position to move the object before.
+    /// \param[in] element The position of the object to move.
+    /// \details Runs in constant time without copying the object.
+    void splice(const_iterator position, const_iterator element)
+    {
+        // Skip moving an object to its own position.
+        auto links = const_cast<std::container::dynamic::list::links*>(element.links());
+        auto next = const_cast<std::container::dynamic::list::links*>(position.links());
+        if(links == next || links->next == next)
+        {
+            return;
+        }
+
+        // Unlink and relink the node.
+        links->previous->next = links->next;
+        links->next->previous = links->previous;
+        --list::m_size;
+        list::link(next, links);
+    }
+    /// \brief Clears all objects from the list.
+    void clear()
+    {
+        list::erase(list::cbegin(), list::cend());
+    }
+    /// \brief Swaps the contents of this list with another list.
+    /// \param[in] other The other list to swap with.
+    void swap(std::list<object_type>& other)
+    {
+        // Swap pools and sizes.
+        list::m_pool.swap(other.m_pool);
+        std::size_t size = list::m_size;
+        list::m_size = other.m_size;
+        other.m_size = size;
+
+        // Swap chains through a temporary root.
+        std::container::dynamic::list::links root;
+        list::transfer(list::m_root, root);
+        list::transfer(other.m_root, list::m_root);
+        list::transfer(root, other.m_root);
+    }
+    /// \brief Copy-assigns the contents of another list to this list.
+    /// \param[in] other The other list to copy-assign from.
+    /// \return A reference to this list.
+    /// \note This performs a deep copy, reallocating this list to the other list's capacity if they differ.
+    std::list<object_type>& operator=(const std::list<object_type>& other)
+    {
+        // Check for self-assignment.
+        if(&other == this)
+        {
+            return *this;
+        }
+
+        // Clear, and replace the pool if the capacities differ.
+        list::clear();
+        if(list::m_pool.capacity() != other.capacity())
+        {
+            std::container::dynamic::pool<std::container::dynamic::list::node<object_type>> pool(other.capacity());
+            list::m_pool.swap(pool);
+        }
+
+        // Copy objects from other.
+        list::append(other);
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another list to this list.
+    /// \param[in] other The other list to move-assign from.
+    /// \return A reference to this list.
+    std::list<object_type>& operator=(std::list<object_type>&& other)
+    {
+        // Take the other list's contents, leaving it this list's memory.
+        list::swap(other);
+        other.clear();
+
+        return *this;
+    }
+
+    // CAPACITY
+    /// \brief Gets the size of the list.
+    /// \return The size of the list.
+    std::size_t size() const
+    {
+        return list::m_size;
+    }
+    /// \brief Gets the maximum capacity of the list.
+    /// \return The capacity of the list.
+    std::size_t capacity() const
+    {
+        return list::m_pool.capacity();
+    }
+    /// \brief Checks if the list is empty.
+    /// \return TRUE if the list is empty, otherwise FALSE.
+    bool empty() const
+    {
+        return list::m_size == 0;
+    }
+    /// \brief Checks if the list is at capacity.
+    /// \return TRUE if the list is at capacity, otherwise FALSE.
+    bool full() const
+    {
+        return list::m_size == list::m_pool.capacity();
+    }
+
+    // COMPARISON
+    /// \brief Checks if this list is equal to another list.
+    /// \param[in] other The other list to compare with.
+    /// \return TRUE if the two lists are equal, otherwise FALSE.
+    bool operator==(const std::list<object_type>& other) const
+    {
+        // Verify list sizes match.
+        if(list::m_size != other.m_size)
+        {
+            return false;
+        }
+
+        // Compare values.
+        for(auto this_entry = list::cbegin(), other_entry = other.cbegin(); this_entry != list::cend(); ++this_entry, ++other_entry)
+        {
+            if(*this_entry != *other_entry)
+            {
+                return false;
+            }
+        }
+
+        // Indicate equal.
+        return true;
+    }
+    /// \brief Checks if this list is unequal with another list.
+    /// \param[in] other The other list to compare with.
+    /// \return TRUE if the two lists are unequal, otherwise FALSE.
+    bool operator!=(const std::list<object_type>& other) const
+    {
+        return !list::operator==(other);
+    }
+
+private:
+    // MEMORY
+    /// \brief Stores the list's preallocated nodes.
+    std::container::dynamic::pool<std::container::dynamic::list::node<object_type>> m_pool;
+    /// \brief Stores the sentinel links that join the first and last nodes into a circle.
+    std::container::dynamic::list::links m_root;
+    /// \brief Stores the number of objects in the list.
+    std::size_t m_size;
+
+    // LINKS
+    /// \brief Links a node before another node.
+    /// \param[in] next The node to link before.
+    /// \param[in] links The node to link.
+    void link(std::container::dynamic::list::links* next, std::container::dynamic::list::links* links)
+    {
+        links->next = next;
+        links->previous = next->previous;
+        next->previous->next = links;
+        next->previous = links;
+        ++list::m_size;
+    }
+    /// \brief Resets a root to an empty chain.
+    /// \param[in] root The root to reset.
+    static void reset(std::container::dynamic::list::links& root)
+    {
+        root.previous = &root;
+        root.next = &root;
+    }
+    /// \brief Moves a chain of nodes from one root to another.
+    /// \param[in] source The root to move the chain from, which is left empty.
+    /// \param[in] destination The root to move the chain to.
+    static void transfer(std::container::dynamic::list::links& source, std::container::dynamic::list::links& destination)
+    {
+        // Check for an empty chain.
+        if(source.next == &source)
+        {
+            list::reset(destination);
+            return;
+        }
+
+        // Point the destination and the chain's ends at each other.
+        destination.next = source.next;
+        destination.previous = source.previous;
+        destination.next->previous = &destination;
+        destination.previous->next = &destination;
+        list::reset(source);
+    }
+    /// \brief Appends copies of the objects in another list.
+    /// \param[in] other The other list to copy from.
+    void append(const std::list<object_type>& other)
+    {
+        for(auto entry = other.cbegin(); entry != other.cend(); ++entry)
+        {
+            list::push_back(*entry);
+        }
+    }
+};
+
+}
+
+#endif
\ No newline at end of file
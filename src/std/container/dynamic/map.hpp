@@ -6,6 +6,7 @@
 // std
 #include <std/container/dynamic/base.hpp>
 #include <std/utility/forward.hpp>
+#include <std/utility/optional.hpp>
 #include <std/utility/pair.hpp>
 
 namespace std {
@@ -57,6 +58,30 @@ public:
     {
         return map::find_element(key) != map::m_end;
     }
+    /// \brief Gets the value mapped to a specified key.
+    /// \param[in] key The key to look up.
+    /// \return An optional reference to the mapped value, which is empty if the key is not present in the map.
+    std::optional<value_type&> get(const key_type& key)
+    {
+        auto entry = map::find_element(key);
+        if(entry == map::m_end)
+        {
+            return std::nullopt;
+        }
+        return entry->second;
+    }
+    /// \brief Gets the value mapped to a specified key.
+    /// \param[in] key The key to look up.
+    /// \return An optional const reference to the mapped value, which is empty if the key is not present in the map.
+    std::optional<const value_type&> get(const key_type& key) const
+    {
+        auto entry = map::find_element(key);
+        if(entry == map::m_end)
+        {
+            return std::nullopt;
+        }
+        return entry->second;
+    }
 
     // MODIFIERS
     /// \brief Inserts a key/value mapping into the map.
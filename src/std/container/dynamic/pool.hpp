@@ -0,0 +1,107 @@
+/// \file std/container/dynamic/pool.hpp
+/// \brief Defines the std::container::dynamic::pool template class.
+#ifndef STD___CONTAINER___DYNAMIC___POOL_H
+#define STD___CONTAINER___DYNAMIC___POOL_H
+
+// std
+#include <std/stddef.hpp>
+
+namespace std::container::dynamic {
+
+/// \brief A fixed-capacity pool of nodes allocated in a single contiguous slab.
+/// \tparam node_type The node type. Must have a next member that can point to a node_type.
+/// \details Free nodes are chained through their next member, so acquiring and releasing a node runs in constant time
+/// with no allocation after construction.
+template <typename node_type>
+class pool
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new pool instance with all nodes free.
+    /// \param[in] capacity The number of nodes in the pool.
+    pool(std::size_t capacity)
+        : m_nodes(new node_type[capacity]),
+          m_capacity(capacity)
+    {
+        pool::reset();
+    }
+    /// \brief Pools cannot be copied, as nodes are referenced by address.
+    pool(const std::container::dynamic::pool<node_type>& other) = delete;
+    ~pool()
+    {
+        // Clean up allocated memory.
+        delete [] pool::m_nodes;
+    }
+
+    // MODIFIERS
+    /// \brief Pools cannot be copy-assigned, as nodes are referenced by address.
+    std::container::dynamic::pool<node_type>& operator=(const std::container::dynamic::pool<node_type>& other) = delete;
+    /// \brief Takes a node from the pool.
+    /// \return A pointer to the node, or nullptr if all nodes are in use.
+    node_type* acquire()
+    {
+        // Verify a node is free.
+        node_type* node = pool::m_free;
+        if(!node)
+        {
+            return nullptr;
+        }
+
+        // Pop the node from the free list.
+        pool::m_free = static_cast<node_type*>(node->next);
+        return node;
+    }
+    /// \brief Returns a node to the pool.
+    /// \param[in] node The node to return, which must have been acquired from this pool.
+    void release(node_type* node)
+    {
+        // Push the node onto the free list.
+        node->next = pool::m_free;
+        pool::m_free = node;
+    }
+    /// \brief Returns all nodes to the pool.
+    /// \details Nodes are chained in address order, so a freshly reset pool hands out contiguous nodes.
+    void reset()
+    {
+        pool::m_free = nullptr;
+        for(std::size_t i = pool::m_capacity; i-- > 0;)
+        {
+            pool::release(pool::m_nodes + i);
+        }
+    }
+    /// \brief Swaps the nodes of this pool with another pool.
+    /// \param[in] other The other pool to swap with.
+    void swap(std::container::dynamic::pool<node_type>& other)
+    {
+        node_type* nodes = pool::m_nodes;
+        node_type* free = pool::m_free;
+        std::size_t capacity = pool::m_capacity;
+        pool::m_nodes = other.m_nodes;
+        pool::m_free = other.m_free;
+        pool::m_capacity = other.m_capacity;
+        other.m_nodes = nodes;
+        other.m_free = free;
+        other.m_capacity = capacity;
+    }
+
+    // CAPACITY
+    /// \brief Gets the number of nodes in the pool.
+    /// \return The number of nodes in the pool.
+    std::size_t capacity() const
+    {
+        return pool::m_capacity;
+    }
+
+private:
+    // MEMORY
+    /// \brief Stores the slab of nodes.
+    node_type* m_nodes;
+    /// \brief Stores the first free node, or nullptr if all nodes are in use.
+    node_type* m_free;
+    /// \brief Stores the number of nodes in the pool.
+    std::size_t m_capacity;
+};
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,141 @@
+/// \file std/container/dynamic/priority_queue.hpp
+/// \brief Defines the std::priority_queue template class.
+#ifndef STD___CONTAINER___DYNAMIC___PRIORITY_QUEUE_H
+#define STD___CONTAINER___DYNAMIC___PRIORITY_QUEUE_H
+
+// std
+#include <std/algorithm/heap.hpp>
+#include <std/container/dynamic/base.hpp>
+#include <std/functional/comparison.hpp>
+#include <std/utility/forward.hpp>
+#include <std/utility/move.hpp>
+
+namespace std {
+
+/// \brief A dynamic container that provides constant time access to its highest priority object.
+/// \tparam object_type The object type stored by this container.
+/// \tparam compare_type The comparison function object type. The top object is the one for which compare returns
+/// FALSE against all others, so std::less orders the largest object first and std::greater orders the smallest first.
+/// \details Objects are stored as a binary heap in the container's contiguous memory, so push and pop run in
+/// O(log n). The storage is inherited with protected access so the heap order cannot be broken through iterators or erase.
+template <typename object_type, typename compare_type = std::less<object_type>>
+class priority_queue
+    : protected std::container::dynamic::base<object_type>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty priority queue instance.
+    /// \param[in] capacity The maximum capacity of this priority queue.
+    /// \param[in] compare The comparison function object.
+    priority_queue(std::size_t capacity, const compare_type& compare = compare_type())
+        : std::container::dynamic::base<object_type>(capacity),
+          m_compare(compare)
+    {}
+    /// \brief Copy-constructs a new priority queue from an existing priority queue.
+    /// \param[in] other The other priority queue to copy-construct from.
+    priority_queue(const std::priority_queue<object_type,compare_type>& other)
+        : std::container::dynamic::base<object_type>(other),
+          m_compare(other.m_compare)
+    {}
+    /// \brief Move-constructs a new priority queue from an existing priority queue.
+    /// \param[in] other The other priority queue to move-construct from.
+    priority_queue(std::priority_queue<object_type,compare_type>&& other)
+        : std::container::dynamic::base<object_type>(std::forward<std::priority_queue<object_type,compare_type>>(other)),
+          m_compare(other.m_compare)
+    {}
+
+    // ACCESS
+    /// \brief Gets a const reference to the highest priority object.
+    /// \return A const reference to the highest priority object.
+    const object_type& top() const
+    {
+        return *priority_queue::m_begin;
+    }
+
+    // MODIFIERS
+    /// \brief Adds an object to the priority queue.
+    /// \param[in] value The object to copy into the priority queue.
+    /// \return TRUE if the object was added, FALSE if the priority queue is at capacity.
+    bool push(const object_type& value)
+    {
+        // Verify capacity.
+        if(priority_queue::m_end == priority_queue::m_capacity)
+        {
+            return false;
+        }
+
+        // Add to the end and sift into place.
+        *priority_queue::m_end++ = value;
+        std::push_heap(priority_queue::m_begin, priority_queue::m_end, priority_queue::m_compare);
+
+        return true;
+    }
+    /// \brief Adds an object to the priority queue.
+    /// \param[in] value The object to move into the priority queue.
+    /// \return TRUE if the object was added, FALSE if the priority queue is at capacity.
+    bool push(object_type&& value)
+    {
+        // Verify capacity.
+        if(priority_queue::m_end == priority_queue::m_capacity)
+        {
+            return false;
+        }
+
+        // Add to the end and sift into place.
+        *priority_queue::m_end++ = std::move(value);
+        std::push_heap(priority_queue::m_begin, priority_queue::m_end, priority_queue::m_compare);
+
+        return true;
+    }
+    /// \brief Removes the highest priority object from the priority queue.
+    void pop()
+    {
+        // Verify the priority queue isn't empty.
+        if(priority_queue::m_end == priority_queue::m_begin)
+        {
+            return;
+        }
+
+        // Move the top to the end and remove it.
+        std::pop_heap(priority_queue::m_begin, priority_queue::m_end, priority_queue::m_compare);
+        --priority_queue::m_end;
+    }
+    using std::container::dynamic::base<object_type>::clear;
+    /// \brief Copy-assigns the contents of another priority queue to this priority queue.
+    /// \param[in] other The other priority queue to copy-assign from.
+    /// \return A reference to this priority queue.
+    std::priority_queue<object_type,compare_type>& operator=(const std::priority_queue<object_type,compare_type>& other)
+    {
+        // Use base container's operator= method.
+        std::container::dynamic::base<object_type>::operator=(other);
+        priority_queue::m_compare = other.m_compare;
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another priority queue to this priority queue.
+    /// \param[in] other The other priority queue to move-assign from.
+    /// \return A reference to this priority queue.
+    std::priority_queue<object_type,compare_type>& operator=(std::priority_queue<object_type,compare_type>&& other)
+    {
+        // Use base container's operator= method.
+        std::container::dynamic::base<object_type>::operator=(std::forward<std::priority_queue<object_type,compare_type>>(other));
+        priority_queue::m_compare = other.m_compare;
+
+        return *this;
+    }
+
+    // CAPACITY
+    using std::container::dynamic::base<object_type>::size;
+    using std::container::dynamic::base<object_type>::capacity;
+    using std::container::dynamic::base<object_type>::empty;
+    using std::container::dynamic::base<object_type>::full;
+
+private:
+    // DATA
+    /// \brief The comparison function object.
+    compare_type m_compare;
+};
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,343 @@
+/// \file std/container/dynamic/slot_map.hpp
+/// \brief Defines the std::slot_map template class.
+#ifndef STD___CONTAINER___DYNAMIC___SLOT_MAP_H
+#define STD___CONTAINER___DYNAMIC___SLOT_MAP_H
+
+// std
+#include <std/container/dynamic/base.hpp>
+#include <std/utility/forward.hpp>
+#include <std/utility/move.hpp>
+
+// arduino
+#include <Arduino.h>
+
+namespace std {
+
+/// \brief A dynamic container that stores objects contiguously and references them through stable, generational keys.
+/// \tparam object_type The object type stored by this container.
+/// \details Objects are stored densely in the container's contiguous memory, so iteration touches no gaps. Keys index
+/// a sparse slot array that maps to the dense position, and carry a generation counter that is incremented each time
+/// a slot is freed. Lookups with a key whose object was erased therefore fail instead of returning a different object.
+/// Insertion, lookup, and erasure (which moves the last object into the erased position) all run in constant time.
+template <typename object_type>
+class slot_map
+    : protected std::container::dynamic::base<object_type>
+{
+public:
+    // TYPES
+    /// \brief A key referencing an object in a slot map.
+    /// \details Keys are four bytes, so they can be handed to remote peers directly as identifiers.
+    struct key_type
+    {
+        /// \brief The index of the key's slot.
+        uint16_t index;
+        /// \brief The generation of the key's slot when the key was issued.
+        uint16_t generation;
+
+        /// \brief Checks if this key is equal to another key.
+        /// \param[in] other The other key to compare with.
+        /// \return TRUE if the keys are equal, otherwise FALSE.
+        bool operator==(const key_type& other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+        /// \brief Checks if this key is unequal with another key.
+        /// \param[in] other The other key to compare with.
+        /// \return TRUE if the keys are unequal, otherwise FALSE.
+        bool operator!=(const key_type& other) const
+        {
+            return index != other.index || generation != other.generation;
+        }
+    };
+
+    // CONSTANTS
+    /// \brief Indicates an invalid slot index.
+    static constexpr uint16_t npos = 0xFFFF;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty slot map instance.
+    /// \param[in] capacity The maximum capacity of this slot map, which must be less than npos.
+    slot_map(std::size_t capacity)
+        : std::container::dynamic::base<object_type>(capacity),
+          m_slots(new slot[capacity]),
+          m_owners(new uint16_t[capacity]),
+          m_free(0)
+    {
+        // Chain all slots into the free list.
+        for(std::size_t i = 0; i < capacity; ++i)
+        {
+            slot_map::m_slots[i].position = i + 1 < capacity ? i + 1 : npos;
+            slot_map::m_slots[i].generation = 0;
+        }
+        if(capacity == 0)
+        {
+            slot_map::m_free = npos;
+        }
+    }
+    /// \brief Copy-constructs a new slot map from an existing slot map.
+    /// \param[in] other The other slot map to copy-construct from.
+    /// \note This performs a deep copy, and keys from the other slot map are valid for this one.
+    slot_map(const std::slot_map<object_type>& other)
+        : std::container::dynamic::base<object_type>(other),
+          m_slots(new slot[other.capacity()]),
+          m_owners(new uint16_t[other.capacity()]),
+          m_free(other.m_free)
+    {
+        slot_map::copy(other);
+    }
+    /// \brief Move-constructs a new slot map from an existing slot map.
+    /// \param[in] other The other slot map to move-construct from.
+    slot_map(std::slot_map<object_type>&& other)
+        : slot_map(other.capacity())
+    {
+        slot_map::swap(other);
+    }
+    ~slot_map()
+    {
+        // Clean up allocated memory.
+        delete [] slot_map::m_slots;
+        delete [] slot_map::m_owners;
+    }
+
+    // ACCESS
+    using std::container::dynamic::base<object_type>::begin;
+    using std::container::dynamic::base<object_type>::end;
+    using std::container::dynamic::base<object_type>::cbegin;
+    using std::container::dynamic::base<object_type>::cend;
+    /// \brief Finds the object referenced by a key.
+    /// \param[in] key The key of the object.
+    /// \return A pointer to the object, or nullptr if the key is stale or invalid.
+    object_type* find(key_type key)
+    {
+        return slot_map::contains(key) ? slot_map::m_begin + slot_map::m_slots[key.index].position : nullptr;
+    }
+    /// \brief Finds the object referenced by a key.
+    /// \param[in] key The key of the object.
+    /// \return A const pointer to the object, or nullptr if the key is stale or invalid.
+    const object_type* find(key_type key) const
+    {
+        return slot_map::contains(key) ? slot_map::m_begin + slot_map::m_slots[key.index].position : nullptr;
+    }
+    /// \brief Gets a reference to the object referenced by a key.
+    /// \param[in] key The key of the object, which must be valid.
+    /// \return A reference to the object.
+    object_type& operator[](key_type key)
+    {
+        return slot_map::m_begin[slot_map::m_slots[key.index].position];
+    }
+    /// \brief Gets a const reference to the object referenced by a key.
+    /// \param[in] key The key of the object, which must be valid.
+    /// \return A const reference to the object.
+    const object_type& operator[](key_type key) const
+    {
+        return slot_map::m_begin[slot_map::m_slots[key.index].position];
+    }
+    /// \brief Gets the key of the object at a position in the dense storage.
+    /// \param[in] position The position of the object, from 0 to size() - 1.
+    /// \return The key of the object.
+    key_type key(std::size_t position) const
+    {
+        uint16_t index = slot_map::m_owners[position];
+        return {index, slot_map::m_slots[index].generation};
+    }
+
+    // LOOKUP
+    /// \brief Checks if a key references an object in the slot map.
+    /// \param[in] key The key to check.
+    /// \return TRUE if the key references an object, otherwise FALSE.
+    bool contains(key_type key) const
+    {
+        // Check the slot is in range, its generation matches, and it is occupied.
+        if(key.index >= slot_map::capacity() || slot_map::m_slots[key.index].generation != key.generation)
+        {
+            return false;
+        }
+        std::size_t position = slot_map::m_slots[key.index].position;
+        return position < slot_map::size() && slot_map::m_owners[position] == key.index;
+    }
+
+    // MODIFIERS
+    /// \brief Inserts an object into the slot map.
+    /// \param[in] value The object to copy into the slot map.
+    /// \return The key of the inserted object, or a key with an index of npos if the slot map is at capacity.
+    key_type insert(const object_type& value)
+    {
+        // Take a free slot.
+        key_type key = slot_map::acquire();
+        if(key.index != npos)
+        {
+            *slot_map::m_end++ = value;
+        }
+        return key;
+    }
+    /// \brief Inserts an object into the slot map.
+    /// \param[in] value The object to move into the slot map.
+    /// \return The key of the inserted object, or a key with an index of npos if the slot map is at capacity.
+    key_type insert(object_type&& value)
+    {
+        // Take a free slot.
+        key_type key = slot_map::acquire();
+        if(key.index != npos)
+        {
+            *slot_map::m_end++ = std::move(value);
+        }
+        return key;
+    }
+    /// \brief Erases an object from the slot map.
+    /// \param[in] key The key of the object to erase.
+    /// \return TRUE if the object was erased, FALSE if the key is stale or invalid.
+    /// \details The last object is moved into the erased object's position, so the storage stays dense.
+    bool erase(key_type key)
+    {
+        // Verify the key.
+        if(!slot_map::contains(key))
+        {
+            return false;
+        }
+
+        // Move the last object into the erased position and repoint its slot.
+        std::size_t position = slot_map::m_slots[key.index].position;
+        std::size_t last = slot_map::size() - 1;
+        if(position != last)
+        {
+            slot_map::m_begin[position] = std::move(slot_map::m_begin[last]);
+            slot_map::m_owners[position] = slot_map::m_owners[last];
+            slot_map::m_slots[slot_map::m_owners[position]].position = position;
+        }
+        --slot_map::m_end;
+
+        // Free the slot.
+        slot_map::release(key.index);
+        return true;
+    }
+    /// \brief Clears all objects from the slot map.
+    /// \note All keys are invalidated.
+    void clear()
+    {
+        for(std::size_t position = 0; position < slot_map::size(); ++position)
+        {
+            slot_map::release(slot_map::m_owners[position]);
+        }
+        slot_map::m_end = slot_map::m_begin;
+    }
+    /// \brief Swaps the contents of this slot map with another slot map.
+    /// \param[in] other The other slot map to swap with.
+    void swap(std::slot_map<object_type>& other)
+    {
+        std::container::dynamic::base<object_type>::swap(other);
+        auto slots = slot_map::m_slots;
+        auto owners = slot_map::m_owners;
+        auto free = slot_map::m_free;
+        slot_map::m_slots = other.m_slots;
+        slot_map::m_owners = other.m_owners;
+        slot_map::m_free = other.m_free;
+        other.m_slots = slots;
+        other.m_owners = owners;
+        other.m_free = free;
+    }
+    /// \brief Copy-assigns the contents of another slot map to this slot map.
+    /// \param[in] other The other slot map to copy-assign from.
+    /// \return A reference to this slot map.
+    /// \note This performs a deep copy, and keys from the other slot map are valid for this one.
+    std::slot_map<object_type>& operator=(const std::slot_map<object_type>& other)
+    {
+        // Check for self-assignment.
+        if(&other == this)
+        {
+            return *this;
+        }
+
+        // Use base container's operator= method, and reallocate the slots to match.
+        std::container::dynamic::base<object_type>::operator=(other);
+        delete [] slot_map::m_slots;
+        delete [] slot_map::m_owners;
+        slot_map::m_slots = new slot[other.capacity()];
+        slot_map::m_owners = new uint16_t[other.capacity()];
+        slot_map::m_free = other.m_free;
+        slot_map::copy(other);
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another slot map to this slot map.
+    /// \param[in] other The other slot map to move-assign from.
+    /// \return A reference to this slot map.
+    std::slot_map<object_type>& operator=(std::slot_map<object_type>&& other)
+    {
+        // Take the other slot map's contents, leaving it this slot map's memory.
+        slot_map::swap(other);
+        other.clear();
+
+        return *this;
+    }
+
+    // CAPACITY
+    using std::container::dynamic::base<object_type>::size;
+    using std::container::dynamic::base<object_type>::capacity;
+    using std::container::dynamic::base<object_type>::empty;
+    using std::container::dynamic::base<object_type>::full;
+
+private:
+    // TYPES
+    /// \brief A sparse slot.
+    struct slot
+    {
+        /// \brief The dense position of the slot's object while occupied, or the next free slot while free.
+        uint16_t position;
+        /// \brief The slot's generation, incremented each time the slot is freed.
+        uint16_t generation;
+    };
+
+    // MEMORY
+    /// \brief Stores the sparse slots, indexed by key.
+    slot* m_slots;
+    /// \brief Stores the slot index of each object in the dense storage.
+    uint16_t* m_owners;
+    /// \brief Stores the index of the first free slot, or npos if all slots are in use.
+    uint16_t m_free;
+
+    /// \brief Takes a free slot for an object appended to the dense storage.
+    /// \return The key of the slot, or a key with an index of npos if no slot is free.
+    key_type acquire()
+    {
+        // Verify a slot is free.
+        uint16_t index = slot_map::m_free;
+        if(index == npos)
+        {
+            return {npos, 0};
+        }
+
+        // Pop the slot from the free list and point it at the end of the dense storage.
+        slot& entry = slot_map::m_slots[index];
+        slot_map::m_free = entry.position;
+        entry.position = slot_map::size();
+        slot_map::m_owners[entry.position] = index;
+        return {index, entry.generation};
+    }
+    /// \brief Frees a slot, invalidating its keys.
+    /// \param[in] index The index of the slot to free.
+    void release(uint16_t index)
+    {
+        slot& entry = slot_map::m_slots[index];
+        ++entry.generation;
+        entry.position = slot_map::m_free;
+        slot_map::m_free = index;
+    }
+    /// \brief Copies the slots and owners of another slot map with the same capacity.
+    /// \param[in] other The other slot map to copy from.
+    void copy(const std::slot_map<object_type>& other)
+    {
+        for(std::size_t i = 0; i < other.capacity(); ++i)
+        {
+            slot_map::m_slots[i] = other.m_slots[i];
+            slot_map::m_owners[i] = other.m_owners[i];
+        }
+    }
+};
+
+/// \brief Indicates an invalid slot index.
+template <typename object_type>
+constexpr uint16_t slot_map<object_type>::npos;
+
+}
+
+#endif
\ No newline at end of file
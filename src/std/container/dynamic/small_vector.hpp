@@ -0,0 +1,393 @@
+/// \file std/container/dynamic/small_vector.hpp
+/// \brief Defines the std::small_vector template class.
+#ifndef STD___CONTAINER___DYNAMIC___SMALL_VECTOR_H
+#define STD___CONTAINER___DYNAMIC___SMALL_VECTOR_H
+
+// std
+#include <std/algorithm/remove.hpp>
+#include <std/container/dynamic/vector.hpp>
+#include <std/utility/move.hpp>
+
+namespace std {
+
+/// \brief A vector that stores up to a fixed number of objects inline, spilling once to the heap when exceeded.
+/// \tparam object_type The object type stored by this container.
+/// \tparam inline_value The number of objects stored inline, without allocation.
+/// \details The vector starts on its inline storage. The first time an insertion needs more room, the objects are
+/// moved into a single heap allocation of the maximum capacity, which is kept until the vector is destroyed. The
+/// interface matches std::vector, with insertions only failing once the maximum capacity is reached.
+/// \note std::vector is inherited privately, since its move, assignment and swap operations would take or delete[]
+/// the inline storage. A small_vector therefore cannot be passed as a std::vector reference.
+template <typename object_type, std::size_t inline_value>
+class small_vector
+    : private std::vector<object_type>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty small vector instance.
+    /// \param[in] max_capacity The maximum capacity of this vector. If larger than inline_value, the vector spills to
+    /// a heap allocation of this capacity when its inline storage is exceeded.
+    small_vector(std::size_t max_capacity = inline_value)
+        : std::vector<object_type>(m_inline, inline_value),
+          m_max_capacity(max_capacity > inline_value ? max_capacity : inline_value)
+    {}
+    /// \brief Copy-constructs a new small vector from an existing small vector.
+    /// \param[in] other The other small vector to copy-construct from.
+    /// \note This performs a deep copy, spilling only if the other vector's objects do not fit inline.
+    small_vector(const std::small_vector<object_type,inline_value>& other)
+        : small_vector(other.m_max_capacity)
+    {
+        small_vector::assign(other.cbegin(), other.cend());
+    }
+    /// \brief Move-constructs a new small vector from an existing small vector.
+    /// \param[in] other The other small vector to move-construct from.
+    /// \details A spilled heap allocation is taken from the other vector; inline objects are moved individually.
+    small_vector(std::small_vector<object_type,inline_value>&& other)
+        : small_vector(other.m_max_capacity)
+    {
+        small_vector::take(other);
+    }
+    ~small_vector()
+    {
+        // Prevent the base container from deleting inline storage.
+        if(small_vector::spilled() == false)
+        {
+            small_vector::m_begin = nullptr;
+        }
+    }
+
+    // ACCESS
+    using std::vector<object_type>::operator[];
+    using std::vector<object_type>::at;
+    using std::vector<object_type>::front;
+    using std::vector<object_type>::back;
+    using std::vector<object_type>::data;
+    using std::vector<object_type>::begin;
+    using std::vector<object_type>::end;
+    using std::vector<object_type>::cbegin;
+    using std::vector<object_type>::cend;
+    using std::vector<object_type>::rbegin;
+    using std::vector<object_type>::rend;
+    using std::vector<object_type>::crbegin;
+    using std::vector<object_type>::crend;
+
+    // MODIFIERS
+    using std::vector<object_type>::pop_back;
+    using std::vector<object_type>::erase;
+    using std::vector<object_type>::clear;
+    /// \brief Appends a new object to the end of this vector.
+    /// \param[in] value The value to append.
+    /// \return TRUE if the operation succeeded, FALSE if this vector is at its maximum capacity.
+    bool push_back(const object_type& value)
+    {
+        return small_vector::reserve(small_vector::size() + 1) && std::vector<object_type>::push_back(value);
+    }
+    /// \brief Appends a new object to the end of this vector, or reports why it could not.
+    /// \param[in] value The value to append.
+    /// \return An iterator to the appended object, or std::errc::no_buffer_space if this vector is at its maximum
+    /// capacity.
+    std::expected<std::iterator<object_type>,std::errc> try_push_back(const object_type& value)
+    {
+        if(!small_vector::push_back(value))
+        {
+            return std::make_unexpected(std::errc::no_buffer_space);
+        }
+        return small_vector::m_end - 1;
+    }
+    /// \brief Inserts an object into this vector at a specified position.
+    /// \param[in] position The position to insert the object at.
+    /// \param[in] value The object to insert.
+    /// \return An iterator to the inserted object. NULLPTR if vector is at its maximum capacity.
+    std::iterator<object_type> insert(std::iterator<object_type> position, const object_type& value)
+    {
+        // Spill if needed, and rebase the position onto the new storage.
+        std::size_t index = position - small_vector::m_begin;
+        if(!small_vector::reserve(small_vector::size() + 1))
+        {
+            return nullptr;
+        }
+        return std::vector<object_type>::insert(small_vector::m_begin + index, value);
+    }
+    /// \brief Inserts copies of a value into this vector at a specified position.
+    /// \param[in] position The position to insert the values at.
+    /// \param[in] count The number of copies to insert.
+    /// \param[in] value The value to insert.
+    /// \return An iterator to the first inserted object. NULLPTR if vector does not have enough maximum capacity.
+    std::iterator<object_type> insert(std::iterator<object_type> position, std::size_t count, const object_type& value)
+    {
+        // Spill if needed, and rebase the position onto the new storage.
+        std::size_t index = position - small_vector::m_begin;
+        if(!small_vector::reserve(small_vector::size() + count))
+        {
+            return nullptr;
+        }
+        return std::vector<object_type>::insert(small_vector::m_begin + index, count, value);
+    }
+    /// \brief Inserts a range of values into this vector at a specified position.
+    /// \param[in] position The position to insert the values at.
+    /// \param[in] begin An iterator to the beginning of the range to copy.
+    /// \param[in] end An iterator to the end of the range to copy.
+    /// \return An iterator to the first inserted object. NULLPTR if vector does not have enough maximum capacity.
+    /// \note The range must not be part of this vector.
+    std::iterator<object_type> insert(std::iterator<object_type> position, std::const_iterator<object_type> begin, std::const_iterator<object_type> end)
+    {
+        // Spill if needed, and rebase the position onto the new storage.
+        std::size_t index = position - small_vector::m_begin;
+        if(!small_vector::reserve(small_vector::size() + (end - begin)))
+        {
+            return nullptr;
+        }
+        return std::vector<object_type>::insert(small_vector::m_begin + index, begin, end);
+    }
+    /// \brief Appends a range of values to the end of this vector.
+    /// \param[in] begin An iterator to the beginning of the range to copy.
+    /// \param[in] end An iterator to the end of the range to copy.
+    /// \return TRUE if the operation succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool append(std::const_iterator<object_type> begin, std::const_iterator<object_type> end)
+    {
+        return small_vector::reserve(small_vector::size() + (end - begin)) && std::vector<object_type>::append(begin, end);
+    }
+    /// \brief Assigns a size and value to this vector.
+    /// \param[in] value The value to set all elements to.
+    /// \param[in] count The size to set this vector to.
+    /// \return TRUE if the assignment succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool assign(const object_type& value, std::size_t count)
+    {
+        return small_vector::reserve(count) && std::vector<object_type>::assign(value, count);
+    }
+    /// \brief Assigns a range of values to this vector.
+    /// \param[in] begin An iterator to the beginning of the range to copy.
+    /// \param[in] end An iterator to the end of the range to copy.
+    /// \return TRUE if the assignment succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool assign(std::const_iterator<object_type> begin, std::const_iterator<object_type> end)
+    {
+        return small_vector::reserve(end - begin) && std::vector<object_type>::assign(begin, end);
+    }
+    /// \brief Resizes this vector to a specified size, default-constructing additional elements if needed.
+    /// \param[in] size The size to set this vector to.
+    /// \return TRUE if the resize succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool resize(std::size_t size)
+    {
+        return small_vector::resize(size, object_type());
+    }
+    /// \brief Resizes this vector to a specified size, using a provided value for additional elements if needed.
+    /// \param[in] size The size to set this vector to.
+    /// \param[in] value The value to assign to additional elements.
+    /// \return TRUE if the resize succeeded, FALSE if this vector does not have enough maximum capacity.
+    bool resize(std::size_t size, const object_type& value)
+    {
+        return small_vector::reserve(size) && std::vector<object_type>::resize(size, value);
+    }
+    /// \brief Ensures this vector can hold a specified number of objects, spilling to the heap if needed.
+    /// \param[in] capacity The number of objects to make room for.
+    /// \return TRUE if this vector can hold the objects, FALSE if it exceeds the maximum capacity.
+    bool reserve(std::size_t capacity)
+    {
+        // Check if the current storage suffices.
+        if(capacity <= std::vector<object_type>::capacity())
+        {
+            return true;
+        }
+
+        // Verify the maximum capacity suffices, which also means the vector has not spilled yet.
+        if(capacity > small_vector::m_max_capacity)
+        {
+            return false;
+        }
+
+        // Spill to a heap allocation of the maximum capacity, abandoning the inline storage.
+        small_vector::relocate(small_vector::m_max_capacity);
+        return true;
+    }
+    /// \brief Swaps the contents of this vector with another vector.
+    /// \param[in] other The other vector to swap with.
+    /// \note Inline objects are exchanged element by element, so this runs in O(n) unless both vectors have spilled.
+    void swap(std::small_vector<object_type,inline_value>& other)
+    {
+        // Exchange through a temporary.
+        std::small_vector<object_type,inline_value> temp(std::move(*this));
+        *this = std::move(other);
+        other = std::move(temp);
+    }
+    /// \brief Copy-assigns the contents of another small vector to this small vector.
+    /// \param[in] other The other small vector to copy-assign from.
+    /// \return A reference to this vector.
+    std::small_vector<object_type,inline_value>& operator=(const std::small_vector<object_type,inline_value>& other)
+    {
+        // Check for self-assignment.
+        if(&other == this)
+        {
+            return *this;
+        }
+
+        // Adopt the other vector's maximum capacity, and copy its objects.
+        small_vector::reset(other.m_max_capacity);
+        small_vector::assign(other.cbegin(), other.cend());
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another small vector to this small vector.
+    /// \param[in] other The other small vector to move-assign from.
+    /// \return A reference to this vector.
+    std::small_vector<object_type,inline_value>& operator=(std::small_vector<object_type,inline_value>&& other)
+    {
+        // Check for self-assignment.
+        if(&other == this)
+        {
+            return *this;
+        }
+
+        // Adopt the other vector's maximum capacity, and take its objects.
+        small_vector::reset(other.m_max_capacity);
+        small_vector::take(other);
+
+        return *this;
+    }
+
+    // CAPACITY
+    using std::vector<object_type>::size;
+    using std::vector<object_type>::capacity;
+    using std::vector<object_type>::empty;
+    /// \brief Checks if this vector is at its maximum capacity.
+    /// \return TRUE if this vector is at its maximum capacity, otherwise FALSE.
+    bool full() const
+    {
+        return small_vector::size() == small_vector::m_max_capacity;
+    }
+    /// \brief Gets the maximum capacity of this vector.
+    /// \return The maximum capacity of this vector.
+    std::size_t max_capacity() const
+    {
+        return small_vector::m_max_capacity;
+    }
+    /// \brief Checks if this vector has spilled its objects to the heap.
+    /// \return TRUE if the objects are stored on the heap, FALSE if they are stored inline.
+    bool spilled() const
+    {
+        return small_vector::m_begin != small_vector::m_inline;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this vector is equal to another vector.
+    /// \param[in] other The other vector to compare with.
+    /// \return TRUE if the two vectors are equal, otherwise FALSE.
+    bool operator==(const std::small_vector<object_type,inline_value>& other) const
+    {
+        return std::vector<object_type>::operator==(other);
+    }
+    /// \brief Checks if this vector is unequal with another vector.
+    /// \param[in] other The other vector to compare with.
+    /// \return TRUE if the two vectors are unequal, otherwise FALSE.
+    bool operator!=(const std::small_vector<object_type,inline_value>& other) const
+    {
+        return std::vector<object_type>::operator!=(other);
+    }
+    /// \brief Checks if this vector is lexicographically less than another vector.
+    /// \param[in] other The other vector to compare with.
+    /// \return TRUE if this vector is ordered before the other vector, otherwise FALSE.
+    bool operator<(const std::small_vector<object_type,inline_value>& other) const
+    {
+        return std::vector<object_type>::operator<(other);
+    }
+    /// \brief Checks if this vector is lexicographically less than or equal to another vector.
+    /// \param[in] other The other vector to compare with.
+    /// \return TRUE if this vector is not ordered after the other vector, otherwise FALSE.
+    bool operator<=(const std::small_vector<object_type,inline_value>& other) const
+    {
+        return std::vector<object_type>::operator<=(other);
+    }
+    /// \brief Checks if this vector is lexicographically greater than another vector.
+    /// \param[in] other The other vector to compare with.
+    /// \return TRUE if this vector is ordered after the other vector, otherwise FALSE.
+    bool operator>(const std::small_vector<object_type,inline_value>& other) const
+    {
+        return std::vector<object_type>::operator>(other);
+    }
+    /// \brief Checks if this vector is lexicographically greater than or equal to another vector.
+    /// \param[in] other The other vector to compare with.
+    /// \return TRUE if this vector is not ordered before the other vector, otherwise FALSE.
+    bool operator>=(const std::small_vector<object_type,inline_value>& other) const
+    {
+        return std::vector<object_type>::operator>=(other);
+    }
+
+private:
+    // DATA
+    /// \brief The inline storage for objects.
+    object_type m_inline[inline_value];
+    /// \brief The maximum capacity of this vector.
+    std::size_t m_max_capacity;
+
+    /// \brief Empties this vector and returns it to its inline storage.
+    /// \param[in] max_capacity The new maximum capacity of this vector.
+    void reset(std::size_t max_capacity)
+    {
+        if(small_vector::spilled())
+        {
+            delete [] small_vector::m_begin;
+        }
+        small_vector::m_begin = small_vector::m_inline;
+        small_vector::m_end = small_vector::m_inline;
+        small_vector::m_capacity = small_vector::m_inline + inline_value;
+        small_vector::m_max_capacity = max_capacity;
+    }
+    /// \brief Takes the objects of another vector, which is left empty on its inline storage.
+    /// \param[in] other The other vector, which must have the same maximum capacity as this empty, inline vector.
+    void take(std::small_vector<object_type,inline_value>& other)
+    {
+        if(other.spilled())
+        {
+            // Take the other vector's heap allocation.
+            small_vector::m_begin = other.m_begin;
+            small_vector::m_end = other.m_end;
+            small_vector::m_capacity = other.m_capacity;
+            other.m_begin = other.m_inline;
+            other.m_capacity = other.m_inline + inline_value;
+        }
+        else
+        {
+            // Move the other vector's inline objects.
+            for(auto source = other.m_begin; source < other.m_end; ++source)
+            {
+                *small_vector::m_end++ = std::move(*source);
+            }
+        }
+        other.m_end = other.m_begin;
+    }
+};
+
+/// \brief Erases all elements satisfying a predicate from a small vector.
+/// \tparam object_type The object type stored by the vector.
+/// \tparam inline_value The number of objects stored inline by the vector.
+/// \tparam predicate_type The type of the unary predicate.
+/// \param[in] vector The vector to erase elements from.
+/// \param[in] predicate The unary predicate, returning TRUE for elements to erase.
+/// \return The number of erased elements.
+template <typename object_type, std::size_t inline_value, typename predicate_type>
+std::size_t erase_if(std::small_vector<object_type,inline_value>& vector, predicate_type predicate)
+{
+    // Compact kept elements and truncate the vector.
+    std::size_t size = vector.size();
+    vector.erase(std::remove_if(vector.begin(), vector.end(), predicate), vector.end());
+
+    return size - vector.size();
+}
+/// \brief Erases all elements equal to a value from a small vector.
+/// \tparam object_type The object type stored by the vector.
+/// \tparam inline_value The number of objects stored inline by the vector.
+/// \param[in] vector The vector to erase elements from.
+/// \param[in] value The value to erase.
+/// \return The number of erased elements.
+template <typename object_type, std::size_t inline_value>
+std::size_t erase(std::small_vector<object_type,inline_value>& vector, const object_type& value)
+{
+    // Compact kept elements and truncate the vector.
+    std::size_t size = vector.size();
+    vector.erase(std::remove(vector.begin(), vector.end(), value), vector.end());
+
+    return size - vector.size();
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,272 @@
+/// \file std/container/dynamic/sparse_set.hpp
+/// \brief Defines the std::sparse_set template class.
+#ifndef STD___CONTAINER___DYNAMIC___SPARSE_SET_H
+#define STD___CONTAINER___DYNAMIC___SPARSE_SET_H
+
+// std
+#include <std/container/dynamic/base.hpp>
+#include <std/utility/forward.hpp>
+#include <std/utility/move.hpp>
+
+namespace std {
+
+/// \brief A dynamic container that maps small integer IDs to densely packed objects.
+/// \tparam object_type The object type stored by this container.
+/// \details Objects are stored densely in the container's contiguous memory alongside their IDs, and a sparse array
+/// indexed by ID holds each object's dense position. An ID is present only if its sparse entry points at a dense
+/// position holding the same ID, so stale sparse entries are harmless and clear runs in constant time.
+/// contains, find, insert, and erase (which moves the last object into the erased position) all run in constant time.
+template <typename object_type>
+class sparse_set
+    : protected std::container::dynamic::base<object_type>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty sparse set instance.
+    /// \param[in] capacity The maximum number of objects in this sparse set.
+    /// \param[in] id_limit The exclusive upper limit of IDs in this sparse set.
+    sparse_set(std::size_t capacity, std::size_t id_limit)
+        : std::container::dynamic::base<object_type>(capacity),
+          m_ids(new std::size_t[capacity]),
+          m_sparse(new std::size_t[id_limit]()),
+          m_id_limit(id_limit)
+    {}
+    /// \brief Copy-constructs a new sparse set from an existing sparse set.
+    /// \param[in] other The other sparse set to copy-construct from.
+    /// \note This performs a deep copy.
+    sparse_set(const std::sparse_set<object_type>& other)
+        : std::container::dynamic::base<object_type>(other),
+          m_ids(new std::size_t[other.capacity()]),
+          m_sparse(new std::size_t[other.m_id_limit]()),
+          m_id_limit(other.m_id_limit)
+    {
+        sparse_set::copy(other);
+    }
+    /// \brief Move-constructs a new sparse set from an existing sparse set.
+    /// \param[in] other The other sparse set to move-construct from.
+    sparse_set(std::sparse_set<object_type>&& other)
+        : sparse_set(other.capacity(), other.m_id_limit)
+    {
+        sparse_set::swap(other);
+    }
+    ~sparse_set()
+    {
+        // Clean up allocated memory.
+        delete [] sparse_set::m_ids;
+        delete [] sparse_set::m_sparse;
+    }
+
+    // ACCESS
+    using std::container::dynamic::base<object_type>::begin;
+    using std::container::dynamic::base<object_type>::end;
+    using std::container::dynamic::base<object_type>::cbegin;
+    using std::container::dynamic::base<object_type>::cend;
+    /// \brief Gets a reference to the object with a specified ID.
+    /// \param[in] id The ID of the object, which must be in the sparse set.
+    /// \return A reference to the object.
+    object_type& operator[](std::size_t id)
+    {
+        return sparse_set::m_begin[sparse_set::m_sparse[id]];
+    }
+    /// \brief Gets a const reference to the object with a specified ID.
+    /// \param[in] id The ID of the object, which must be in the sparse set.
+    /// \return A const reference to the object.
+    const object_type& operator[](std::size_t id) const
+    {
+        return sparse_set::m_begin[sparse_set::m_sparse[id]];
+    }
+    /// \brief Gets the ID of the object at a position in the dense storage.
+    /// \param[in] position The position of the object, from 0 to size() - 1.
+    /// \return The ID of the object.
+    std::size_t id(std::size_t position) const
+    {
+        return sparse_set::m_ids[position];
+    }
+
+    // LOOKUP
+    /// \brief Checks if the sparse set contains an object with a specified ID.
+    /// \param[in] id The ID to check.
+    /// \return TRUE if the sparse set contains the ID, otherwise FALSE.
+    bool contains(std::size_t id) const
+    {
+        if(id >= sparse_set::m_id_limit)
+        {
+            return false;
+        }
+        std::size_t position = sparse_set::m_sparse[id];
+        return position < sparse_set::size() && sparse_set::m_ids[position] == id;
+    }
+    /// \brief Finds the object with a specified ID.
+    /// \param[in] id The ID of the object.
+    /// \return A pointer to the object, or nullptr if the ID is not in the sparse set.
+    object_type* find(std::size_t id)
+    {
+        return sparse_set::contains(id) ? sparse_set::m_begin + sparse_set::m_sparse[id] : nullptr;
+    }
+    /// \brief Finds the object with a specified ID.
+    /// \param[in] id The ID of the object.
+    /// \return A const pointer to the object, or nullptr if the ID is not in the sparse set.
+    const object_type* find(std::size_t id) const
+    {
+        return sparse_set::contains(id) ? sparse_set::m_begin + sparse_set::m_sparse[id] : nullptr;
+    }
+
+    // MODIFIERS
+    /// \brief Inserts an object with a specified ID into the sparse set.
+    /// \param[in] id The ID of the object.
+    /// \param[in] value The object to copy into the sparse set.
+    /// \return TRUE if the object was inserted, FALSE if the ID is out of range or already present, or the sparse set
+    /// is at capacity.
+    bool insert(std::size_t id, const object_type& value)
+    {
+        if(!sparse_set::acquire(id))
+        {
+            return false;
+        }
+        *sparse_set::m_end++ = value;
+        return true;
+    }
+    /// \brief Inserts an object with a specified ID into the sparse set.
+    /// \param[in] id The ID of the object.
+    /// \param[in] value The object to move into the sparse set.
+    /// \return TRUE if the object was inserted, FALSE if the ID is out of range or already present, or the sparse set
+    /// is at capacity.
+    bool insert(std::size_t id, object_type&& value)
+    {
+        if(!sparse_set::acquire(id))
+        {
+            return false;
+        }
+        *sparse_set::m_end++ = std::move(value);
+        return true;
+    }
+    /// \brief Erases the object with a specified ID from the sparse set.
+    /// \param[in] id The ID of the object to erase.
+    /// \return TRUE if the object was erased, FALSE if the ID is not in the sparse set.
+    /// \details The last object is moved into the erased object's position, so the storage stays dense.
+    bool erase(std::size_t id)
+    {
+        // Verify the ID.
+        if(!sparse_set::contains(id))
+        {
+            return false;
+        }
+
+        // Move the last object into the erased position.
+        std::size_t position = sparse_set::m_sparse[id];
+        std::size_t last = sparse_set::size() - 1;
+        if(position != last)
+        {
+            sparse_set::m_begin[position] = std::move(sparse_set::m_begin[last]);
+            sparse_set::m_ids[position] = sparse_set::m_ids[last];
+            sparse_set::m_sparse[sparse_set::m_ids[position]] = position;
+        }
+        --sparse_set::m_end;
+
+        return true;
+    }
+    using std::container::dynamic::base<object_type>::clear;
+    /// \brief Swaps the contents of this sparse set with another sparse set.
+    /// \param[in] other The other sparse set to swap with.
+    void swap(std::sparse_set<object_type>& other)
+    {
+        std::container::dynamic::base<object_type>::swap(other);
+        auto ids = sparse_set::m_ids;
+        auto sparse = sparse_set::m_sparse;
+        auto id_limit = sparse_set::m_id_limit;
+        sparse_set::m_ids = other.m_ids;
+        sparse_set::m_sparse = other.m_sparse;
+        sparse_set::m_id_limit = other.m_id_limit;
+        other.m_ids = ids;
+        other.m_sparse = sparse;
+        other.m_id_limit = id_limit;
+    }
+    /// \brief Copy-assigns the contents of another sparse set to this sparse set.
+    /// \param[in] other The other sparse set to copy-assign from.
+    /// \return A reference to this sparse set.
+    /// \note This performs a deep copy.
+    std::sparse_set<object_type>& operator=(const std::sparse_set<object_type>& other)
+    {
+        // Check for self-assignment.
+        if(&other == this)
+        {
+            return *this;
+        }
+
+        // Use base container's operator= method, and reallocate the indices to match.
+        std::container::dynamic::base<object_type>::operator=(other);
+        delete [] sparse_set::m_ids;
+        delete [] sparse_set::m_sparse;
+        sparse_set::m_ids = new std::size_t[other.capacity()];
+        sparse_set::m_sparse = new std::size_t[other.m_id_limit]();
+        sparse_set::m_id_limit = other.m_id_limit;
+        sparse_set::copy(other);
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another sparse set to this sparse set.
+    /// \param[in] other The other sparse set to move-assign from.
+    /// \return A reference to this sparse set.
+    std::sparse_set<object_type>& operator=(std::sparse_set<object_type>&& other)
+    {
+        // Take the other sparse set's contents, leaving it this sparse set's memory.
+        sparse_set::swap(other);
+        other.clear();
+
+        return *this;
+    }
+
+    // CAPACITY
+    using std::container::dynamic::base<object_type>::size;
+    using std::container::dynamic::base<object_type>::capacity;
+    using std::container::dynamic::base<object_type>::empty;
+    using std::container::dynamic::base<object_type>::full;
+    /// \brief Gets the exclusive upper limit of IDs in the sparse set.
+    /// \return The ID limit of the sparse set.
+    std::size_t id_limit() const
+    {
+        return sparse_set::m_id_limit;
+    }
+
+private:
+    // MEMORY
+    /// \brief Stores the ID of each object in the dense storage.
+    std::size_t* m_ids;
+    /// \brief Stores the dense position of each ID. Entries for absent IDs are stale.
+    std::size_t* m_sparse;
+    /// \brief Stores the exclusive upper limit of IDs.
+    std::size_t m_id_limit;
+
+    /// \brief Registers an ID for an object appended to the dense storage.
+    /// \param[in] id The ID to register.
+    /// \return TRUE if the ID was registered, FALSE if the ID is out of range or already present, or the sparse set is
+    /// at capacity.
+    bool acquire(std::size_t id)
+    {
+        // Verify the ID and capacity.
+        if(id >= sparse_set::m_id_limit || sparse_set::full() || sparse_set::contains(id))
+        {
+            return false;
+        }
+
+        // Point the ID at the end of the dense storage.
+        std::size_t position = sparse_set::size();
+        sparse_set::m_ids[position] = id;
+        sparse_set::m_sparse[id] = position;
+        return true;
+    }
+    /// \brief Copies the IDs of another sparse set with the same capacity and ID limit.
+    /// \param[in] other The other sparse set to copy from.
+    void copy(const std::sparse_set<object_type>& other)
+    {
+        for(std::size_t position = 0; position < other.size(); ++position)
+        {
+            sparse_set::m_ids[position] = other.m_ids[position];
+            sparse_set::m_sparse[other.m_ids[position]] = position;
+        }
+    }
+};
+
+}
+
+#endif
\ No newline at end of file
@@ -4,7 +4,10 @@
 #define STD___CONTAINER___DYNAMIC___VECTOR_H
 
 // std
+#include <std/algorithm/remove.hpp>
 #include <std/container/dynamic/base.hpp>
+#include <std/utility/errc.hpp>
+#include <std/utility/expected.hpp>
 #include <std/utility/forward.hpp>
 
 namespace std {
@@ -33,6 +36,16 @@ public:
         : std::container::dynamic::base<object_type>(std::forward<std::vector<object_type>>(other))
     {}
 
+protected:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty vector instance over storage provided by a derived container.
+    /// \param[in] storage The storage for this vector.
+    /// \param[in] capacity The number of objects the storage can hold.
+    vector(object_type* storage, std::size_t capacity)
+        : std::container::dynamic::base<object_type>(storage, capacity)
+    {}
+
+public:
     // ACCESS
     /// \brief Gets a reference to the value at a specified index.
     /// \param[in] index The index of the value to get.
@@ -117,6 +130,17 @@ public:
         // Indicate success.
         return true;
     }
+    /// \brief Appends a new object to the end of this vector, or reports why it could not.
+    /// \param[in] value The value to append.
+    /// \return An iterator to the appended object, or std::errc::no_buffer_space if this vector is at capacity.
+    std::expected<std::iterator<object_type>,std::errc> try_push_back(const object_type& value)
+    {
+        if(!vector::push_back(value))
+        {
+            return std::make_unexpected(std::errc::no_buffer_space);
+        }
+        return vector::m_end - 1;
+    }
     /// \brief Removes the last object from this vector.
     void pop_back()
     {
@@ -147,6 +171,75 @@ public:
         // Return the position, as it contains the new value.
         return position;
     }
+    /// \brief Inserts copies of a value into this vector at a specified position.
+    /// \param[in] position The position to insert the values at.
+    /// \param[in] count The number of copies to insert.
+    /// \param[in] value The value to insert.
+    /// \return An iterator to the first inserted object. NULLPTR if vector does not have enough capacity.
+    /// \details Existing elements are shifted once by count, rather than once per inserted value.
+    std::iterator<object_type> insert(std::iterator<object_type> position, std::size_t count, const object_type& value)
+    {
+        // Try to shift right at the specified position.
+        if(!vector::shift_right(position, count))
+        {
+            return nullptr;
+        }
+
+        // Copy value into the opened positions.
+        for(auto entry = position; entry < position + count; ++entry)
+        {
+            *entry = value;
+        }
+
+        // Return the position, as it contains the first new value.
+        return position;
+    }
+    /// \brief Inserts a range of values into this vector at a specified position.
+    /// \param[in] position The position to insert the values at.
+    /// \param[in] begin An iterator to the beginning of the range to copy.
+    /// \param[in] end An iterator to the end of the range to copy.
+    /// \return An iterator to the first inserted object. NULLPTR if vector does not have enough capacity.
+    /// \details Existing elements are shifted once by the size of the range, rather than once per inserted value.
+    /// \note The range must not be part of this vector.
+    std::iterator<object_type> insert(std::iterator<object_type> position, std::const_iterator<object_type> begin, std::const_iterator<object_type> end)
+    {
+        // Try to shift right at the specified position.
+        if(!vector::shift_right(position, end - begin))
+        {
+            return nullptr;
+        }
+
+        // Copy values into the opened positions.
+        auto destination = position;
+        while(begin < end)
+        {
+            *destination++ = *begin++;
+        }
+
+        // Return the position, as it contains the first new value.
+        return position;
+    }
+    /// \brief Appends a range of values to the end of this vector.
+    /// \param[in] begin An iterator to the beginning of the range to copy.
+    /// \param[in] end An iterator to the end of the range to copy.
+    /// \return TRUE if the operation succeeded, FALSE if this vector does not have enough capacity.
+    bool append(std::const_iterator<object_type> begin, std::const_iterator<object_type> end)
+    {
+        // Verify space in the container.
+        if(vector::m_capacity - vector::m_end < end - begin)
+        {
+            return false;
+        }
+
+        // Copy values to the end.
+        while(begin < end)
+        {
+            *vector::m_end++ = *begin++;
+        }
+
+        // Indicate success.
+        return true;
+    }
     /// \brief Assigns a size and value to this vector.
     /// \param[in] value The value to set all elements to.
     /// \param[in] count The size to set this vector to.
@@ -296,6 +389,41 @@ public:
     }
 };
 
+/// \brief Erases all elements satisfying a predicate from a vector.
+/// \tparam object_type The object type stored by the vector.
+/// \tparam predicate_type The type of the unary predicate.
+/// \param[in] vector The vector to erase elements from.
+/// \param[in] predicate The unary predicate, returning TRUE for elements to erase.
+/// \return The number of erased elements.
+/// \details Kept elements are compacted in a single pass, rather than shifting the vector once per erased element.
+template <typename object_type, typename predicate_type>
+std::size_t erase_if(std::vector<object_type>& vector, predicate_type predicate)
+{
+    // Compact kept elements and truncate the vector.
+    std::size_t size = vector.size();
+    vector.erase(std::remove_if(vector.begin(), vector.end(), predicate), vector.end());
+
+    return size - vector.size();
 }
+/// \brief Erases all elements equal to a value from a vector.
+/// \tparam object_type The object type stored by the vector.
+/// \param[in] vector The vector to erase elements from.
+/// \param[in] value The value to erase.
+/// \return The number of erased elements.
+/// \details Kept elements are compacted in a single pass, rather than shifting the vector once per erased element.
+template <typename object_type>
+std::size_t erase(std::vector<object_type>& vector, const object_type& value)
+{
+    // Compact kept elements and truncate the vector.
+    std::size_t size = vector.size();
+    vector.erase(std::remove(vector.begin(), vector.end(), value), vector.end());
+
+    return size - vector.size();
+}
+
+}
+
+// Bit-packed std::vector<bool> specialization.
+#include <std/container/dynamic/vector_bool.hpp>
 
 #endif
\ No newline at end of file
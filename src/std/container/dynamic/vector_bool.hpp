@@ -0,0 +1,338 @@
+/// \file std/container/dynamic/vector_bool.hpp
+/// \brief Defines the bit-packed std::vector<bool> template specialization.
+#ifndef STD___CONTAINER___DYNAMIC___VECTOR_BOOL_H
+#define STD___CONTAINER___DYNAMIC___VECTOR_BOOL_H
+
+// std
+#include <std/container/bits.hpp>
+#include <std/container/dynamic/bitset.hpp>
+#include <std/container/dynamic/vector.hpp>
+#include <std/utility/forward.hpp>
+
+namespace std {
+
+/// \brief A dynamic container that stores a sequence of bools, packed into machine words.
+/// \details Elements are accessed through proxy references and iterators, as individual bits are not addressable.
+/// Bulk operations such as assign and resize operate on whole words.
+template <>
+class vector<bool>
+    : public std::dynamic_bitset
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty vector instance.
+    /// \param[in] capacity The maximum capacity of this vector.
+    vector(std::size_t capacity)
+        : std::dynamic_bitset(capacity)
+    {}
+    /// \brief Copy-constructs a new vector from an existing vector.
+    /// \param[in] other The other vector to copy-construct from.
+    vector(const std::vector<bool>& other)
+        : std::dynamic_bitset(other)
+    {}
+    /// \brief Move-constructs a new vector from an existing vector.
+    /// \param[in] other The other vector to move-construct from.
+    vector(std::vector<bool>&& other)
+        : std::dynamic_bitset(std::forward<std::vector<bool>>(other))
+    {}
+
+    // ACCESS
+    /// \brief Gets a reference to the value at a specified index.
+    /// \param[in] index The index of the value to get.
+    /// \return A proxy reference to the value.
+    std::container::bits::reference at(std::size_t index)
+    {
+        return vector::operator[](index);
+    }
+    /// \brief Gets the value at a specified index.
+    /// \param[in] index The index of the value to get.
+    /// \return The value.
+    bool at(std::size_t index) const
+    {
+        return vector::operator[](index);
+    }
+    /// \brief Gets a reference to the first value in this vector.
+    /// \return A proxy reference to the first value.
+    std::container::bits::reference front()
+    {
+        return vector::operator[](0);
+    }
+    /// \brief Gets the first value in this vector.
+    /// \return The first value.
+    bool front() const
+    {
+        return vector::operator[](0);
+    }
+    /// \brief Gets a reference to the last value in this vector.
+    /// \return A proxy reference to the last value.
+    std::container::bits::reference back()
+    {
+        return vector::operator[](vector::m_size - 1);
+    }
+    /// \brief Gets the last value in this vector.
+    /// \return The last value.
+    bool back() const
+    {
+        return vector::operator[](vector::m_size - 1);
+    }
+    /// \brief Gets an iterator to the beginning of this vector.
+    /// \return The begin iterator.
+    std::container::bits::iterator begin()
+    {
+        return std::container::bits::iterator(vector::m_data, 0);
+    }
+    /// \brief Gets an iterator to the end of this vector.
+    /// \return The end iterator.
+    std::container::bits::iterator end()
+    {
+        return std::container::bits::iterator(vector::m_data, vector::m_size);
+    }
+    /// \brief Gets a const_iterator to the beginning of this vector.
+    /// \return The begin const_iterator.
+    std::container::bits::const_iterator cbegin() const
+    {
+        return std::container::bits::const_iterator(vector::m_data, 0);
+    }
+    /// \brief Gets a const_iterator to the end of this vector.
+    /// \return The end const_iterator.
+    std::container::bits::const_iterator cend() const
+    {
+        return std::container::bits::const_iterator(vector::m_data, vector::m_size);
+    }
+
+    // MODIFIERS
+    /// \brief Inserts a value into this vector at a specified position.
+    /// \param[in] position The position to insert the value at.
+    /// \param[in] value The value to insert.
+    /// \return An iterator to the inserted value. vector::end() if this vector is at capacity or the position is past
+    /// the end of this vector.
+    std::container::bits::iterator insert(std::container::bits::const_iterator position, bool value)
+    {
+        // Verify container space and the position.
+        if(vector::m_size == vector::m_capacity || position.position() > vector::m_size)
+        {
+            return vector::end();
+        }
+
+        // Clear a newly used word before shifting into it.
+        if(vector::m_size % std::container::bits::word_size == 0)
+        {
+            vector::m_data[std::container::bits::word_index(vector::m_size)] = 0;
+        }
+        ++vector::m_size;
+
+        // Shift whole words above the insertion word up by one bit, carrying in the top bit of the word below.
+        std::size_t index = position.position();
+        std::size_t first = std::container::bits::word_index(index);
+        for(std::size_t i = vector::words() - 1; i > first; --i)
+        {
+            vector::m_data[i] = (vector::m_data[i] << 1) | (vector::m_data[i - 1] >> (std::container::bits::word_size - 1));
+        }
+
+        // Shift the upper part of the insertion word up by one bit.
+        std::container::bits::word lower = std::container::bits::mask(index) - 1;
+        vector::m_data[first] = (vector::m_data[first] & lower) | ((vector::m_data[first] & ~lower) << 1);
+
+        // Set the value and clear any bit shifted past the end.
+        vector::set(index, value);
+        std::container::bits::trim(vector::m_data, vector::m_size);
+
+        return std::container::bits::iterator(vector::m_data, index);
+    }
+    /// \brief Erases a value from this vector.
+    /// \param[in] position The position of the value to erase.
+    /// \return An iterator to the value after the erased value. The end iterator if the position is not in this vector.
+    std::container::bits::iterator erase(std::container::bits::const_iterator position)
+    {
+        // Verify the position is within this vector.
+        std::size_t index = position.position();
+        if(index >= vector::m_size)
+        {
+            return vector::end();
+        }
+
+        // Shift the upper part of the erased word down by one bit, carrying in the bottom bit of the word above.
+        std::size_t first = std::container::bits::word_index(index);
+        std::size_t words = vector::words();
+        std::container::bits::word lower = std::container::bits::mask(index) - 1;
+        vector::m_data[first] = (vector::m_data[first] & lower) | ((vector::m_data[first] >> 1) & ~lower);
+
+        // Shift whole words above the erased word down by one bit.
+        for(std::size_t i = first + 1; i < words; ++i)
+        {
+            vector::m_data[i - 1] |= vector::m_data[i] << (std::container::bits::word_size - 1);
+            vector::m_data[i] >>= 1;
+        }
+
+        // Reduce size.
+        --vector::m_size;
+
+        return std::container::bits::iterator(vector::m_data, index);
+    }
+    /// \brief Erases a range of values from this vector.
+    /// \param[in] begin The position of the first value to erase.
+    /// \param[in] end The position after the last value to erase.
+    /// \return An iterator to the value after the last erased value. The end iterator if the range is not in this vector.
+    /// \details The values after the range are shifted down a whole word at a time.
+    std::container::bits::iterator erase(std::container::bits::const_iterator begin, std::container::bits::const_iterator end)
+    {
+        // Verify the range is within this vector.
+        std::size_t index = begin.position();
+        if(index >= vector::m_size || end.position() > vector::m_size)
+        {
+            return vector::end();
+        }
+
+        // Shortcut if the range is empty or reversed.
+        if(end.position() <= index)
+        {
+            return std::container::bits::iterator(vector::m_data, index);
+        }
+        std::size_t count = end.position() - index;
+
+        // Capture the values below the range in its first word, as the shift overwrites them.
+        std::size_t first = std::container::bits::word_index(index);
+        std::container::bits::word lower = std::container::bits::mask(index) - 1;
+        std::container::bits::word kept = vector::m_data[first] & lower;
+
+        // Shift the words from the first word onward down by the size of the range, and restore the lower values.
+        std::container::bits::shift_right(vector::m_data + first, vector::words() - first, count);
+        vector::m_data[first] = kept | (vector::m_data[first] & ~lower);
+
+        // Reduce size.
+        vector::m_size -= count;
+
+        return std::container::bits::iterator(vector::m_data, index);
+    }
+    /// \brief Assigns a size and value to this vector.
+    /// \param[in] value The value to set all elements to.
+    /// \param[in] count The size to set this vector to.
+    /// \return TRUE if the assignment succeeded, FALSE if this vector does not have enough capacity.
+    bool assign(bool value, std::size_t count)
+    {
+        // Verify space in the container.
+        if(count > vector::m_capacity)
+        {
+            return false;
+        }
+
+        // Update size and assign whole words.
+        vector::m_size = count;
+        std::container::bits::fill(vector::m_data, vector::words(), value ? ~std::container::bits::word(0) : 0);
+        std::container::bits::trim(vector::m_data, vector::m_size);
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Assigns a range of values to this vector.
+    /// \param[in] begin An iterator to the beginning of the range to copy.
+    /// \param[in] end An iterator to the end of the range to copy.
+    /// \return TRUE if the assignment succeeded, FALSE if this vector does not have enough capacity.
+    bool assign(std::container::bits::const_iterator begin, std::container::bits::const_iterator end)
+    {
+        // Calculate number of elements.
+        std::size_t count = end - begin;
+
+        // Verify space in the container.
+        if(count > vector::m_capacity)
+        {
+            return false;
+        }
+
+        // Clear words and update size.
+        vector::m_size = count;
+        std::container::bits::fill(vector::m_data, vector::words(), 0);
+
+        // Copy set bits.
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            if(begin[i])
+            {
+                vector::m_data[std::container::bits::word_index(i)] |= std::container::bits::mask(i);
+            }
+        }
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Assigns a range of values to this vector.
+    /// \param[in] begin An iterator to the beginning of the range of bools to copy.
+    /// \param[in] end An iterator to the end of the range of bools to copy.
+    /// \return TRUE if the assignment succeeded, FALSE if this vector does not have enough capacity.
+    bool assign(std::const_iterator<bool> begin, std::const_iterator<bool> end)
+    {
+        // Calculate number of elements.
+        std::size_t count = end - begin;
+
+        // Verify space in the container.
+        if(count > vector::m_capacity)
+        {
+            return false;
+        }
+
+        // Clear words and update size.
+        vector::m_size = count;
+        std::container::bits::fill(vector::m_data, vector::words(), 0);
+
+        // Copy set bits.
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            if(begin[i])
+            {
+                vector::m_data[std::container::bits::word_index(i)] |= std::container::bits::mask(i);
+            }
+        }
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Swaps the contents of this vector with another vector.
+    /// \param[in] other The other vector to swap with.
+    void swap(std::vector<bool>& other)
+    {
+        // Use base bitset's swap method.
+        std::dynamic_bitset::swap(other);
+    }
+    /// \brief Copy-assigns the contents of another vector to this vector.
+    /// \param[in] other The other vector to copy-assign from.
+    /// \return A reference to this vector.
+    std::vector<bool>& operator=(const std::vector<bool>& other)
+    {
+        // Use base bitset's operator= method.
+        std::dynamic_bitset::operator=(other);
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another vector to this vector.
+    /// \param[in] other The other vector to move-assign from.
+    /// \return A reference to this vector.
+    std::vector<bool>& operator=(std::vector<bool>&& other)
+    {
+        // Use base bitset's operator= method.
+        std::dynamic_bitset::operator=(std::forward<std::vector<bool>>(other));
+
+        return *this;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this vector is equal to another vector.
+    /// \param[in] other The other vector to compare with.
+    /// \return TRUE if the two vectors are equal, otherwise FALSE.
+    bool operator==(const std::vector<bool>& other) const
+    {
+        // Use base bitset's operator== method.
+        return std::dynamic_bitset::operator==(other);
+    }
+    /// \brief Checks if this vector is unequal with another vector.
+    /// \param[in] other The other vector to compare with.
+    /// \return TRUE if the two vectors are unequal, otherwise FALSE.
+    bool operator!=(const std::vector<bool>& other) const
+    {
+        // Use base bitset's operator!= method.
+        return std::dynamic_bitset::operator!=(other);
+    }
+};
+
+}
+
+#endif
\ No newline at end of file
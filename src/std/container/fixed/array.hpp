@@ -5,6 +5,7 @@
 
 // std
 #include <std/container/fixed/base.hpp>
+#include <std/utility/integer_sequence.hpp>
 
 namespace std {
 
@@ -17,14 +18,15 @@ class array
 {
 public:
     // CONSTRUCTORS
-    /// \brief Constructs a new array instance.
+    /// \brief Constructs a new array instance with default-initialized elements.
     array() = default;
+    /// \brief Inherits the constructor that takes a value for each element.
+    /// \note This enables brace initialization (e.g. std::array<int,3> a = {1, 2, 3};), including in constexpr
+    /// contexts. A value must be provided for every element.
+    using std::container::fixed::base<object_type,size_value>::base;
     /// \brief Copy constructs a new array instance from another.
     /// \param[in] other The other array to copy construct from.
-    array(const std::array<object_type,size_value>& other)
-        : std::container::fixed::base<object_type,size_value>(other)
-    {}
-    array(std::array<object_type,size_value>&& other) = delete;
+    array(const std::array<object_type,size_value>& other) = default;
 
     // ACCESS
     /// \brief Gets a reference to the value at a specified index.
@@ -32,64 +34,64 @@ public:
     /// \return A reference to the value.
     object_type& operator[](std::size_t index)
     {
-        return *(array::m_begin + index);
+        return array::m_data[index];
     }
     /// \brief Gets a const reference to the value at a specified index.
     /// \param[in] index The index of the value to get.
     /// \return A const reference to the value.
-    const object_type& operator[](std::size_t index) const
+    constexpr const object_type& operator[](std::size_t index) const
     {
-        return *(array::m_begin + index);
+        return array::m_data[index];
     }
     /// \brief Gets a reference to the value at a specified index.
     /// \param[in] index The index of the value to get.
     /// \return A reference to the value.
     object_type& at(std::size_t index)
     {
-        return *(array::m_begin + index);
+        return array::m_data[index];
     }
     /// \brief Gets a const reference to the value at a specified index.
     /// \param[in] index The index of the value to get.
     /// \return A const reference to the value.
-    const object_type& at(std::size_t index) const
+    constexpr const object_type& at(std::size_t index) const
     {
-        return *(array::m_begin + index);
+        return array::m_data[index];
     }
     /// \brief Gets a reference to the first value in the vector.
     /// \return A reference to the first value.
     object_type& front()
     {
-        return *array::m_begin;
+        return array::m_data[0];
     }
     /// \brief Gets a const reference to the first value in the vector.
     /// \return A const reference to the first value.
-    const object_type& front() const
+    constexpr const object_type& front() const
     {
-        return *array::m_begin;
+        return array::m_data[0];
     }
     /// \brief Gets a reference to the last value in the vector.
     /// \return A reference to the last value.
     object_type& back()
     {
-        return *(array::m_end - 1);
+        return array::m_data[size_value - 1];
     }
     /// \brief Gets a const reference to the last value in the vector.
     /// \return A const reference to the last value.
-    const object_type& back() const
+    constexpr const object_type& back() const
     {
-        return *(array::m_end - 1);
+        return array::m_data[size_value - 1];
     }
     /// \brief Gets a pointer to the vector's underlying data.
     /// \return A pointer to the underlying data.
     object_type* data()
     {
-        return array::m_begin;
+        return array::m_data;
     }
     /// \brief Gets a const pointer to the vector's underlying data.
     /// \return A const pointer to the underlying data.
-    const object_type* data() const
+    constexpr const object_type* data() const
     {
-        return array::m_begin;
+        return array::m_data;
     }
 
     // MODIFIERS
@@ -97,46 +99,23 @@ public:
     /// \param[in] value The value to assign.
     void fill(const object_type& value)
     {
-        // Iterate through the array and assign the value.
-        for(auto entry = array::m_begin; entry != array::m_end; ++entry)
-        {
-            *entry = value;
-        }
+        std::container::fixed::block<object_type,size_value>::fill(array::m_data, value);
     }
     /// \brief Swaps the contents of this array with another array.
     /// \param[in] other The other array to swap contents with.
     void swap(std::array<object_type,size_value>& other)
     {
-        // Create a temporary for swapping.
-        object_type temporary;
-
-        // Iterate through both arrays.
-        auto this_entry = array::m_begin;
-        auto other_entry = other.m_begin;
-        while(this_entry < array::m_end)
-        {
-            // Store other in temporary.
-            temporary = *other_entry;
-
-            // Store this in other and increment other.
-            *other_entry++ = *this_entry;
-
-            // Store temporary into this and increment this.
-            *this_entry++ = temporary;
-        }
+        std::container::fixed::block<object_type,size_value>::swap(array::m_data, other.m_data);
     }
     /// \brief Deep-copies another array into this array.
     /// \param[in] other The other array to copy from.
     /// \return A reference to this array.
     std::array<object_type,size_value>& operator=(const std::array<object_type,size_value>& other)
     {
-        // Iterate through both arrays.
-        auto this_entry = array::m_begin;
-        auto other_entry = other.m_begin;
-        while(this_entry < array::m_end)
+        // Check for self-assignment, as memcpy requires non-overlapping memory.
+        if(&other != this)
         {
-            // Copy value of other to this array.
-            *this_entry++ = *other_entry++;
+            std::container::fixed::block<object_type,size_value>::copy(array::m_data, other.m_data);
         }
 
         return *this;
@@ -159,6 +138,38 @@ public:
     }
 };
 
+namespace container::fixed {
+
+/// \brief Generates an array by invoking a generator for each index.
+/// \tparam object_type The type of object stored in the array.
+/// \tparam size_value The size of the array.
+/// \tparam generator_type The type of the generator.
+/// \tparam index_values The indices of the array.
+/// \param[in] generator The generator to invoke for each index.
+/// \return The generated array.
+template <typename object_type, std::size_t size_value, typename generator_type, std::size_t... index_values>
+constexpr std::array<object_type,size_value> generate(generator_type generator, std::index_sequence<index_values...>)
+{
+    return std::array<object_type,size_value>(generator(index_values)...);
+}
+
+}
+
+/// \brief Generates an array by invoking a generator for each index.
+/// \tparam object_type The type of object stored in the array.
+/// \tparam size_value The size of the array.
+/// \tparam generator_type The type of the generator, which must be callable as object_type(std::size_t).
+/// \param[in] generator The generator to invoke for each index.
+/// \return The generated array, where element i is generator(i).
+/// \details When the generator is a constexpr function, the array is generated at compile time. This allows lookup
+/// tables (CRC, sine, gamma, etc.) to be built by the compiler instead of at runtime, for example:
+/// constexpr std::array<uint8_t,16> squares = std::generate_array<uint8_t,16>(square);
+template <typename object_type, std::size_t size_value, typename generator_type>
+constexpr std::array<object_type,size_value> generate_array(generator_type generator)
+{
+    return std::container::fixed::generate<object_type,size_value>(generator, std::make_index_sequence<size_value>());
+}
+
 }
 
 #endif
\ No newline at end of file
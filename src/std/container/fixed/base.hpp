@@ -4,8 +4,15 @@
 #define STD___CONTAINER___FIXED___BASE_H
 
 // std
+#include <std/algorithm/compare.hpp>
 #include <std/container/iterator.hpp>
+#include <std/container/reverse_iterator.hpp>
 #include <std/stddef.hpp>
+#include <std/utility/enable_if.hpp>
+#include <std/utility/has_unique_object_representations.hpp>
+#include <std/utility/integer_sequence.hpp>
+#include <std/utility/is_trivially_copyable.hpp>
+#include <std/utility/swap.hpp>
 
 // arduino
 #include <Arduino.h>
@@ -15,121 +22,446 @@ namespace std::container {
 /// \brief Contains all code for std fixed container components.
 namespace fixed {
 
+/// \brief The largest container size for which element-wise operations are unrolled at compile time.
+constexpr std::size_t unroll_limit = 8;
+
+/// \brief A tag type for selecting an implementation by a compile-time condition.
+/// \tparam value The compile-time condition.
+template <bool value>
+struct select
+{};
+
+/// \brief Unrolls element-wise operations over a compile-time number of elements.
+/// \tparam count_value The number of elements to unroll over.
+/// \details Each operation recurses into the next element at compile time, which the compiler flattens into straight
+/// line code without a loop counter or branch.
+template <std::size_t count_value>
+struct unroll
+{
+    /// \brief Assigns a value to each element.
+    /// \tparam object_type The type of the elements.
+    /// \param[in] data The elements to assign.
+    /// \param[in] value The value to assign.
+    template <typename object_type>
+    static void fill(object_type* data, const object_type& value)
+    {
+        *data = value;
+        std::container::fixed::unroll<count_value - 1>::fill(data + 1, value);
+    }
+    /// \brief Copies each element.
+    /// \tparam object_type The type of the elements.
+    /// \param[in] destination The elements to copy to.
+    /// \param[in] source The elements to copy from.
+    template <typename object_type>
+    static void copy(object_type* destination, const object_type* source)
+    {
+        *destination = *source;
+        std::container::fixed::unroll<count_value - 1>::copy(destination + 1, source + 1);
+    }
+    /// \brief Swaps each pair of elements.
+    /// \tparam object_type The type of the elements.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    template <typename object_type>
+    static void swap(object_type* a, object_type* b)
+    {
+        std::swap(*a, *b);
+        std::container::fixed::unroll<count_value - 1>::swap(a + 1, b + 1);
+    }
+    /// \brief Checks if each pair of elements is equal.
+    /// \tparam object_type The type of the elements.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    /// \return TRUE if all pairs are equal, otherwise FALSE.
+    template <typename object_type>
+    static bool equal(const object_type* a, const object_type* b)
+    {
+        return !(*a != *b) && std::container::fixed::unroll<count_value - 1>::equal(a + 1, b + 1);
+    }
+};
+/// \brief Terminates element-wise operation unrolling.
+template <>
+struct unroll<0>
+{
+    /// \brief Assigns a value to no elements.
+    /// \tparam object_type The type of the elements.
+    template <typename object_type>
+    static void fill(object_type*, const object_type&)
+    {}
+    /// \brief Copies no elements.
+    /// \tparam object_type The type of the elements.
+    template <typename object_type>
+    static void copy(object_type*, const object_type*)
+    {}
+    /// \brief Swaps no elements.
+    /// \tparam object_type The type of the elements.
+    template <typename object_type>
+    static void swap(object_type*, object_type*)
+    {}
+    /// \brief Checks if no elements are equal.
+    /// \tparam object_type The type of the elements.
+    /// \return TRUE.
+    template <typename object_type>
+    static bool equal(const object_type*, const object_type*)
+    {
+        return true;
+    }
+};
+
+/// \brief Performs whole-container operations on a fixed number of elements.
+/// \tparam object_type The type of the elements.
+/// \tparam size_value The number of elements.
+/// \details Operations use memset, memcpy, and memcmp where the element type allows. Otherwise, they are unrolled at
+/// compile time for containers of up to unroll_limit elements, and loop over larger containers.
+template <typename object_type, std::size_t size_value>
+struct block
+{
+    /// \brief Assigns a value to each element.
+    /// \param[in] data The elements to assign.
+    /// \param[in] value The value to assign.
+    static void fill(object_type* data, const object_type& value)
+    {
+        block::fill(data, value, std::container::fixed::select<std::is_trivially_copyable<object_type>::value>());
+    }
+    /// \brief Copies each element.
+    /// \param[in] destination The elements to copy to.
+    /// \param[in] source The elements to copy from, which must not overlap the destination.
+    static void copy(object_type* destination, const object_type* source)
+    {
+        block::copy(destination, source, std::container::fixed::select<std::is_trivially_copyable<object_type>::value>());
+    }
+    /// \brief Swaps each pair of elements.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    /// \details Elements are exchanged with std::swap, which moves rather than copies.
+    static void swap(object_type* a, object_type* b)
+    {
+        block::swap(a, b, std::container::fixed::select<size_value <= std::container::fixed::unroll_limit>());
+    }
+    /// \brief Checks if each pair of elements is equal.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    /// \return TRUE if all pairs are equal, otherwise FALSE.
+    static bool equal(const object_type* a, const object_type* b)
+    {
+        return block::equal(a, b, std::container::fixed::select<std::has_unique_object_representations<object_type>::value>());
+    }
+
+private:
+    // FILL
+    /// \brief Assigns a value to each trivially copyable element, with memset if the value's bytes are all equal.
+    /// \param[in] data The elements to assign.
+    /// \param[in] value The value to assign.
+    static void fill(object_type* data, const object_type& value, std::container::fixed::select<true>)
+    {
+        // Check if the value is a single repeated byte (e.g. zero).
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+        std::size_t i = 1;
+        while(i < sizeof(object_type) && bytes[i] == bytes[0])
+        {
+            ++i;
+        }
+
+        if(i == sizeof(object_type))
+        {
+            memset(data, bytes[0], sizeof(object_type) * size_value);
+        }
+        else
+        {
+            block::fill(data, value, std::container::fixed::select<false>());
+        }
+    }
+    /// \brief Assigns a value to each element.
+    /// \param[in] data The elements to assign.
+    /// \param[in] value The value to assign.
+    static void fill(object_type* data, const object_type& value, std::container::fixed::select<false>)
+    {
+        block::fill(data, value, std::container::fixed::select<false>(), std::container::fixed::select<size_value <= std::container::fixed::unroll_limit>());
+    }
+    /// \brief Assigns a value to each element with unrolled code.
+    /// \param[in] data The elements to assign.
+    /// \param[in] value The value to assign.
+    static void fill(object_type* data, const object_type& value, std::container::fixed::select<false>, std::container::fixed::select<true>)
+    {
+        std::container::fixed::unroll<size_value>::fill(data, value);
+    }
+    /// \brief Assigns a value to each element with a loop.
+    /// \param[in] data The elements to assign.
+    /// \param[in] value The value to assign.
+    static void fill(object_type* data, const object_type& value, std::container::fixed::select<false>, std::container::fixed::select<false>)
+    {
+        for(object_type* end = data + size_value; data != end; ++data)
+        {
+            *data = value;
+        }
+    }
+
+    // COPY
+    /// \brief Copies each trivially copyable element with memcpy.
+    /// \param[in] destination The elements to copy to.
+    /// \param[in] source The elements to copy from.
+    static void copy(object_type* destination, const object_type* source, std::container::fixed::select<true>)
+    {
+        memcpy(destination, source, sizeof(object_type) * size_value);
+    }
+    /// \brief Copies each element.
+    /// \param[in] destination The elements to copy to.
+    /// \param[in] source The elements to copy from.
+    static void copy(object_type* destination, const object_type* source, std::container::fixed::select<false>)
+    {
+        block::copy(destination, source, std::container::fixed::select<false>(), std::container::fixed::select<size_value <= std::container::fixed::unroll_limit>());
+    }
+    /// \brief Copies each element with unrolled code.
+    /// \param[in] destination The elements to copy to.
+    /// \param[in] source The elements to copy from.
+    static void copy(object_type* destination, const object_type* source, std::container::fixed::select<false>, std::container::fixed::select<true>)
+    {
+        std::container::fixed::unroll<size_value>::copy(destination, source);
+    }
+    /// \brief Copies each element with a loop.
+    /// \param[in] destination The elements to copy to.
+    /// \param[in] source The elements to copy from.
+    static void copy(object_type* destination, const object_type* source, std::container::fixed::select<false>, std::container::fixed::select<false>)
+    {
+        for(object_type* end = destination + size_value; destination != end;)
+        {
+            *destination++ = *source++;
+        }
+    }
+
+    // SWAP
+    /// \brief Swaps each pair of elements with unrolled code.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    static void swap(object_type* a, object_type* b, std::container::fixed::select<true>)
+    {
+        std::container::fixed::unroll<size_value>::swap(a, b);
+    }
+    /// \brief Swaps each pair of elements with a loop.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    static void swap(object_type* a, object_type* b, std::container::fixed::select<false>)
+    {
+        for(object_type* end = a + size_value; a != end;)
+        {
+            std::swap(*a++, *b++);
+        }
+    }
+
+    // EQUAL
+    /// \brief Checks if each pair of elements with unique object representations is equal with memcmp.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    /// \return TRUE if all pairs are equal, otherwise FALSE.
+    static bool equal(const object_type* a, const object_type* b, std::container::fixed::select<true>)
+    {
+        return memcmp(a, b, sizeof(object_type) * size_value) == 0;
+    }
+    /// \brief Checks if each pair of elements is equal.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    /// \return TRUE if all pairs are equal, otherwise FALSE.
+    static bool equal(const object_type* a, const object_type* b, std::container::fixed::select<false>)
+    {
+        return block::equal(a, b, std::container::fixed::select<false>(), std::container::fixed::select<size_value <= std::container::fixed::unroll_limit>());
+    }
+    /// \brief Checks if each pair of elements is equal with unrolled code.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    /// \return TRUE if all pairs are equal, otherwise FALSE.
+    static bool equal(const object_type* a, const object_type* b, std::container::fixed::select<false>, std::container::fixed::select<true>)
+    {
+        return std::container::fixed::unroll<size_value>::equal(a, b);
+    }
+    /// \brief Checks if each pair of elements is equal with a loop.
+    /// \param[in] a The first elements.
+    /// \param[in] b The second elements.
+    /// \return TRUE if all pairs are equal, otherwise FALSE.
+    static bool equal(const object_type* a, const object_type* b, std::container::fixed::select<false>, std::container::fixed::select<false>)
+    {
+        for(const object_type* end = a + size_value; a != end;)
+        {
+            if(*a++ != *b++)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+/// \brief Names a type once for each index of a parameter pack.
+/// \tparam object_type The type to name.
+/// \tparam index_value The index, which is ignored.
+template <typename object_type, std::size_t index_value>
+using repeat = object_type;
+
 /// \brief A base fixed-size container.
 /// \tparam object_type The type of object stored in the container.
 /// \tparam size_value The size of the container.
-template <typename object_type, std::size_t size_value>
-class base
+/// \tparam sequence_type The index sequence of the container's elements, which sizes the value constructor.
+template <typename object_type, std::size_t size_value, typename sequence_type = std::make_index_sequence<size_value>>
+class base;
+
+/// \brief A base fixed-size container.
+/// \tparam object_type The type of object stored in the container.
+/// \tparam size_value The size of the container.
+/// \tparam index_values The indices of the container's elements.
+/// \details The container is a literal type when object_type is, so it may be constant-initialized, used in constexpr
+/// contexts, and placed in flash memory.
+template <typename object_type, std::size_t size_value, std::size_t... index_values>
+class base<object_type,size_value,std::index_sequence<index_values...>>
 {
 public:
     // CONSTRUCTORS
-    /// \brief Constructs a new base fixed container instance.
-    base()
-        : m_begin(&m_data[0]),
-          m_end(m_begin + size_value)
+    /// \brief Constructs a new base fixed container instance with default-initialized elements.
+    base() = default;
+    /// \brief Constructs a new base fixed container instance from a value for each element.
+    /// \param[in] values The values of the elements.
+    /// \tparam count_value The number of values, which must be nonzero so that this does not collide with the default
+    /// constructor of an empty container.
+    /// \note Each value is taken as an object_type, so brace initialization reports narrowing conversions.
+    template <std::size_t count_value = sizeof...(index_values), typename std::enable_if<(count_value > 0),int>::type = 0>
+    constexpr base(const std::container::fixed::repeat<object_type,index_values>&... values)
+        : m_data{values...}
     {}
     /// \brief Copy constructs a new base fixed container instance from another.
     /// \param[in] other The other container to copy construct from.
-    base(const std::container::fixed::base<object_type,size_value>& other)
-        : m_begin(&m_data[0]),
-          m_end(m_begin + size_value)
-    {
-        // Deep copy data from other container into this container.
-        auto this_entry = base::m_begin;
-        auto other_entry = other.m_begin;
-        while(other_entry < other.m_end)
-        {
-            *this_entry++ = *other_entry++;
-        }
-    }
-    base(std::container::fixed::base<object_type,size_value>&& other) = delete;
+    base(const std::container::fixed::base<object_type,size_value,std::index_sequence<index_values...>>& other) = default;
 
     // ACCESS
     /// \brief Gets an iterator to the beginning of the container.
     /// \return The begin iterator.
     std::iterator<object_type> begin()
     {
-        return base::m_begin;
+        return base::m_data;
     }
     /// \brief Gets an iterator to the end of the container.
     /// \return The end iterator.
     std::iterator<object_type> end()
     {
-        return base::m_end;
+        return base::m_data + size_value;
+    }
+    /// \brief Gets a const_iterator to the beginning of the container.
+    /// \return The begin const_iterator.
+    constexpr std::const_iterator<object_type> begin() const
+    {
+        return base::m_data;
+    }
+    /// \brief Gets a const_iterator to the end of the container.
+    /// \return The end const_iterator.
+    constexpr std::const_iterator<object_type> end() const
+    {
+        return base::m_data + size_value;
     }
     /// \brief Gets a const_iterator to the beginning of the container.
     /// \return The begin const_iterator.
-    std::const_iterator<object_type> cbegin() const
+    constexpr std::const_iterator<object_type> cbegin() const
     {
-        return base::m_begin;
+        return base::m_data;
     }
     /// \brief Gets a const_iterator to the end of the container.
     /// \return The end const_iterator.
-    std::const_iterator<object_type> cend() const
+    constexpr std::const_iterator<object_type> cend() const
     {
-        return base::m_end;
+        return base::m_data + size_value;
+    }
+    /// \brief Gets a reverse_iterator to the beginning of the reversed container, which is its last element.
+    /// \return The reverse begin iterator.
+    std::reverse_iterator<std::iterator<object_type>> rbegin()
+    {
+        return std::reverse_iterator<std::iterator<object_type>>(base::m_data + size_value);
+    }
+    /// \brief Gets a reverse_iterator to the end of the reversed container, which is before its first element.
+    /// \return The reverse end iterator.
+    std::reverse_iterator<std::iterator<object_type>> rend()
+    {
+        return std::reverse_iterator<std::iterator<object_type>>(base::m_data);
+    }
+    /// \brief Gets a const reverse_iterator to the beginning of the reversed container, which is its last element.
+    /// \return The reverse begin const iterator.
+    constexpr std::reverse_iterator<std::const_iterator<object_type>> rbegin() const
+    {
+        return std::reverse_iterator<std::const_iterator<object_type>>(base::m_data + size_value);
+    }
+    /// \brief Gets a const reverse_iterator to the end of the reversed container, which is before its first element.
+    /// \return The reverse end const iterator.
+    constexpr std::reverse_iterator<std::const_iterator<object_type>> rend() const
+    {
+        return std::reverse_iterator<std::const_iterator<object_type>>(base::m_data);
+    }
+    /// \brief Gets a const reverse_iterator to the beginning of the reversed container, which is its last element.
+    /// \return The reverse begin const iterator.
+    constexpr std::reverse_iterator<std::const_iterator<object_type>> crbegin() const
+    {
+        return std::reverse_iterator<std::const_iterator<object_type>>(base::m_data + size_value);
+    }
+    /// \brief Gets a const reverse_iterator to the end of the reversed container, which is before its first element.
+    /// \return The reverse end const iterator.
+    constexpr std::reverse_iterator<std::const_iterator<object_type>> crend() const
+    {
+        return std::reverse_iterator<std::const_iterator<object_type>>(base::m_data);
     }
 
     // CAPACITY
     /// \brief Gets the size of the container.
     /// \return The size of the container.
-    std::size_t size() const
+    constexpr std::size_t size() const
     {
-        return base::m_end - base::m_begin;
+        return size_value;
     }
 
     // COMPARISON
     /// \brief Checks if this container is equal to another container.
     /// \param[in] other The other array to compare with.
     /// \return TRUE if the two containers are equal, otherwise FALSE.
-    bool operator==(const std::container::fixed::base<object_type,size_value>& other) const
+    bool operator==(const std::container::fixed::base<object_type,size_value,std::index_sequence<index_values...>>& other) const
     {
-        // Iterate through both containers.
-        auto this_entry = base::m_begin;
-        auto other_entry = other.m_begin;
-        while(this_entry != base::m_end)
-        {
-            // Compare the two entries.
-            if(*this_entry++ != *other_entry++)
-            {
-                return false;
-            }
-        }
-
-        // Indicate equal.
-        return true;
+        return std::container::fixed::block<object_type,size_value>::equal(base::m_data, other.m_data);
     }
     /// \brief Checks if this container is not equal to another container.
     /// \param[in] other The other array to compare with.
     /// \return TRUE if the two containers are not equal, otherwise FALSE.
-    bool operator!=(const std::container::fixed::base<object_type,size_value>& other) const
+    bool operator!=(const std::container::fixed::base<object_type,size_value,std::index_sequence<index_values...>>& other) const
     {
-        // Iterate through both containers.
-        auto this_entry = base::m_begin;
-        auto other_entry = other.m_begin;
-        while(this_entry != base::m_end)
-        {
-            // Compare the two entries.
-            if(*this_entry++ != *other_entry++)
-            {
-                return true;
-            }
-        }
-
-        // Indicate equal.
-        return false;
+        return !std::container::fixed::block<object_type,size_value>::equal(base::m_data, other.m_data);
+    }
+    /// \brief Checks if this container is lexicographically less than another container.
+    /// \param[in] other The other container to compare with.
+    /// \return TRUE if this container is ordered before the other container, otherwise FALSE.
+    bool operator<(const std::container::fixed::base<object_type,size_value,std::index_sequence<index_values...>>& other) const
+    {
+        return std::lexicographical_compare(base::m_data, base::m_data + size_value, other.m_data, other.m_data + size_value);
     }
-    
+    /// \brief Checks if this container is lexicographically less than or equal to another container.
+    /// \param[in] other The other container to compare with.
+    /// \return TRUE if this container is not ordered after the other container, otherwise FALSE.
+    bool operator<=(const std::container::fixed::base<object_type,size_value,std::index_sequence<index_values...>>& other) const
+    {
+        return !other.operator<(*this);
+    }
+    /// \brief Checks if this container is lexicographically greater than another container.
+    /// \param[in] other The other container to compare with.
+    /// \return TRUE if this container is ordered after the other container, otherwise FALSE.
+    bool operator>(const std::container::fixed::base<object_type,size_value,std::index_sequence<index_values...>>& other) const
+    {
+        return other.operator<(*this);
+    }
+    /// \brief Checks if this container is lexicographically greater than or equal to another container.
+    /// \param[in] other The other container to compare with.
+    /// \return TRUE if this container is not ordered before the other container, otherwise FALSE.
+    bool operator>=(const std::container::fixed::base<object_type,size_value,std::index_sequence<index_values...>>& other) const
+    {
+        return !base::operator<(other);
+    }
+
 protected:
     // DATA
     /// \brief Stores the container's data in a fixed size/location array.
+    /// \details The container's iterators are derived from this array rather than stored, which keeps the container
+    /// free of self-referencing pointers and usable in constant expressions.
     object_type m_data[size_value];
-
-    // ITERATORS
-    /// \brief An iterator to the beginning of the data array.
-    object_type* const m_begin;
-    /// \brief An iterator to the end of the data array.
-    object_type* const m_end;
 };
 
 }}
@@ -0,0 +1,309 @@
+/// \file std/container/fixed/bitset.hpp
+/// \brief Defines the std::bitset template class.
+#ifndef STD___CONTAINER___FIXED___BITSET_H
+#define STD___CONTAINER___FIXED___BITSET_H
+
+// std
+#include <std/container/bits.hpp>
+#include <std/stddef.hpp>
+
+namespace std {
+
+/// \brief A fixed-size sequence of bits, packed into machine words.
+/// \tparam size_value The number of bits in the bitset.
+template <std::size_t size_value>
+class bitset
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new bitset instance with all bits cleared.
+    bitset()
+        : m_data{}
+    {}
+    /// \brief Constructs a new bitset instance from the bits of an integer value.
+    /// \param[in] value The value whose bits initialize the lowest positions of the bitset.
+    bitset(unsigned long value)
+        : m_data{}
+    {
+        // Copy value into words, lowest word first.
+        for(std::size_t i = 0; i < bitset::words && value != 0; ++i)
+        {
+            bitset::m_data[i] = static_cast<std::container::bits::word>(value);
+
+            // Shift in two halves to remain defined when word and long have the same width.
+            value >>= std::container::bits::word_size / 2;
+            value >>= std::container::bits::word_size - std::container::bits::word_size / 2;
+        }
+
+        // Clear bits beyond the bitset's size.
+        std::container::bits::trim(bitset::m_data, size_value);
+    }
+
+    // ACCESS
+    /// \brief Gets the value of a bit.
+    /// \param[in] position The position of the bit.
+    /// \return The value of the bit.
+    bool operator[](std::size_t position) const
+    {
+        return (bitset::m_data[std::container::bits::word_index(position)] & std::container::bits::mask(position)) != 0;
+    }
+    /// \brief Gets a reference to a bit.
+    /// \param[in] position The position of the bit.
+    /// \return A proxy reference to the bit.
+    std::container::bits::reference operator[](std::size_t position)
+    {
+        return std::container::bits::reference(&bitset::m_data[std::container::bits::word_index(position)], std::container::bits::mask(position));
+    }
+    /// \brief Gets the value of a bit.
+    /// \param[in] position The position of the bit.
+    /// \return The value of the bit.
+    /// \note The name is parenthesized so that it is not expanded by function-like test() macros, such as AUnit's.
+    bool (test)(std::size_t position) const
+    {
+        return (bitset::m_data[std::container::bits::word_index(position)] & std::container::bits::mask(position)) != 0;
+    }
+    /// \brief Checks if all bits are set.
+    /// \return TRUE if all bits are set, otherwise FALSE.
+    bool all() const
+    {
+        return std::container::bits::count(bitset::m_data, bitset::words) == size_value;
+    }
+    /// \brief Checks if any bit is set.
+    /// \return TRUE if any bit is set, otherwise FALSE.
+    bool any() const
+    {
+        return std::container::bits::any(bitset::m_data, bitset::words);
+    }
+    /// \brief Checks if no bits are set.
+    /// \return TRUE if no bits are set, otherwise FALSE.
+    bool none() const
+    {
+        return !std::container::bits::any(bitset::m_data, bitset::words);
+    }
+    /// \brief Counts the number of set bits.
+    /// \return The number of set bits.
+    std::size_t count() const
+    {
+        return std::container::bits::count(bitset::m_data, bitset::words);
+    }
+    /// \brief Gets the number of bits in the bitset.
+    /// \return The number of bits in the bitset.
+    constexpr std::size_t size() const
+    {
+        return size_value;
+    }
+    /// \brief Finds the first set bit.
+    /// \return The position of the first set bit, or bitset::size() if no bits are set.
+    std::size_t find_first() const
+    {
+        return std::container::bits::find(bitset::m_data, size_value, 0);
+    }
+    /// \brief Finds the next set bit after a specified position.
+    /// \param[in] position The position to search after.
+    /// \return The position of the next set bit, or bitset::size() if no further bits are set.
+    std::size_t find_next(std::size_t position) const
+    {
+        return std::container::bits::find(bitset::m_data, size_value, position + 1);
+    }
+    /// \brief Converts the lowest bits of the bitset to an integer value.
+    /// \return The integer value of the lowest bits.
+    unsigned long to_ulong() const
+    {
+        // Copy words into value, highest word first.
+        unsigned long value = 0;
+        std::size_t i = (bitset::words * sizeof(std::container::bits::word) > sizeof(unsigned long)) ? sizeof(unsigned long) / sizeof(std::container::bits::word) : bitset::words;
+        while(i-- > 0)
+        {
+            // Shift in two halves to remain defined when word and long have the same width.
+            value <<= std::container::bits::word_size / 2;
+            value <<= std::container::bits::word_size - std::container::bits::word_size / 2;
+            value |= bitset::m_data[i];
+        }
+
+        return value;
+    }
+
+    // MODIFIERS
+    /// \brief Sets all bits.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& set()
+    {
+        std::container::bits::fill(bitset::m_data, bitset::words, ~std::container::bits::word(0));
+        std::container::bits::trim(bitset::m_data, size_value);
+
+        return *this;
+    }
+    /// \brief Sets a bit to a specified value.
+    /// \param[in] position The position of the bit.
+    /// \param[in] value The value to set the bit to.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& set(std::size_t position, bool value = true)
+    {
+        bitset::operator[](position) = value;
+
+        return *this;
+    }
+    /// \brief Clears all bits.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& reset()
+    {
+        std::container::bits::fill(bitset::m_data, bitset::words, 0);
+
+        return *this;
+    }
+    /// \brief Clears a bit.
+    /// \param[in] position The position of the bit.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& reset(std::size_t position)
+    {
+        bitset::m_data[std::container::bits::word_index(position)] &= ~std::container::bits::mask(position);
+
+        return *this;
+    }
+    /// \brief Flips all bits.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& flip()
+    {
+        for(auto entry = bitset::m_data; entry != bitset::m_data + bitset::words; ++entry)
+        {
+            *entry = ~*entry;
+        }
+        std::container::bits::trim(bitset::m_data, size_value);
+
+        return *this;
+    }
+    /// \brief Flips a bit.
+    /// \param[in] position The position of the bit.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& flip(std::size_t position)
+    {
+        bitset::m_data[std::container::bits::word_index(position)] ^= std::container::bits::mask(position);
+
+        return *this;
+    }
+
+    // OPERATORS
+    /// \brief Performs a bitwise AND with another bitset.
+    /// \param[in] other The other bitset.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& operator&=(const std::bitset<size_value>& other)
+    {
+        for(std::size_t i = 0; i < bitset::words; ++i)
+        {
+            bitset::m_data[i] &= other.m_data[i];
+        }
+
+        return *this;
+    }
+    /// \brief Performs a bitwise OR with another bitset.
+    /// \param[in] other The other bitset.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& operator|=(const std::bitset<size_value>& other)
+    {
+        for(std::size_t i = 0; i < bitset::words; ++i)
+        {
+            bitset::m_data[i] |= other.m_data[i];
+        }
+
+        return *this;
+    }
+    /// \brief Performs a bitwise XOR with another bitset.
+    /// \param[in] other The other bitset.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& operator^=(const std::bitset<size_value>& other)
+    {
+        for(std::size_t i = 0; i < bitset::words; ++i)
+        {
+            bitset::m_data[i] ^= other.m_data[i];
+        }
+
+        return *this;
+    }
+    /// \brief Shifts all bits towards higher positions, filling with zeros.
+    /// \param[in] shift The number of positions to shift.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& operator<<=(std::size_t shift)
+    {
+        std::container::bits::shift_left(bitset::m_data, bitset::words, shift);
+        std::container::bits::trim(bitset::m_data, size_value);
+
+        return *this;
+    }
+    /// \brief Shifts all bits towards lower positions, filling with zeros.
+    /// \param[in] shift The number of positions to shift.
+    /// \return A reference to this bitset.
+    std::bitset<size_value>& operator>>=(std::size_t shift)
+    {
+        std::container::bits::shift_right(bitset::m_data, bitset::words, shift);
+
+        return *this;
+    }
+    /// \brief Gets a copy of this bitset with all bits flipped.
+    /// \return The flipped bitset.
+    std::bitset<size_value> operator~() const
+    {
+        return std::bitset<size_value>(*this).flip();
+    }
+    /// \brief Gets a bitwise AND of this bitset and another bitset.
+    /// \param[in] other The other bitset.
+    /// \return The resulting bitset.
+    std::bitset<size_value> operator&(const std::bitset<size_value>& other) const
+    {
+        return std::bitset<size_value>(*this) &= other;
+    }
+    /// \brief Gets a bitwise OR of this bitset and another bitset.
+    /// \param[in] other The other bitset.
+    /// \return The resulting bitset.
+    std::bitset<size_value> operator|(const std::bitset<size_value>& other) const
+    {
+        return std::bitset<size_value>(*this) |= other;
+    }
+    /// \brief Gets a bitwise XOR of this bitset and another bitset.
+    /// \param[in] other The other bitset.
+    /// \return The resulting bitset.
+    std::bitset<size_value> operator^(const std::bitset<size_value>& other) const
+    {
+        return std::bitset<size_value>(*this) ^= other;
+    }
+    /// \brief Gets a copy of this bitset shifted towards higher positions.
+    /// \param[in] shift The number of positions to shift.
+    /// \return The shifted bitset.
+    std::bitset<size_value> operator<<(std::size_t shift) const
+    {
+        return std::bitset<size_value>(*this) <<= shift;
+    }
+    /// \brief Gets a copy of this bitset shifted towards lower positions.
+    /// \param[in] shift The number of positions to shift.
+    /// \return The shifted bitset.
+    std::bitset<size_value> operator>>(std::size_t shift) const
+    {
+        return std::bitset<size_value>(*this) >>= shift;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this bitset is equal to another bitset.
+    /// \param[in] other The other bitset to compare with.
+    /// \return TRUE if the two bitsets are equal, otherwise FALSE.
+    bool operator==(const std::bitset<size_value>& other) const
+    {
+        return memcmp(bitset::m_data, other.m_data, sizeof(bitset::m_data)) == 0;
+    }
+    /// \brief Checks if this bitset is unequal with another bitset.
+    /// \param[in] other The other bitset to compare with.
+    /// \return TRUE if the two bitsets are unequal, otherwise FALSE.
+    bool operator!=(const std::bitset<size_value>& other) const
+    {
+        return memcmp(bitset::m_data, other.m_data, sizeof(bitset::m_data)) != 0;
+    }
+
+private:
+    // DATA
+    /// \brief The number of words used to store the bits.
+    static constexpr std::size_t words = std::container::bits::word_count(size_value);
+    /// \brief Stores the bits packed into words, lowest position first. Unused bits in the last word are kept clear.
+    std::container::bits::word m_data[words];
+};
+
+}
+
+#endif
\ No newline at end of file
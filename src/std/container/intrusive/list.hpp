@@ -0,0 +1,562 @@
+/// \file std/container/intrusive/list.hpp
+/// \brief Defines the std::intrusive_list_hook class and std::intrusive_list template class.
+#ifndef STD___CONTAINER___INTRUSIVE___LIST_H
+#define STD___CONTAINER___INTRUSIVE___LIST_H
+
+// std
+#include <std/container/iterator.hpp>
+#include <std/stddef.hpp>
+
+namespace std {
+
+// Forward declarations for hook friendship.
+class intrusive_list_hook;
+template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+class intrusive_list;
+namespace container::intrusive {
+template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+class iterator;
+template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+class const_iterator;
+}
+
+/// \brief A hook that links an object into a std::intrusive_list.
+/// \details An object type embeds one hook per list it can belong to. The hook holds the list's links, so the list
+/// itself never allocates. A copied hook starts unlinked, so copying an object does not corrupt the list it is in.
+class intrusive_list_hook
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new unlinked hook instance.
+    intrusive_list_hook()
+        : m_previous(nullptr),
+          m_next(nullptr)
+    {}
+    /// \brief Constructs a new unlinked hook instance, ignoring the other hook's links.
+    intrusive_list_hook(const std::intrusive_list_hook&)
+        : m_previous(nullptr),
+          m_next(nullptr)
+    {}
+
+    // MODIFIERS
+    /// \brief Leaves this hook's links unchanged, ignoring the other hook's links.
+    /// \return A reference to this hook.
+    std::intrusive_list_hook& operator=(const std::intrusive_list_hook&)
+    {
+        return *this;
+    }
+
+    // CAPACITY
+    /// \brief Checks if the hook is linked into a list.
+    /// \return TRUE if the hook is linked, otherwise FALSE.
+    bool linked() const
+    {
+        return intrusive_list_hook::m_next != nullptr;
+    }
+
+private:
+    // LINKS
+    /// \brief The previous hook in the list.
+    std::intrusive_list_hook* m_previous;
+    /// \brief The next hook in the list.
+    std::intrusive_list_hook* m_next;
+
+    // FRIENDS
+    template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+    friend class intrusive_list;
+    template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+    friend class std::container::intrusive::iterator;
+    template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+    friend class std::container::intrusive::const_iterator;
+};
+
+namespace container {
+
+/// \brief Contains all code for std intrusive container components.
+namespace intrusive {
+
+/// \brief Gets the object that owns a hook.
+/// \tparam object_type The object type that embeds the hook.
+/// \tparam hook_member The hook member within the object type.
+/// \param[in] hook The hook.
+/// \return A pointer to the object that owns the hook.
+template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+object_type* owner(const std::intrusive_list_hook* hook)
+{
+    // Subtract the hook's offset within the object type from the hook's address.
+    std::size_t offset = reinterpret_cast<std::size_t>(&(reinterpret_cast<object_type*>(0)->*hook_member));
+    return reinterpret_cast<object_type*>(reinterpret_cast<char*>(const_cast<std::intrusive_list_hook*>(hook)) - offset);
+}
+
+/// \brief A bidirectional iterator for traversing a std::intrusive_list.
+/// \tparam object_type The object type stored in the list.
+/// \tparam hook_member The hook member within the object type.
+template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+class iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::bidirectional_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = object_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = object_type*;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = object_type&;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new iterator instance.
+    /// \param[in] hook The hook the iterator points to.
+    iterator(std::intrusive_list_hook* hook = nullptr)
+        : m_hook(hook)
+    {}
+
+    // ACCESS
+    /// \brief Gets a reference to the object the iterator points to.
+    /// \return A reference to the object.
+    object_type& operator*() const
+    {
+        return *std::container::intrusive::owner<object_type,hook_member>(iterator::m_hook);
+    }
+    /// \brief Gets a pointer to the object the iterator points to.
+    /// \return A pointer to the object.
+    object_type* operator->() const
+    {
+        return std::container::intrusive::owner<object_type,hook_member>(iterator::m_hook);
+    }
+    /// \brief Gets the hook the iterator points to.
+    /// \return The hook the iterator points to.
+    std::intrusive_list_hook* hook() const
+    {
+        return iterator::m_hook;
+    }
+
+    // MODIFIERS
+    /// \brief Advances the iterator to the next object.
+    /// \return A reference to this iterator.
+    iterator& operator++()
+    {
+        iterator::m_hook = iterator::m_hook->m_next;
+        return *this;
+    }
+    /// \brief Advances the iterator to the next object.
+    /// \return A copy of the iterator before it was advanced.
+    iterator operator++(int)
+    {
+        iterator previous = *this;
+        iterator::m_hook = iterator::m_hook->m_next;
+        return previous;
+    }
+    /// \brief Moves the iterator to the previous object.
+    /// \return A reference to this iterator.
+    iterator& operator--()
+    {
+        iterator::m_hook = iterator::m_hook->m_previous;
+        return *this;
+    }
+    /// \brief Moves the iterator to the previous object.
+    /// \return A copy of the iterator before it was moved.
+    iterator operator--(int)
+    {
+        iterator next = *this;
+        iterator::m_hook = iterator::m_hook->m_previous;
+        return next;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator points to the same hook as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are equal, otherwise FALSE.
+    bool operator==(const iterator& other) const
+    {
+        return iterator::m_hook == other.m_hook;
+    }
+    /// \brief Checks if this iterator points to a different hook than another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are unequal, otherwise FALSE.
+    bool operator!=(const iterator& other) const
+    {
+        return iterator::m_hook != other.m_hook;
+    }
+
+private:
+    // DATA
+    /// \brief The hook the iterator points to.
+    std::intrusive_list_hook* m_hook;
+};
+
+/// \brief A bidirectional const iterator for traversing a std::intrusive_list.
+/// \tparam object_type The object type stored in the list.
+/// \tparam hook_member The hook member within the object type.
+template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+class const_iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::bidirectional_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = object_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = const object_type*;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = const object_type&;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new const iterator instance.
+    /// \param[in] hook The hook the iterator points to.
+    const_iterator(const std::intrusive_list_hook* hook = nullptr)
+        : m_hook(hook)
+    {}
+    /// \brief Constructs a new const iterator instance from an iterator.
+    /// \param[in] other The iterator to convert.
+    const_iterator(const std::container::intrusive::iterator<object_type,hook_member>& other)
+        : m_hook(other.hook())
+    {}
+
+    // ACCESS
+    /// \brief Gets a const reference to the object the iterator points to.
+    /// \return A const reference to the object.
+    const object_type& operator*() const
+    {
+        return *std::container::intrusive::owner<object_type,hook_member>(const_iterator::m_hook);
+    }
+    /// \brief Gets a const pointer to the object the iterator points to.
+    /// \return A const pointer to the object.
+    const object_type* operator->() const
+    {
+        return std::container::intrusive::owner<object_type,hook_member>(const_iterator::m_hook);
+    }
+    /// \brief Gets the hook the iterator points to.
+    /// \return The hook the iterator points to.
+    const std::intrusive_list_hook* hook() const
+    {
+        return const_iterator::m_hook;
+    }
+
+    // MODIFIERS
+    /// \brief Advances the iterator to the next object.
+    /// \return A reference to this iterator.
+    const_iterator& operator++()
+    {
+        const_iterator::m_hook = const_iterator::m_hook->m_next;
+        return *this;
+    }
+    /// \brief Advances the iterator to the next object.
+    /// \return A copy of the iterator before it was advanced.
+    const_iterator operator++(int)
+    {
+        const_iterator previous = *this;
+        const_iterator::m_hook = const_iterator::m_hook->m_next;
+        return previous;
+    }
+    /// \brief Moves the iterator to the previous object.
+    /// \return A reference to this iterator.
+    const_iterator& operator--()
+    {
+        const_iterator::m_hook = const_iterator::m_hook->m_previous;
+        return *this;
+    }
+    /// \brief Moves the iterator to the previous object.
+    /// \return A copy of the iterator before it was moved.
+    const_iterator operator--(int)
+    {
+        const_iterator next = *this;
+        const_iterator::m_hook = const_iterator::m_hook->m_previous;
+        return next;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator points to the same hook as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are equal, otherwise FALSE.
+    bool operator==(const const_iterator& other) const
+    {
+        return const_iterator::m_hook == other.m_hook;
+    }
+    /// \brief Checks if this iterator points to a different hook than another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are unequal, otherwise FALSE.
+    bool operator!=(const const_iterator& other) const
+    {
+        return const_iterator::m_hook != other.m_hook;
+    }
+
+private:
+    // DATA
+    /// \brief The hook the iterator points to.
+    const std::intrusive_list_hook* m_hook;
+};
+
+}}
+
+/// \brief A doubly-linked list that links objects through a hook embedded in each object.
+/// \tparam object_type The object type stored in the list.
+/// \tparam hook_member The std::intrusive_list_hook member of object_type used to link objects into this list.
+/// \details The list never allocates or copies objects; it links the objects themselves. All insertions, removals,
+/// and splices run in constant time. The caller owns the objects, and an object must be removed from the list before it
+/// is destroyed. An object can only be in one list per hook.
+template <typename object_type, std::intrusive_list_hook object_type::*hook_member>
+class intrusive_list
+{
+public:
+    // TYPES
+    /// \brief The iterator type of the list.
+    using iterator = std::container::intrusive::iterator<object_type,hook_member>;
+    /// \brief The const iterator type of the list.
+    using const_iterator = std::container::intrusive::const_iterator<object_type,hook_member>;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty intrusive list instance.
+    intrusive_list()
+        : m_size(0)
+    {
+        intrusive_list::m_root.m_previous = &(intrusive_list::m_root);
+        intrusive_list::m_root.m_next = &(intrusive_list::m_root);
+    }
+    /// \brief Intrusive lists cannot be copied, as each object can only be linked into one list per hook.
+    intrusive_list(const std::intrusive_list<object_type,hook_member>& other) = delete;
+    /// \brief Move-constructs a new intrusive list, taking the objects linked into another list.
+    /// \param[in] other The other list to move-construct from.
+    intrusive_list(std::intrusive_list<object_type,hook_member>&& other)
+        : intrusive_list()
+    {
+        intrusive_list::splice(intrusive_list::end(), other);
+    }
+    ~intrusive_list()
+    {
+        // Unlink all objects.
+        intrusive_list::clear();
+    }
+
+    // ACCESS
+    /// \brief Gets an iterator to the beginning of the list.
+    /// \return The begin iterator.
+    iterator begin()
+    {
+        return iterator(intrusive_list::m_root.m_next);
+    }
+    /// \brief Gets an iterator to the end of the list.
+    /// \return The end iterator.
+    iterator end()
+    {
+        return iterator(&(intrusive_list::m_root));
+    }
+    /// \brief Gets a const_iterator to the beginning of the list.
+    /// \return The begin const_iterator.
+    const_iterator cbegin() const
+    {
+        return const_iterator(intrusive_list::m_root.m_next);
+    }
+    /// \brief Gets a const_iterator to the end of the list.
+    /// \return The end const_iterator.
+    const_iterator cend() const
+    {
+        return const_iterator(&(intrusive_list::m_root));
+    }
+    /// \brief Gets a reference to the first object in the list.
+    /// \return A reference to the first object.
+    object_type& front()
+    {
+        return *intrusive_list::begin();
+    }
+    /// \brief Gets a const reference to the first object in the list.
+    /// \return A const reference to the first object.
+    const object_type& front() const
+    {
+        return *intrusive_list::cbegin();
+    }
+    /// \brief Gets a reference to the last object in the list.
+    /// \return A reference to the last object.
+    object_type& back()
+    {
+        return *iterator(intrusive_list::m_root.m_previous);
+    }
+    /// \brief Gets a const reference to the last object in the list.
+    /// \return A const reference to the last object.
+    const object_type& back() const
+    {
+        return *const_iterator(intrusive_list::m_root.m_previous);
+    }
+    /// \brief Gets an iterator to an object in the list.
+    /// \param[in] object The object, which must be linked into this list.
+    /// \return An iterator to the object.
+    iterator iterator_to(object_type& object)
+    {
+        return iterator(&(object.*hook_member));
+    }
+
+    // MODIFIERS
+    /// \brief Links an object into the front of the list.
+    /// \param[in] object The object to link, which must not already be linked through this hook.
+    void push_front(object_type& object)
+    {
+        intrusive_list::link(intrusive_list::m_root.m_next, &(object.*hook_member));
+    }
+    /// \brief Links an object into the back of the list.
+    /// \param[in] object The object to link, which must not already be linked through this hook.
+    void push_back(object_type& object)
+    {
+        intrusive_list::link(&(intrusive_list::m_root), &(object.*hook_member));
+    }
+    /// \brief Unlinks the first object from the list.
+    void pop_front()
+    {
+        if(intrusive_list::m_size)
+        {
+            intrusive_list::unlink(intrusive_list::m_root.m_next);
+        }
+    }
+    /// \brief Unlinks the last object from the list.
+    void pop_back()
+    {
+        if(intrusive_list::m_size)
+        {
+            intrusive_list::unlink(intrusive_list::m_root.m_previous);
+        }
+    }
+    /// \brief Links an object into the list before a specified position.
+    /// \param[in] position The position to insert the object before.
+    /// \param[in] object The object to link, which must not already be linked through this hook.
+    /// \return An iterator to the inserted object.
+    iterator insert(const_iterator position, object_type& object)
+    {
+        intrusive_list::link(const_cast<std::intrusive_list_hook*>(position.hook()), &(object.*hook_member));
+        return iterator(&(object.*hook_member));
+    }
+    /// \brief Unlinks an object from the list.
+    /// \param[in] position The position of the object to unlink.
+    /// \return An iterator to the object after the unlinked object.
+    iterator erase(const_iterator position)
+    {
+        std::intrusive_list_hook* next = position.hook()->m_next;
+        intrusive_list::unlink(const_cast<std::intrusive_list_hook*>(position.hook()));
+        return iterator(next);
+    }
+    /// \brief Unlinks an object from the list.
+    /// \param[in] object The object to unlink, which must be linked into this list.
+    void erase(object_type& object)
+    {
+        intrusive_list::unlink(&(object.*hook_member));
+    }
+    /// \brief Unlinks all objects from the list.
+    /// \details Runs in O(n), as each object's hook is reset so it can be linked into another list.
+    void clear()
+    {
+        for(std::intrusive_list_hook* hook = intrusive_list::m_root.m_next; hook != &(intrusive_list::m_root);)
+        {
+            std::intrusive_list_hook* next = hook->m_next;
+            hook->m_previous = nullptr;
+            hook->m_next = nullptr;
+            hook = next;
+        }
+        intrusive_list::m_root.m_previous = &(intrusive_list::m_root);
+        intrusive_list::m_root.m_next = &(intrusive_list::m_root);
+        intrusive_list::m_size = 0;
+    }
+    /// \brief Moves all objects from another list into this list before a specified position.
+    /// \param[in] position The position to insert the objects before.
+    /// \param[in] other The other list, which is left empty.
+    void splice(const_iterator position, std::intrusive_list<object_type,hook_member>& other)
+    {
+        // Verify the other list isn't empty.
+        if(other.m_size == 0)
+        {
+            return;
+        }
+
+        // Relink the other list's chain between position and its predecessor.
+        std::intrusive_list_hook* next = const_cast<std::intrusive_list_hook*>(position.hook());
+        std::intrusive_list_hook* previous = next->m_previous;
+        previous->m_next = other.m_root.m_next;
+        other.m_root.m_next->m_previous = previous;
+        next->m_previous = other.m_root.m_previous;
+        other.m_root.m_previous->m_next = next;
+        intrusive_list::m_size += other.m_size;
+
+        // Reset the other list.
+        other.m_root.m_previous = &other.m_root;
+        other.m_root.m_next = &other.m_root;
+        other.m_size = 0;
+    }
+    /// \brief Moves an object from another list into this list before a specified position.
+    /// \param[in] position The position to insert the object before.
+    /// \param[in] other The other list, which may be this list.
+    /// \param[in] object The position of the object in the other list.
+    void splice(const_iterator position, std::intrusive_list<object_type,hook_member>& other, const_iterator object)
+    {
+        // Skip moving an object to its own position.
+        std::intrusive_list_hook* hook = const_cast<std::intrusive_list_hook*>(object.hook());
+        std::intrusive_list_hook* next = const_cast<std::intrusive_list_hook*>(position.hook());
+        if(hook == next || hook->m_next == next)
+        {
+            return;
+        }
+
+        // Unlink from the other list and link into this list.
+        other.unlink(hook);
+        intrusive_list::link(next, hook);
+    }
+    /// \brief Move-assigns the objects of another list to this list.
+    /// \param[in] other The other list to move-assign from.
+    /// \return A reference to this list.
+    std::intrusive_list<object_type,hook_member>& operator=(std::intrusive_list<object_type,hook_member>&& other)
+    {
+        intrusive_list::clear();
+        intrusive_list::splice(intrusive_list::end(), other);
+        return *this;
+    }
+
+    // CAPACITY
+    /// \brief Gets the number of objects in the list.
+    /// \return The number of objects in the list.
+    std::size_t size() const
+    {
+        return intrusive_list::m_size;
+    }
+    /// \brief Checks if the list is empty.
+    /// \return TRUE if the list is empty, otherwise FALSE.
+    bool empty() const
+    {
+        return intrusive_list::m_size == 0;
+    }
+
+private:
+    // DATA
+    /// \brief The sentinel hook that links the first and last objects into a circle.
+    std::intrusive_list_hook m_root;
+    /// \brief The number of objects in the list.
+    std::size_t m_size;
+
+    // LINKS
+    /// \brief Links a hook before another hook.
+    /// \param[in] next The hook to link before.
+    /// \param[in] hook The hook to link.
+    void link(std::intrusive_list_hook* next, std::intrusive_list_hook* hook)
+    {
+        hook->m_next = next;
+        hook->m_previous = next->m_previous;
+        next->m_previous->m_next = hook;
+        next->m_previous = hook;
+        ++intrusive_list::m_size;
+    }
+    /// \brief Unlinks a hook from the list.
+    /// \param[in] hook The hook to unlink.
+    void unlink(std::intrusive_list_hook* hook)
+    {
+        hook->m_previous->m_next = hook->m_next;
+        hook->m_next->m_previous = hook->m_previous;
+        hook->m_previous = nullptr;
+        hook->m_next = nullptr;
+        --intrusive_list::m_size;
+    }
+};
+
+}
+
+#endif
\ No newline at end of file
@@ -1,8 +1,12 @@
 /// \file container/iterator.hpp
-/// \brief Defines the std::container::iterator and std::container::const_iterator type definitions.
+/// \brief Defines the std::container::iterator and std::container::const_iterator type definitions, along with the
+/// iterator categories, std::iterator_traits, and the std::distance, std::advance, std::next, and std::prev functions.
 #ifndef STD___ITERATOR_H
 #define STD___ITERATOR_H
 
+// std
+#include <std/stddef.hpp>
+
 namespace std {
 namespace container {
 
@@ -28,6 +32,186 @@ using iterator = std::container::iterator<object_type>;
 template <typename object_type>
 using const_iterator = std::container::const_iterator<object_type>;
 
+// CATEGORIES
+/// \brief Identifies iterators that can only be read and advanced once.
+struct input_iterator_tag
+{};
+/// \brief Identifies iterators that can be advanced multiple times over the same range.
+struct forward_iterator_tag
+    : public std::input_iterator_tag
+{};
+/// \brief Identifies iterators that can also be moved backwards.
+struct bidirectional_iterator_tag
+    : public std::forward_iterator_tag
+{};
+/// \brief Identifies iterators that can also be moved by any offset in constant time.
+struct random_access_iterator_tag
+    : public std::bidirectional_iterator_tag
+{};
+
+// TRAITS
+/// \brief Gets the properties of an iterator type.
+/// \tparam iterator_type The iterator type, which must define the iterator_category, value_type, difference_type,
+/// pointer, and reference member types.
+template <typename iterator_type>
+struct iterator_traits
+{
+    /// \brief The category tag of the iterator.
+    using iterator_category = typename iterator_type::iterator_category;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = typename iterator_type::value_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = typename iterator_type::difference_type;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = typename iterator_type::pointer;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = typename iterator_type::reference;
+};
+/// \brief Gets the properties of a pointer used as an iterator.
+/// \tparam object_type The object type of the pointer.
+template <typename object_type>
+struct iterator_traits<object_type*>
+{
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = object_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = object_type*;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = object_type&;
+};
+/// \brief Gets the properties of a const pointer used as an iterator.
+/// \tparam object_type The object type of the pointer.
+template <typename object_type>
+struct iterator_traits<const object_type*>
+{
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = object_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = const object_type*;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = const object_type&;
+};
+
+namespace container {
+
+/// \brief Gets the number of increments between two iterators by incrementing.
+/// \tparam iterator_type The input iterator type.
+/// \param[in] first The first iterator.
+/// \param[in] last The second iterator, which must be reachable from the first.
+/// \return The number of increments from first to last.
+template <typename iterator_type>
+typename std::iterator_traits<iterator_type>::difference_type distance(iterator_type first, iterator_type last, std::input_iterator_tag)
+{
+    typename std::iterator_traits<iterator_type>::difference_type count = 0;
+    for(; first != last; ++first)
+    {
+        ++count;
+    }
+
+    return count;
+}
+/// \brief Gets the number of increments between two random access iterators in constant time.
+/// \tparam iterator_type The random access iterator type.
+/// \param[in] first The first iterator.
+/// \param[in] last The second iterator.
+/// \return The number of increments from first to last.
+template <typename iterator_type>
+typename std::iterator_traits<iterator_type>::difference_type distance(iterator_type first, iterator_type last, std::random_access_iterator_tag)
+{
+    return last - first;
+}
+/// \brief Moves an iterator forwards by incrementing.
+/// \tparam iterator_type The input iterator type.
+/// \param[in] iterator The iterator to move.
+/// \param[in] count The number of increments, which must not be negative.
+template <typename iterator_type>
+void advance(iterator_type& iterator, typename std::iterator_traits<iterator_type>::difference_type count, std::input_iterator_tag)
+{
+    for(; count > 0; --count)
+    {
+        ++iterator;
+    }
+}
+/// \brief Moves a bidirectional iterator forwards or backwards by incrementing or decrementing.
+/// \tparam iterator_type The bidirectional iterator type.
+/// \param[in] iterator The iterator to move.
+/// \param[in] count The number of increments, or decrements if negative.
+template <typename iterator_type>
+void advance(iterator_type& iterator, typename std::iterator_traits<iterator_type>::difference_type count, std::bidirectional_iterator_tag)
+{
+    for(; count > 0; --count)
+    {
+        ++iterator;
+    }
+    for(; count < 0; ++count)
+    {
+        --iterator;
+    }
+}
+/// \brief Moves a random access iterator in constant time.
+/// \tparam iterator_type The random access iterator type.
+/// \param[in] iterator The iterator to move.
+/// \param[in] count The offset to move by.
+template <typename iterator_type>
+void advance(iterator_type& iterator, typename std::iterator_traits<iterator_type>::difference_type count, std::random_access_iterator_tag)
+{
+    iterator += count;
+}
+
+}
+
+/// \brief Gets the number of increments between two iterators.
+/// \tparam iterator_type The input iterator type.
+/// \param[in] first The first iterator.
+/// \param[in] last The second iterator, which must be reachable from the first.
+/// \return The number of increments from first to last.
+/// \details Runs in O(1) for random access iterators, and otherwise in O(n).
+template <typename iterator_type>
+typename std::iterator_traits<iterator_type>::difference_type distance(iterator_type first, iterator_type last)
+{
+    return std::container::distance(first, last, typename std::iterator_traits<iterator_type>::iterator_category());
+}
+/// \brief Moves an iterator by an offset.
+/// \tparam iterator_type The input iterator type.
+/// \param[in] iterator The iterator to move.
+/// \param[in] count The offset to move by, which may only be negative for bidirectional iterators.
+/// \details Runs in O(1) for random access iterators, and otherwise in O(count).
+template <typename iterator_type>
+void advance(iterator_type& iterator, typename std::iterator_traits<iterator_type>::difference_type count)
+{
+    std::container::advance(iterator, count, typename std::iterator_traits<iterator_type>::iterator_category());
+}
+/// \brief Gets an iterator moved forwards by an offset.
+/// \tparam iterator_type The input iterator type.
+/// \param[in] iterator The iterator to move from.
+/// \param[in] count The offset to move by.
+/// \return The moved iterator.
+template <typename iterator_type>
+iterator_type next(iterator_type iterator, typename std::iterator_traits<iterator_type>::difference_type count = 1)
+{
+    std::advance(iterator, count);
+    return iterator;
+}
+/// \brief Gets an iterator moved backwards by an offset.
+/// \tparam iterator_type The bidirectional iterator type.
+/// \param[in] iterator The iterator to move from.
+/// \param[in] count The offset to move back by.
+/// \return The moved iterator.
+template <typename iterator_type>
+iterator_type prev(iterator_type iterator, typename std::iterator_traits<iterator_type>::difference_type count = 1)
+{
+    std::advance(iterator, -count);
+    return iterator;
+}
+
 }
 
 #endif
\ No newline at end of file
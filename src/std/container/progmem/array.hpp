@@ -0,0 +1,117 @@
+/// \file std/container/progmem/array.hpp
+/// \brief Defines the std::progmem_array template class.
+#ifndef STD___CONTAINER___PROGMEM___ARRAY_H
+#define STD___CONTAINER___PROGMEM___ARRAY_H
+
+// std
+#include <std/container/fixed/array.hpp>
+#include <std/container/progmem/iterator.hpp>
+#include <std/container/progmem/read.hpp>
+
+namespace std {
+
+/// \brief A read-only view of a fixed-size array stored in flash memory (PROGMEM).
+/// \tparam object_type The type of object stored in the array. Must be default constructible and trivially copyable.
+/// \tparam size_value The size of the array.
+/// \details The view only stores the flash address of the array, so the array's data never occupies RAM. Elements are
+/// read out of flash on access.
+template <typename object_type, std::size_t size_value>
+class progmem_array
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new progmem_array instance over a C array stored in flash.
+    /// \param[in] data The PROGMEM C array to view.
+    constexpr progmem_array(const object_type (&data)[size_value])
+        : m_begin(data)
+    {}
+    /// \brief Constructs a new progmem_array instance over a std::array stored in flash.
+    /// \param[in] data The PROGMEM std::array to view.
+    constexpr progmem_array(const std::array<object_type,size_value>& data)
+        : m_begin(data.data())
+    {}
+
+    // ACCESS
+    /// \brief Reads the value at a specified index.
+    /// \param[in] index The index of the value to read.
+    /// \return A copy of the value.
+    object_type operator[](std::size_t index) const
+    {
+        return std::container::progmem::read(progmem_array::m_begin + index);
+    }
+    /// \brief Reads the value at a specified index.
+    /// \param[in] index The index of the value to read.
+    /// \return A copy of the value.
+    object_type at(std::size_t index) const
+    {
+        return std::container::progmem::read(progmem_array::m_begin + index);
+    }
+    /// \brief Reads the first value in the array.
+    /// \return A copy of the first value.
+    object_type front() const
+    {
+        return std::container::progmem::read(progmem_array::m_begin);
+    }
+    /// \brief Reads the last value in the array.
+    /// \return A copy of the last value.
+    object_type back() const
+    {
+        return std::container::progmem::read(progmem_array::m_begin + size_value - 1);
+    }
+    /// \brief Gets the flash address of the array's underlying data.
+    /// \return The flash address of the underlying data.
+    /// \note The address must be read through pgm_read_* functions.
+    constexpr const object_type* data() const
+    {
+        return progmem_array::m_begin;
+    }
+    /// \brief Gets an iterator to the beginning of the array.
+    /// \return The begin iterator.
+    constexpr std::progmem_iterator<object_type> begin() const
+    {
+        return progmem_array::m_begin;
+    }
+    /// \brief Gets an iterator to the end of the array.
+    /// \return The end iterator.
+    constexpr std::progmem_iterator<object_type> end() const
+    {
+        return progmem_array::m_begin + size_value;
+    }
+    /// \brief Gets an iterator to the beginning of the array.
+    /// \return The begin iterator.
+    constexpr std::progmem_iterator<object_type> cbegin() const
+    {
+        return progmem_array::m_begin;
+    }
+    /// \brief Gets an iterator to the end of the array.
+    /// \return The end iterator.
+    constexpr std::progmem_iterator<object_type> cend() const
+    {
+        return progmem_array::m_begin + size_value;
+    }
+
+    // CAPACITY
+    /// \brief Gets the size of the array.
+    /// \return The size of the array.
+    constexpr std::size_t size() const
+    {
+        return size_value;
+    }
+
+    // OPERATIONS
+    /// \brief Copies the contents of the array from flash into a RAM array.
+    /// \param[out] destination The RAM array to copy into.
+    void copy(std::array<object_type,size_value>& destination) const
+    {
+        memcpy_P(destination.data(), progmem_array::m_begin, sizeof(object_type) * size_value);
+    }
+
+private:
+    // DATA
+    /// \brief The flash address of the beginning of the array.
+    const object_type* const m_begin;
+};
+
+}
+
+#endif
@@ -0,0 +1,203 @@
+/// \file std/container/progmem/iterator.hpp
+/// \brief Defines the std::container::progmem::iterator template class.
+#ifndef STD___CONTAINER___PROGMEM___ITERATOR_H
+#define STD___CONTAINER___PROGMEM___ITERATOR_H
+
+// std
+#include <std/container/iterator.hpp>
+#include <std/container/progmem/read.hpp>
+#include <std/stddef.hpp>
+
+namespace std {
+namespace container::progmem {
+
+/// \brief A read-only iterator for traversing through a container stored in flash memory.
+/// \tparam object_type The object type of the container.
+/// \details Mirrors the pointer interface of std::const_iterator, but reads elements out of flash when dereferenced.
+template <typename object_type>
+class iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator.
+    using iterator_category = std::random_access_iterator_tag;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = object_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = std::ptrdiff_t;
+    /// \brief The type returned by the iterator's operator->, which is a proxy rather than a pointer.
+    using pointer = void;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = object_type;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new iterator instance.
+    /// \param[in] address The flash address of the element to point to.
+    constexpr iterator(const object_type* address = nullptr)
+        : m_address(address)
+    {}
+
+    // ACCESS
+    /// \brief Reads the element pointed to by this iterator.
+    /// \return A copy of the element.
+    object_type operator*() const
+    {
+        return std::container::progmem::read(iterator::m_address);
+    }
+    /// \brief Reads an element at an offset from this iterator.
+    /// \param[in] offset The offset of the element to read.
+    /// \return A copy of the element.
+    object_type operator[](std::ptrdiff_t offset) const
+    {
+        return std::container::progmem::read(iterator::m_address + offset);
+    }
+    /// \brief A proxy for accessing members of an element read from flash.
+    struct arrow
+    {
+        /// \brief The copy of the element read from flash.
+        object_type value;
+        /// \brief Accesses the members of the element.
+        /// \return A pointer to the copy of the element.
+        const object_type* operator->() const
+        {
+            return &value;
+        }
+    };
+    /// \brief Reads the element pointed to by this iterator for member access.
+    /// \return A proxy that provides member access to a copy of the element.
+    arrow operator->() const
+    {
+        return arrow{std::container::progmem::read(iterator::m_address)};
+    }
+    /// \brief Gets the flash address pointed to by this iterator.
+    /// \return The flash address.
+    constexpr const object_type* address() const
+    {
+        return iterator::m_address;
+    }
+
+    // ARITHMETIC
+    /// \brief Increments this iterator.
+    /// \return A reference to this iterator.
+    iterator& operator++()
+    {
+        ++iterator::m_address;
+        return *this;
+    }
+    /// \brief Post-increments this iterator.
+    /// \return A copy of this iterator prior to incrementing.
+    iterator operator++(int)
+    {
+        return iterator(iterator::m_address++);
+    }
+    /// \brief Decrements this iterator.
+    /// \return A reference to this iterator.
+    iterator& operator--()
+    {
+        --iterator::m_address;
+        return *this;
+    }
+    /// \brief Post-decrements this iterator.
+    /// \return A copy of this iterator prior to decrementing.
+    iterator operator--(int)
+    {
+        return iterator(iterator::m_address--);
+    }
+    /// \brief Advances this iterator by an offset.
+    /// \param[in] offset The offset to advance by.
+    /// \return A reference to this iterator.
+    iterator& operator+=(std::ptrdiff_t offset)
+    {
+        iterator::m_address += offset;
+        return *this;
+    }
+    /// \brief Retreats this iterator by an offset.
+    /// \param[in] offset The offset to retreat by.
+    /// \return A reference to this iterator.
+    iterator& operator-=(std::ptrdiff_t offset)
+    {
+        iterator::m_address -= offset;
+        return *this;
+    }
+    /// \brief Gets an iterator advanced by an offset.
+    /// \param[in] offset The offset to advance by.
+    /// \return The advanced iterator.
+    constexpr iterator operator+(std::ptrdiff_t offset) const
+    {
+        return iterator(iterator::m_address + offset);
+    }
+    /// \brief Gets an iterator retreated by an offset.
+    /// \param[in] offset The offset to retreat by.
+    /// \return The retreated iterator.
+    constexpr iterator operator-(std::ptrdiff_t offset) const
+    {
+        return iterator(iterator::m_address - offset);
+    }
+    /// \brief Gets the distance between this iterator and another iterator.
+    /// \param[in] other The other iterator.
+    /// \return The number of elements between the two iterators.
+    constexpr std::ptrdiff_t operator-(const iterator& other) const
+    {
+        return iterator::m_address - other.m_address;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator is equal to another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators point to the same element, otherwise FALSE.
+    constexpr bool operator==(const iterator& other) const
+    {
+        return iterator::m_address == other.m_address;
+    }
+    /// \brief Checks if this iterator is unequal with another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators point to different elements, otherwise FALSE.
+    constexpr bool operator!=(const iterator& other) const
+    {
+        return iterator::m_address != other.m_address;
+    }
+    /// \brief Checks if this iterator points before another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points before the other iterator, otherwise FALSE.
+    constexpr bool operator<(const iterator& other) const
+    {
+        return iterator::m_address < other.m_address;
+    }
+    /// \brief Checks if this iterator points after another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points after the other iterator, otherwise FALSE.
+    constexpr bool operator>(const iterator& other) const
+    {
+        return iterator::m_address > other.m_address;
+    }
+    /// \brief Checks if this iterator points before or to the same element as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points before or to the same element as the other iterator, otherwise FALSE.
+    constexpr bool operator<=(const iterator& other) const
+    {
+        return iterator::m_address <= other.m_address;
+    }
+    /// \brief Checks if this iterator points after or to the same element as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator points after or to the same element as the other iterator, otherwise FALSE.
+    constexpr bool operator>=(const iterator& other) const
+    {
+        return iterator::m_address >= other.m_address;
+    }
+
+private:
+    // ADDRESS
+    /// \brief The flash address of the element pointed to by this iterator.
+    const object_type* m_address;
+};
+
+}
+
+/// \brief A read-only iterator for traversing through a container stored in flash memory.
+/// \tparam object_type The object type of the container.
+template <typename object_type>
+using progmem_iterator = std::container::progmem::iterator<object_type>;
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,132 @@
+/// \file std/container/progmem/map.hpp
+/// \brief Defines the std::progmem_map template class.
+#ifndef STD___CONTAINER___PROGMEM___MAP_H
+#define STD___CONTAINER___PROGMEM___MAP_H
+
+// std
+#include <std/container/progmem/iterator.hpp>
+#include <std/container/progmem/read.hpp>
+#include <std/utility/pair.hpp>
+
+namespace std {
+
+/// \brief A read-only view of a key/value mapping table stored in flash memory (PROGMEM).
+/// \tparam key_type The object type of the map's key. Must be comparable with operator<.
+/// \tparam value_type The object type of the map's value.
+/// \details The table must be sorted by key in ascending order with unique keys, which allows lookups to binary search
+/// the table in O(log n). Only the keys visited by the search are read out of flash.
+template <typename key_type, typename value_type>
+class progmem_map
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new progmem_map instance over a sorted C array stored in flash.
+    /// \tparam size_value The number of mappings in the table.
+    /// \param[in] table The sorted PROGMEM table to view.
+    template <std::size_t size_value>
+    constexpr progmem_map(const std::pair<key_type,value_type> (&table)[size_value])
+        : m_begin(table),
+          m_end(table + size_value)
+    {}
+    /// \brief Constructs a new progmem_map instance over a sorted table stored in flash.
+    /// \param[in] table The flash address of the sorted table.
+    /// \param[in] size The number of mappings in the table.
+    constexpr progmem_map(const std::pair<key_type,value_type>* table, std::size_t size)
+        : m_begin(table),
+          m_end(table + size)
+    {}
+
+    // ACCESS
+    /// \brief Gets an iterator to the beginning of the map.
+    /// \return The begin iterator.
+    constexpr std::progmem_iterator<std::pair<key_type,value_type>> begin() const
+    {
+        return progmem_map::m_begin;
+    }
+    /// \brief Gets an iterator to the end of the map.
+    /// \return The end iterator.
+    constexpr std::progmem_iterator<std::pair<key_type,value_type>> end() const
+    {
+        return progmem_map::m_end;
+    }
+    /// \brief Gets an iterator to the beginning of the map.
+    /// \return The begin iterator.
+    constexpr std::progmem_iterator<std::pair<key_type,value_type>> cbegin() const
+    {
+        return progmem_map::m_begin;
+    }
+    /// \brief Gets an iterator to the end of the map.
+    /// \return The end iterator.
+    constexpr std::progmem_iterator<std::pair<key_type,value_type>> cend() const
+    {
+        return progmem_map::m_end;
+    }
+
+    // LOOKUP
+    /// \brief Finds the mapping with a specified key.
+    /// \param[in] key The key to find.
+    /// \return An iterator to the mapping of the specified key, or progmem_map::end() if the key is not present in the map.
+    std::progmem_iterator<std::pair<key_type,value_type>> find(const key_type& key) const
+    {
+        // Binary search for the first mapping with a key not less than the key.
+        auto entry = progmem_map::m_begin;
+        std::size_t count = progmem_map::m_end - progmem_map::m_begin;
+        while(count > 0)
+        {
+            // Compare the key at the midpoint of the remaining range.
+            std::size_t step = count / 2;
+            auto middle = entry + step;
+            if(std::container::progmem::read(&middle->first) < key)
+            {
+                // Key is in the upper half.
+                entry = middle + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                // Key is in the lower half.
+                count = step;
+            }
+        }
+
+        // Verify the found mapping's key matches.
+        if(entry != progmem_map::m_end && !(key < std::container::progmem::read(&entry->first)))
+        {
+            return entry;
+        }
+
+        return progmem_map::m_end;
+    }
+    /// \brief Checks if a mapping exists for a specified key.
+    /// \param[in] key The key to check.
+    /// \return TRUE if this map contains the specified key, otherwise FALSE.
+    bool contains(const key_type& key) const
+    {
+        return progmem_map::find(key) != progmem_map::end();
+    }
+
+    // CAPACITY
+    /// \brief Gets the number of mappings in the map.
+    /// \return The number of mappings in the map.
+    constexpr std::size_t size() const
+    {
+        return progmem_map::m_end - progmem_map::m_begin;
+    }
+    /// \brief Checks if the map is empty.
+    /// \return TRUE if the map is empty, otherwise FALSE.
+    constexpr bool empty() const
+    {
+        return progmem_map::m_end == progmem_map::m_begin;
+    }
+
+private:
+    // DATA
+    /// \brief The flash address of the beginning of the table.
+    const std::pair<key_type,value_type>* const m_begin;
+    /// \brief The flash address of the end of the table.
+    const std::pair<key_type,value_type>* const m_end;
+};
+
+}
+
+#endif
@@ -0,0 +1,104 @@
+/// \file std/container/progmem/read.hpp
+/// \brief Defines the std::container::progmem::read template function.
+#ifndef STD___CONTAINER___PROGMEM___READ_H
+#define STD___CONTAINER___PROGMEM___READ_H
+
+// std
+#include <std/stddef.hpp>
+#include <std/utility/is_trivially_copyable.hpp>
+
+// arduino
+#include <Arduino.h>
+
+namespace std::container {
+
+/// \brief Contains all code for std flash-resident (PROGMEM) container components.
+namespace progmem {
+
+/// \brief Reads objects of a specified size from flash memory.
+/// \tparam size_value The size of the object in bytes.
+template <std::size_t size_value>
+struct reader
+{
+    /// \brief Reads an object from flash memory.
+    /// \tparam object_type The type of object to read.
+    /// \param[in] address The flash address of the object.
+    /// \param[out] value The object to read into.
+    template <typename object_type>
+    static void read(const object_type* address, object_type& value)
+    {
+        // Copy the object's bytes out of flash.
+        memcpy_P(&value, address, size_value);
+    }
+};
+
+/// \brief Reads single-byte objects from flash memory.
+template <>
+struct reader<1>
+{
+    /// \brief Reads an object from flash memory.
+    /// \tparam object_type The type of object to read.
+    /// \param[in] address The flash address of the object.
+    /// \param[out] value The object to read into.
+    template <typename object_type>
+    static void read(const object_type* address, object_type& value)
+    {
+        // Read the byte and copy it into the object.
+        uint8_t raw = pgm_read_byte(address);
+        memcpy(&value, &raw, 1);
+    }
+};
+
+/// \brief Reads two-byte objects from flash memory.
+template <>
+struct reader<2>
+{
+    /// \brief Reads an object from flash memory.
+    /// \tparam object_type The type of object to read.
+    /// \param[in] address The flash address of the object.
+    /// \param[out] value The object to read into.
+    template <typename object_type>
+    static void read(const object_type* address, object_type& value)
+    {
+        // Read the word and copy it into the object.
+        uint16_t raw = pgm_read_word(address);
+        memcpy(&value, &raw, 2);
+    }
+};
+
+/// \brief Reads four-byte objects from flash memory.
+template <>
+struct reader<4>
+{
+    /// \brief Reads an object from flash memory.
+    /// \tparam object_type The type of object to read.
+    /// \param[in] address The flash address of the object.
+    /// \param[out] value The object to read into.
+    template <typename object_type>
+    static void read(const object_type* address, object_type& value)
+    {
+        // Read the double word and copy it into the object.
+        uint32_t raw = pgm_read_dword(address);
+        memcpy(&value, &raw, 4);
+    }
+};
+
+/// \brief Reads an object from flash memory.
+/// \tparam object_type The type of object to read. Must be default constructible and trivially copyable.
+/// \param[in] address The flash address of the object.
+/// \return A copy of the object in RAM.
+template <typename object_type>
+object_type read(const object_type* address)
+{
+    static_assert(std::is_trivially_copyable<object_type>::value, "Only trivially copyable objects can be read from flash memory.");
+
+    // Read the object using the reader for its size.
+    object_type value;
+    std::container::progmem::reader<sizeof(object_type)>::read(address, value);
+
+    return value;
+}
+
+}}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,208 @@
+/// \file std/container/reverse_iterator.hpp
+/// \brief Defines the std::reverse_iterator template class.
+#ifndef STD___CONTAINER___REVERSE_ITERATOR_H
+#define STD___CONTAINER___REVERSE_ITERATOR_H
+
+// std
+#include <std/container/iterator.hpp>
+
+namespace std {
+
+/// \brief An iterator adaptor that traverses a range backwards.
+/// \tparam iterator_type The bidirectional iterator type of the range.
+/// \details Stores an iterator one past the element it points to, so a reverse iterator constructed from a range's end
+/// points to the range's last element. Random access operations are available when the underlying iterator supports
+/// them.
+template <typename iterator_type>
+class reverse_iterator
+{
+public:
+    // TRAITS
+    /// \brief The category tag of the iterator, which matches the underlying iterator.
+    using iterator_category = typename std::iterator_traits<iterator_type>::iterator_category;
+    /// \brief The type of the elements the iterator points to.
+    using value_type = typename std::iterator_traits<iterator_type>::value_type;
+    /// \brief The type of the distance between two iterators.
+    using difference_type = typename std::iterator_traits<iterator_type>::difference_type;
+    /// \brief The type returned by the iterator's operator->.
+    using pointer = typename std::iterator_traits<iterator_type>::pointer;
+    /// \brief The type returned by dereferencing the iterator.
+    using reference = typename std::iterator_traits<iterator_type>::reference;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new reverse_iterator instance.
+    /// \param[in] current The underlying iterator one past the element to point to.
+    constexpr explicit reverse_iterator(iterator_type current = iterator_type())
+        : m_current(current)
+    {}
+    /// \brief Constructs a new reverse_iterator instance from a reverse_iterator of a convertible type.
+    /// \tparam other_type The underlying iterator type of the other reverse_iterator (e.g. a non-const iterator).
+    /// \param[in] other The other reverse_iterator.
+    template <typename other_type>
+    constexpr reverse_iterator(const std::reverse_iterator<other_type>& other)
+        : m_current(other.base())
+    {}
+
+    // ACCESS
+    /// \brief Gets the underlying iterator, which points one past the element this iterator points to.
+    /// \return The underlying iterator.
+    constexpr iterator_type base() const
+    {
+        return reverse_iterator::m_current;
+    }
+    /// \brief Gets the element this iterator points to.
+    /// \return The element before the underlying iterator.
+    reference operator*() const
+    {
+        iterator_type previous = reverse_iterator::m_current;
+        return *--previous;
+    }
+    /// \brief Gets a pointer to the element this iterator points to.
+    /// \return A pointer to the element.
+    pointer operator->() const
+    {
+        iterator_type previous = reverse_iterator::m_current;
+        return &*--previous;
+    }
+    /// \brief Gets an element at an offset from this iterator.
+    /// \param[in] offset The offset of the element.
+    /// \return The element.
+    reference operator[](difference_type offset) const
+    {
+        return reverse_iterator::m_current[-offset - 1];
+    }
+
+    // MODIFIERS
+    /// \brief Advances the iterator to the next element, which is the previous element of the range.
+    /// \return A reference to this iterator.
+    reverse_iterator& operator++()
+    {
+        --reverse_iterator::m_current;
+        return *this;
+    }
+    /// \brief Advances the iterator to the next element, which is the previous element of the range.
+    /// \return A copy of the iterator before it was advanced.
+    reverse_iterator operator++(int)
+    {
+        reverse_iterator previous = *this;
+        --reverse_iterator::m_current;
+        return previous;
+    }
+    /// \brief Moves the iterator back to the previous element, which is the next element of the range.
+    /// \return A reference to this iterator.
+    reverse_iterator& operator--()
+    {
+        ++reverse_iterator::m_current;
+        return *this;
+    }
+    /// \brief Moves the iterator back to the previous element, which is the next element of the range.
+    /// \return A copy of the iterator before it was moved.
+    reverse_iterator operator--(int)
+    {
+        reverse_iterator previous = *this;
+        ++reverse_iterator::m_current;
+        return previous;
+    }
+    /// \brief Advances the iterator by an offset.
+    /// \param[in] offset The offset to advance by.
+    /// \return A reference to this iterator.
+    reverse_iterator& operator+=(difference_type offset)
+    {
+        reverse_iterator::m_current -= offset;
+        return *this;
+    }
+    /// \brief Moves the iterator back by an offset.
+    /// \param[in] offset The offset to move back by.
+    /// \return A reference to this iterator.
+    reverse_iterator& operator-=(difference_type offset)
+    {
+        reverse_iterator::m_current += offset;
+        return *this;
+    }
+
+    // ARITHMETIC
+    /// \brief Gets an iterator advanced by an offset.
+    /// \param[in] offset The offset to advance by.
+    /// \return The advanced iterator.
+    reverse_iterator operator+(difference_type offset) const
+    {
+        return reverse_iterator(reverse_iterator::m_current - offset);
+    }
+    /// \brief Gets an iterator moved back by an offset.
+    /// \param[in] offset The offset to move back by.
+    /// \return The moved iterator.
+    reverse_iterator operator-(difference_type offset) const
+    {
+        return reverse_iterator(reverse_iterator::m_current + offset);
+    }
+    /// \brief Gets the distance from another iterator to this iterator.
+    /// \param[in] other The other iterator.
+    /// \return The number of increments from the other iterator to this iterator.
+    difference_type operator-(const reverse_iterator& other) const
+    {
+        return other.m_current - reverse_iterator::m_current;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this iterator points to the same element as another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are equal, otherwise FALSE.
+    bool operator==(const reverse_iterator& other) const
+    {
+        return reverse_iterator::m_current == other.m_current;
+    }
+    /// \brief Checks if this iterator points to a different element than another iterator.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if the iterators are unequal, otherwise FALSE.
+    bool operator!=(const reverse_iterator& other) const
+    {
+        return reverse_iterator::m_current != other.m_current;
+    }
+    /// \brief Checks if this iterator is before another iterator in the reversed order.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator is before the other iterator, otherwise FALSE.
+    bool operator<(const reverse_iterator& other) const
+    {
+        return other.m_current < reverse_iterator::m_current;
+    }
+    /// \brief Checks if this iterator is before or equal to another iterator in the reversed order.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator is before or equal to the other iterator, otherwise FALSE.
+    bool operator<=(const reverse_iterator& other) const
+    {
+        return other.m_current <= reverse_iterator::m_current;
+    }
+    /// \brief Checks if this iterator is after another iterator in the reversed order.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator is after the other iterator, otherwise FALSE.
+    bool operator>(const reverse_iterator& other) const
+    {
+        return other.m_current > reverse_iterator::m_current;
+    }
+    /// \brief Checks if this iterator is after or equal to another iterator in the reversed order.
+    /// \param[in] other The other iterator to compare with.
+    /// \return TRUE if this iterator is after or equal to the other iterator, otherwise FALSE.
+    bool operator>=(const reverse_iterator& other) const
+    {
+        return other.m_current >= reverse_iterator::m_current;
+    }
+
+private:
+    // DATA
+    /// \brief The underlying iterator one past the element this iterator points to.
+    iterator_type m_current;
+};
+
+/// \brief Creates a reverse_iterator from an iterator.
+/// \tparam iterator_type The bidirectional iterator type.
+/// \param[in] iterator The underlying iterator one past the element to point to.
+/// \return The reverse_iterator.
+template <typename iterator_type>
+std::reverse_iterator<iterator_type> make_reverse_iterator(iterator_type iterator)
+{
+    return std::reverse_iterator<iterator_type>(iterator);
+}
+
+}
+
+#endif
\ No newline at end of file
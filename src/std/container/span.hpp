@@ -0,0 +1,317 @@
+/// \file std/container/span.hpp
+/// \brief Defines the std::span template class.
+#ifndef STD___CONTAINER___SPAN_H
+#define STD___CONTAINER___SPAN_H
+
+// std
+#include <std/container/dynamic/vector.hpp>
+#include <std/container/fixed/array.hpp>
+#include <std/container/iterator.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/enable_if.hpp>
+
+// arduino
+#include <assert.h>
+
+namespace std {
+
+/// \brief Indicates that a span's extent is determined at runtime.
+constexpr std::size_t dynamic_extent = static_cast<std::size_t>(-1);
+
+namespace container {
+
+/// \brief Contains all code for std span components.
+namespace span {
+
+/// \brief Stores the extent of a span whose size is known at compile time.
+/// \tparam extent_value The extent of the span.
+/// \details A static extent occupies no storage, so a static-extent span is the size of a single pointer.
+template <std::size_t extent_value>
+class extent
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new static extent instance.
+    /// \details The size of the span is discarded, so each span constructor verifies it equals extent_value.
+    constexpr extent(std::size_t)
+    {}
+
+    // CAPACITY
+    /// \brief Gets the size of the span.
+    /// \return The size of the span.
+    constexpr std::size_t size() const
+    {
+        return extent_value;
+    }
+};
+
+/// \brief Stores the extent of a span whose size is determined at runtime.
+template <>
+class extent<std::dynamic_extent>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new dynamic extent instance.
+    /// \param[in] size The size of the span.
+    constexpr extent(std::size_t size)
+        : m_size(size)
+    {}
+
+    // CAPACITY
+    /// \brief Gets the size of the span.
+    /// \return The size of the span.
+    constexpr std::size_t size() const
+    {
+        return extent::m_size;
+    }
+
+private:
+    // DATA
+    /// \brief The number of elements in the span.
+    std::size_t m_size;
+};
+
+/// \brief Verifies that a size determined at runtime matches a static extent.
+/// \tparam extent_value The static extent.
+/// \param[in] size The size to verify.
+/// \return The size.
+template <std::size_t extent_value>
+constexpr std::size_t checked_size(std::size_t size)
+{
+    return assert(size == extent_value), size;
+}
+
+}}
+
+/// \brief A non-owning view of a contiguous sequence of objects.
+/// \tparam object_type The object type viewed by the span. Use a const type for a read-only span.
+/// \tparam extent_value The number of objects in the span, or std::dynamic_extent if determined at runtime.
+/// \details A span is a pointer and size, so it is cheap to pass by value. It does not own the objects it views, so it
+/// must not outlive the container it was constructed from.
+template <typename object_type, std::size_t extent_value = std::dynamic_extent>
+class span
+    : public std::container::span::extent<extent_value>
+{
+public:
+    // CONSTANTS
+    /// \brief The extent of the span.
+    static constexpr std::size_t extent = extent_value;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty span instance.
+    constexpr span()
+        : std::container::span::extent<extent_value>(0),
+          m_begin(nullptr)
+    {}
+    /// \brief Constructs a new span instance over a sequence of objects.
+    /// \param[in] data The beginning of the sequence.
+    /// \param[in] size The number of objects in the sequence. Must equal extent_value for a static-extent span.
+    constexpr span(object_type* data, std::size_t size)
+        : std::container::span::extent<extent_value>(size),
+          m_begin(data)
+    {}
+    /// \brief Constructs a new span instance over a C array.
+    /// \tparam size_value The size of the C array.
+    /// \param[in] array The C array to view.
+    template <std::size_t size_value>
+    constexpr span(object_type (&array)[size_value])
+        : std::container::span::extent<extent_value>(size_value),
+          m_begin(array)
+    {
+        static_assert(extent_value == std::dynamic_extent || size_value == extent_value, "The array size does not match the span extent.");
+    }
+    /// \brief Constructs a new span instance over an array.
+    /// \tparam array_type The object type of the array.
+    /// \tparam size_value The size of the array.
+    /// \param[in] array The array to view.
+    template <typename array_type, std::size_t size_value>
+    span(std::array<array_type,size_value>& array)
+        : std::container::span::extent<extent_value>(size_value),
+          m_begin(array.data())
+    {
+        static_assert(extent_value == std::dynamic_extent || size_value == extent_value, "The array size does not match the span extent.");
+    }
+    /// \brief Constructs a new read-only span instance over a const array.
+    /// \tparam array_type The object type of the array.
+    /// \tparam size_value The size of the array.
+    /// \param[in] array The array to view.
+    template <typename array_type, std::size_t size_value>
+    constexpr span(const std::array<array_type,size_value>& array)
+        : std::container::span::extent<extent_value>(size_value),
+          m_begin(array.data())
+    {
+        static_assert(extent_value == std::dynamic_extent || size_value == extent_value, "The array size does not match the span extent.");
+    }
+    /// \brief Constructs a new dynamic-extent span instance over a vector.
+    /// \tparam vector_type The object type of the vector.
+    /// \param[in] vector The vector to view.
+    /// \note The span is invalidated if the vector's size is reduced.
+    template <typename vector_type, std::size_t span_extent = extent_value, typename std::enable_if<span_extent == std::dynamic_extent,int>::type = 0>
+    span(std::vector<vector_type>& vector)
+        : std::container::span::extent<extent_value>(vector.size()),
+          m_begin(vector.data())
+    {}
+    /// \brief Constructs a new dynamic-extent read-only span instance over a const vector.
+    /// \tparam vector_type The object type of the vector.
+    /// \param[in] vector The vector to view.
+    /// \note The span is invalidated if the vector's size is reduced.
+    template <typename vector_type, std::size_t span_extent = extent_value, typename std::enable_if<span_extent == std::dynamic_extent,int>::type = 0>
+    span(const std::vector<vector_type>& vector)
+        : std::container::span::extent<extent_value>(vector.size()),
+          m_begin(vector.data())
+    {}
+    /// \brief Constructs a new static-extent span instance over a vector.
+    /// \tparam vector_type The object type of the vector.
+    /// \param[in] vector The vector to view, whose size must equal extent_value.
+    /// \note The span is invalidated if the vector's size is reduced.
+    template <typename vector_type, std::size_t span_extent = extent_value, typename std::enable_if<span_extent != std::dynamic_extent,int>::type = 0>
+    explicit span(std::vector<vector_type>& vector)
+        : std::container::span::extent<extent_value>(std::container::span::checked_size<extent_value>(vector.size())),
+          m_begin(vector.data())
+    {}
+    /// \brief Constructs a new static-extent read-only span instance over a const vector.
+    /// \tparam vector_type The object type of the vector.
+    /// \param[in] vector The vector to view, whose size must equal extent_value.
+    /// \note The span is invalidated if the vector's size is reduced.
+    template <typename vector_type, std::size_t span_extent = extent_value, typename std::enable_if<span_extent != std::dynamic_extent,int>::type = 0>
+    explicit span(const std::vector<vector_type>& vector)
+        : std::container::span::extent<extent_value>(std::container::span::checked_size<extent_value>(vector.size())),
+          m_begin(vector.data())
+    {}
+    /// \brief Constructs a new span instance from another span, such as a static-extent or non-const span.
+    /// \tparam other_type The object type of the other span.
+    /// \tparam other_extent The extent of the other span, which must match a static extent of this span.
+    /// \param[in] other The other span to view.
+    template <typename other_type, std::size_t other_extent, typename std::enable_if<extent_value == std::dynamic_extent || other_extent != std::dynamic_extent,int>::type = 0>
+    constexpr span(const std::span<other_type,other_extent>& other)
+        : std::container::span::extent<extent_value>(other.size()),
+          m_begin(other.data())
+    {
+        static_assert(extent_value == std::dynamic_extent || other_extent == extent_value, "The span extents do not match.");
+    }
+    /// \brief Constructs a new static-extent span instance from a dynamic-extent span.
+    /// \tparam other_type The object type of the other span.
+    /// \param[in] other The other span to view, whose size must equal extent_value.
+    template <typename other_type, std::size_t other_extent, typename std::enable_if<extent_value != std::dynamic_extent && other_extent == std::dynamic_extent,int>::type = 0>
+    constexpr explicit span(const std::span<other_type,other_extent>& other)
+        : std::container::span::extent<extent_value>(std::container::span::checked_size<extent_value>(other.size())),
+          m_begin(other.data())
+    {}
+
+    // ACCESS
+    /// \brief Gets an iterator to the beginning of the span.
+    /// \return The begin iterator.
+    constexpr std::iterator<object_type> begin() const
+    {
+        return span::m_begin;
+    }
+    /// \brief Gets an iterator to the end of the span.
+    /// \return The end iterator.
+    constexpr std::iterator<object_type> end() const
+    {
+        return span::m_begin + span::size();
+    }
+    /// \brief Gets a reference to the object at a specified index.
+    /// \param[in] index The index of the object to get.
+    /// \return A reference to the object.
+    constexpr object_type& operator[](std::size_t index) const
+    {
+        return span::m_begin[index];
+    }
+    /// \brief Gets a reference to the first object in the span.
+    /// \return A reference to the first object.
+    constexpr object_type& front() const
+    {
+        return span::m_begin[0];
+    }
+    /// \brief Gets a reference to the last object in the span.
+    /// \return A reference to the last object.
+    constexpr object_type& back() const
+    {
+        return span::m_begin[span::size() - 1];
+    }
+    /// \brief Gets a pointer to the beginning of the span.
+    /// \return A pointer to the beginning of the span.
+    constexpr object_type* data() const
+    {
+        return span::m_begin;
+    }
+
+    // CAPACITY
+    /// \brief Gets the size of the span in bytes.
+    /// \return The size of the span in bytes.
+    constexpr std::size_t size_bytes() const
+    {
+        return span::size() * sizeof(object_type);
+    }
+    /// \brief Checks if the span is empty.
+    /// \return TRUE if the span is empty, otherwise FALSE.
+    constexpr bool empty() const
+    {
+        return span::size() == 0;
+    }
+
+    // OPERATIONS
+    /// \brief Gets a span of the first objects in this span.
+    /// \param[in] count The maximum number of objects in the new span.
+    /// \return A span of the first objects. The count is clamped to the size of this span.
+    std::span<object_type> first(std::size_t count) const
+    {
+        return std::span<object_type>(span::m_begin, count < span::size() ? count : span::size());
+    }
+    /// \brief Gets a static-extent span of the first objects in this span.
+    /// \tparam count The number of objects in the new span, which must not exceed the size of this span.
+    /// \return A span of the first objects.
+    template <std::size_t count>
+    constexpr std::span<object_type,count> first() const
+    {
+        return std::span<object_type,count>(span::m_begin, count);
+    }
+    /// \brief Gets a span of the last objects in this span.
+    /// \param[in] count The maximum number of objects in the new span.
+    /// \return A span of the last objects. The count is clamped to the size of this span.
+    std::span<object_type> last(std::size_t count) const
+    {
+        return count < span::size() ? std::span<object_type>(span::m_begin + span::size() - count, count) : std::span<object_type>(span::m_begin, span::size());
+    }
+    /// \brief Gets a static-extent span of the last objects in this span.
+    /// \tparam count The number of objects in the new span, which must not exceed the size of this span.
+    /// \return A span of the last objects.
+    template <std::size_t count>
+    constexpr std::span<object_type,count> last() const
+    {
+        return std::span<object_type,count>(span::m_begin + span::size() - count, count);
+    }
+    /// \brief Gets a span of a subsequence of this span.
+    /// \param[in] offset The index of the first object in the new span.
+    /// \param[in] count The maximum number of objects in the new span, or std::dynamic_extent for all remaining objects.
+    /// \return A span of the subsequence. The offset and count are clamped to the end of this span.
+    std::span<object_type> subspan(std::size_t offset, std::size_t count = std::dynamic_extent) const
+    {
+        // Clamp offset and count to the span.
+        std::size_t size = span::size();
+        if(offset > size)
+        {
+            offset = size;
+        }
+        if(count > size - offset)
+        {
+            count = size - offset;
+        }
+
+        return std::span<object_type>(span::m_begin + offset, count);
+    }
+
+private:
+    // DATA
+    /// \brief The beginning of the viewed sequence.
+    object_type* m_begin;
+};
+
+/// \brief The extent of the span.
+template <typename object_type, std::size_t extent_value>
+constexpr std::size_t span<object_type,extent_value>::extent;
+
+}
+
+#endif
\ No newline at end of file
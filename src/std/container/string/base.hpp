@@ -0,0 +1,605 @@
+/// \file std/container/string/base.hpp
+/// \brief Defines the std::container::string::base template class.
+#ifndef STD___CONTAINER___STRING___BASE_H
+#define STD___CONTAINER___STRING___BASE_H
+
+// std
+#include <std/container/iterator.hpp>
+#include <std/container/string/string_view.hpp>
+#include <std/stddef.hpp>
+
+// arduino
+#include <Arduino.h>
+
+namespace std::container {
+
+/// \brief Contains all code for std string components.
+namespace string {
+
+/// \brief A base capacity-bounded, null-terminated string.
+/// \tparam char_type The character type of the string.
+/// \details The base operates on storage provided by the derived string, which must hold capacity + 1 characters so
+/// that the string is always null-terminated. The string never reallocates; operations that would exceed its capacity
+/// fail and leave the string unchanged.
+template <typename char_type>
+class base
+{
+public:
+    // CONSTANTS
+    /// \brief Indicates the end of the string, or that a search found no match.
+    static constexpr std::size_t npos = std::basic_string_view<char_type>::npos;
+
+    // ACCESS
+    /// \brief Gets an iterator to the beginning of the string.
+    /// \return The begin iterator.
+    std::iterator<char_type> begin()
+    {
+        return base::m_begin;
+    }
+    /// \brief Gets an iterator to the end of the string.
+    /// \return The end iterator.
+    std::iterator<char_type> end()
+    {
+        return base::m_end;
+    }
+    /// \brief Gets a const_iterator to the beginning of the string.
+    /// \return The begin const_iterator.
+    std::const_iterator<char_type> cbegin() const
+    {
+        return base::m_begin;
+    }
+    /// \brief Gets a const_iterator to the end of the string.
+    /// \return The end const_iterator.
+    std::const_iterator<char_type> cend() const
+    {
+        return base::m_end;
+    }
+    /// \brief Gets a reference to the character at a specified index.
+    /// \param[in] index The index of the character to get.
+    /// \return A reference to the character.
+    char_type& operator[](std::size_t index)
+    {
+        return base::m_begin[index];
+    }
+    /// \brief Gets a const reference to the character at a specified index.
+    /// \param[in] index The index of the character to get.
+    /// \return A const reference to the character.
+    const char_type& operator[](std::size_t index) const
+    {
+        return base::m_begin[index];
+    }
+    /// \brief Gets a reference to the character at a specified index.
+    /// \param[in] index The index of the character to get.
+    /// \return A reference to the character.
+    char_type& at(std::size_t index)
+    {
+        return base::m_begin[index];
+    }
+    /// \brief Gets a const reference to the character at a specified index.
+    /// \param[in] index The index of the character to get.
+    /// \return A const reference to the character.
+    const char_type& at(std::size_t index) const
+    {
+        return base::m_begin[index];
+    }
+    /// \brief Gets a reference to the first character in the string.
+    /// \return A reference to the first character.
+    char_type& front()
+    {
+        return *base::m_begin;
+    }
+    /// \brief Gets a const reference to the first character in the string.
+    /// \return A const reference to the first character.
+    const char_type& front() const
+    {
+        return *base::m_begin;
+    }
+    /// \brief Gets a reference to the last character in the string.
+    /// \return A reference to the last character.
+    char_type& back()
+    {
+        return *(base::m_end - 1);
+    }
+    /// \brief Gets a const reference to the last character in the string.
+    /// \return A const reference to the last character.
+    const char_type& back() const
+    {
+        return *(base::m_end - 1);
+    }
+    /// \brief Gets a pointer to the string's null-terminated character sequence.
+    /// \return A pointer to the null-terminated character sequence.
+    const char_type* c_str() const
+    {
+        return base::m_begin;
+    }
+    /// \brief Gets a pointer to the string's null-terminated character sequence.
+    /// \return A pointer to the null-terminated character sequence.
+    char_type* data()
+    {
+        return base::m_begin;
+    }
+    /// \brief Gets a pointer to the string's null-terminated character sequence.
+    /// \return A pointer to the null-terminated character sequence.
+    const char_type* data() const
+    {
+        return base::m_begin;
+    }
+    /// \brief Gets a view of the string.
+    /// \return A view of the string's characters.
+    operator std::basic_string_view<char_type>() const
+    {
+        return std::basic_string_view<char_type>(base::m_begin, base::m_end - base::m_begin);
+    }
+
+    // CAPACITY
+    /// \brief Gets the number of characters in the string.
+    /// \return The number of characters in the string.
+    std::size_t size() const
+    {
+        return base::m_end - base::m_begin;
+    }
+    /// \brief Gets the number of characters in the string.
+    /// \return The number of characters in the string.
+    std::size_t length() const
+    {
+        return base::m_end - base::m_begin;
+    }
+    /// \brief Gets the maximum number of characters the string can hold, excluding the null terminator.
+    /// \return The capacity of the string.
+    std::size_t capacity() const
+    {
+        return base::m_capacity - base::m_begin;
+    }
+    /// \brief Checks if the string is empty.
+    /// \return TRUE if the string is empty, otherwise FALSE.
+    bool empty() const
+    {
+        return base::m_end == base::m_begin;
+    }
+    /// \brief Checks if the string is at capacity.
+    /// \return TRUE if the string is at capacity, otherwise FALSE.
+    bool full() const
+    {
+        return base::m_end == base::m_capacity;
+    }
+
+    // MODIFIERS
+    /// \brief Clears all characters from the string.
+    void clear()
+    {
+        base::m_end = base::m_begin;
+        *base::m_end = char_type(0);
+    }
+    /// \brief Appends a character to the end of the string.
+    /// \param[in] character The character to append.
+    /// \return TRUE if the operation succeeded, FALSE if the string is at capacity.
+    bool push_back(char_type character)
+    {
+        // Verify string space.
+        if(base::m_end == base::m_capacity)
+        {
+            return false;
+        }
+
+        // Add character and terminate.
+        *base::m_end++ = character;
+        *base::m_end = char_type(0);
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Removes the last character from the string.
+    void pop_back()
+    {
+        // Verify string isn't empty.
+        if(base::m_end == base::m_begin)
+        {
+            return;
+        }
+
+        // Decrement end and terminate.
+        *--base::m_end = char_type(0);
+    }
+    /// \brief Appends a sequence of characters to the end of the string.
+    /// \param[in] characters The characters to append.
+    /// \return TRUE if the operation succeeded, FALSE if the string does not have enough capacity.
+    bool append(const std::basic_string_view<char_type>& characters)
+    {
+        // Verify string space.
+        if(static_cast<std::size_t>(base::m_capacity - base::m_end) < characters.size())
+        {
+            return false;
+        }
+
+        // Copy characters and terminate.
+        for(auto entry = characters.cbegin(); entry != characters.cend(); ++entry)
+        {
+            *base::m_end++ = *entry;
+        }
+        *base::m_end = char_type(0);
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Appends a null-terminated sequence of characters to the end of the string.
+    /// \param[in] characters The null-terminated characters to append.
+    /// \return TRUE if the operation succeeded, FALSE if the string does not have enough capacity.
+    bool append(const char_type* characters)
+    {
+        return base::append(std::basic_string_view<char_type>(characters));
+    }
+    /// \brief Appends a repeated character to the end of the string.
+    /// \param[in] count The number of characters to append.
+    /// \param[in] character The character to append.
+    /// \return TRUE if the operation succeeded, FALSE if the string does not have enough capacity.
+    bool append(std::size_t count, char_type character)
+    {
+        // Verify string space.
+        if(static_cast<std::size_t>(base::m_capacity - base::m_end) < count)
+        {
+            return false;
+        }
+
+        // Add characters and terminate.
+        for(auto end = base::m_end + count; base::m_end != end;)
+        {
+            *base::m_end++ = character;
+        }
+        *base::m_end = char_type(0);
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Appends the decimal or other radix representation of a signed integer to the end of the string.
+    /// \param[in] value The value to append.
+    /// \param[in] radix The radix to format the value in, from 2 to 36.
+    /// \return TRUE if the operation succeeded, FALSE if the string does not have enough capacity or the radix is out of
+    /// range.
+    bool append_integer(long value, uint8_t radix = 10)
+    {
+        // Format the magnitude, then prefix the sign if negative.
+        unsigned long magnitude = value < 0 ? 0UL - static_cast<unsigned long>(value) : static_cast<unsigned long>(value);
+        return base::append_digits(magnitude, radix, value < 0);
+    }
+    /// \brief Appends the decimal or other radix representation of an unsigned integer to the end of the string.
+    /// \param[in] value The value to append.
+    /// \param[in] radix The radix to format the value in, from 2 to 36.
+    /// \return TRUE if the operation succeeded, FALSE if the string does not have enough capacity or the radix is out of
+    /// range.
+    bool append_unsigned(unsigned long value, uint8_t radix = 10)
+    {
+        return base::append_digits(value, radix, false);
+    }
+    /// \brief Appends the fixed-point decimal representation of a floating point value to the end of the string.
+    /// \param[in] value The value to append.
+    /// \param[in] decimals The number of digits to append after the decimal point, up to 9.
+    /// \return TRUE if the operation succeeded, FALSE if the string does not have enough capacity, decimals exceeds 9, or
+    /// the integer part of the value does not fit within an unsigned long.
+    /// \note NaN and infinite values are appended as "nan", "inf", and "-inf".
+    bool append_float(double value, uint8_t decimals = 2)
+    {
+        // Verify the fractional digits fit within a 32-bit unsigned long.
+        if(decimals > 9)
+        {
+            return false;
+        }
+
+        // Handle special values. Only an infinite value gives NaN when subtracted from itself.
+        if(value != value)
+        {
+            return base::append("nan");
+        }
+        if(value - value != value - value)
+        {
+            return base::append(value < 0 ? "-inf" : "inf");
+        }
+
+        // Capture the sign and round to the requested number of decimals.
+        bool negative = value < 0;
+        if(negative)
+        {
+            value = -value;
+        }
+        double scale = 1.0;
+        for(uint8_t i = 0; i < decimals; ++i)
+        {
+            scale *= 10.0;
+        }
+        value += 0.5 / scale;
+
+        // Verify the integer part fits within an unsigned long.
+        if(!(value < static_cast<double>(static_cast<unsigned long>(-1)) + 1.0))
+        {
+            return false;
+        }
+
+        // Split into integer and fractional parts.
+        unsigned long integer = static_cast<unsigned long>(value);
+        unsigned long fraction = static_cast<unsigned long>((value - integer) * scale);
+
+        // Append the integer part and decimal point, restoring the string on failure.
+        auto original_end = base::m_end;
+        if(!base::append_digits(integer, 10, negative) || (decimals > 0 && !base::push_back('.')))
+        {
+            base::m_end = original_end;
+            *base::m_end = char_type(0);
+            return false;
+        }
+
+        // Append the fractional digits, including leading zeros.
+        if(decimals > 0)
+        {
+            if(static_cast<std::size_t>(base::m_capacity - base::m_end) < decimals)
+            {
+                base::m_end = original_end;
+                *base::m_end = char_type(0);
+                return false;
+            }
+            for(auto digit = base::m_end + decimals; digit != base::m_end;)
+            {
+                *--digit = char_type('0' + fraction % 10);
+                fraction /= 10;
+            }
+            base::m_end += decimals;
+            *base::m_end = char_type(0);
+        }
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Replaces the contents of the string with a sequence of characters.
+    /// \param[in] characters The characters to assign.
+    /// \return TRUE if the operation succeeded, FALSE if the string does not have enough capacity.
+    bool assign(const std::basic_string_view<char_type>& characters)
+    {
+        // Verify string space.
+        if(base::capacity() < characters.size())
+        {
+            return false;
+        }
+
+        // Clear and append.
+        base::clear();
+        return base::append(characters);
+    }
+    /// \brief Erases characters from the string.
+    /// \param[in] position The index of the first character to erase.
+    /// \param[in] count The maximum number of characters to erase.
+    void erase(std::size_t position, std::size_t count = npos)
+    {
+        // Clamp the range to the string.
+        std::size_t size = base::size();
+        if(position > size)
+        {
+            return;
+        }
+        if(count > size - position)
+        {
+            count = size - position;
+        }
+
+        // Shift the remaining characters, including the null terminator, left.
+        for(auto entry = base::m_begin + position; entry + count <= base::m_end; ++entry)
+        {
+            *entry = *(entry + count);
+        }
+        base::m_end -= count;
+    }
+    /// \brief Resizes the string, filling additional characters with a specified character.
+    /// \param[in] size The size to set the string to.
+    /// \param[in] character The character to assign to additional characters.
+    /// \return TRUE if the resize succeeded, FALSE if the string does not have enough capacity.
+    bool resize(std::size_t size, char_type character = char_type(0))
+    {
+        // Verify string space.
+        if(size > base::capacity())
+        {
+            return false;
+        }
+
+        // Fill any additional characters and terminate.
+        auto end = base::m_begin + size;
+        while(base::m_end < end)
+        {
+            *base::m_end++ = character;
+        }
+        base::m_end = end;
+        *base::m_end = char_type(0);
+
+        // Indicate success.
+        return true;
+    }
+    /// \brief Appends a character to the end of the string.
+    /// \param[in] character The character to append.
+    /// \return A reference to this string.
+    /// \note The string is left unchanged if it does not have enough capacity.
+    base& operator+=(char_type character)
+    {
+        base::push_back(character);
+        return *this;
+    }
+    /// \brief Appends a sequence of characters to the end of the string.
+    /// \param[in] characters The characters to append.
+    /// \return A reference to this string.
+    /// \note The string is left unchanged if it does not have enough capacity.
+    base& operator+=(const std::basic_string_view<char_type>& characters)
+    {
+        base::append(characters);
+        return *this;
+    }
+    /// \brief Appends a null-terminated sequence of characters to the end of the string.
+    /// \param[in] characters The null-terminated characters to append.
+    /// \return A reference to this string.
+    /// \note The string is left unchanged if it does not have enough capacity.
+    base& operator+=(const char_type* characters)
+    {
+        base::append(characters);
+        return *this;
+    }
+
+    // OPERATIONS
+    /// \brief Gets a view of a substring of this string.
+    /// \param[in] position The index of the first character of the substring.
+    /// \param[in] count The maximum number of characters in the substring.
+    /// \return A view of the substring, which remains valid until the string is modified.
+    std::basic_string_view<char_type> substr(std::size_t position = 0, std::size_t count = npos) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this).substr(position, count);
+    }
+    /// \brief Lexicographically compares this string with a sequence of characters.
+    /// \param[in] other The characters to compare with.
+    /// \return A negative value if this string is less than the other, zero if equal, or a positive value if greater.
+    int compare(const std::basic_string_view<char_type>& other) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this).compare(other);
+    }
+    /// \brief Checks if this string begins with a sequence of characters.
+    /// \param[in] prefix The prefix to check for.
+    /// \return TRUE if this string begins with the prefix, otherwise FALSE.
+    bool starts_with(const std::basic_string_view<char_type>& prefix) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this).starts_with(prefix);
+    }
+    /// \brief Checks if this string ends with a sequence of characters.
+    /// \param[in] suffix The suffix to check for.
+    /// \return TRUE if this string ends with the suffix, otherwise FALSE.
+    bool ends_with(const std::basic_string_view<char_type>& suffix) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this).ends_with(suffix);
+    }
+
+    // LOOKUP
+    /// \brief Finds the first occurrence of a character.
+    /// \param[in] character The character to find.
+    /// \param[in] position The index to start searching from.
+    /// \return The index of the found character, or npos if not found.
+    std::size_t find(char_type character, std::size_t position = 0) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this).find(character, position);
+    }
+    /// \brief Finds the first occurrence of a substring.
+    /// \param[in] substring The substring to find.
+    /// \param[in] position The index to start searching from.
+    /// \return The index of the beginning of the found substring, or npos if not found.
+    std::size_t find(const std::basic_string_view<char_type>& substring, std::size_t position = 0) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this).find(substring, position);
+    }
+    /// \brief Finds the last occurrence of a character.
+    /// \param[in] character The character to find.
+    /// \return The index of the found character, or npos if not found.
+    std::size_t rfind(char_type character) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this).rfind(character);
+    }
+
+    // COMPARISON
+    /// \brief Checks if this string is equal to a sequence of characters.
+    /// \param[in] other The characters to compare with.
+    /// \return TRUE if the string contains the same characters, otherwise FALSE.
+    bool operator==(const std::basic_string_view<char_type>& other) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this) == other;
+    }
+    /// \brief Checks if this string is unequal with a sequence of characters.
+    /// \param[in] other The characters to compare with.
+    /// \return TRUE if the string contains different characters, otherwise FALSE.
+    bool operator!=(const std::basic_string_view<char_type>& other) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this) != other;
+    }
+    /// \brief Checks if this string is equal to a null-terminated sequence of characters.
+    /// \param[in] other The null-terminated characters to compare with.
+    /// \return TRUE if the string contains the same characters, otherwise FALSE.
+    bool operator==(const char_type* other) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this) == std::basic_string_view<char_type>(other);
+    }
+    /// \brief Checks if this string is unequal with a null-terminated sequence of characters.
+    /// \param[in] other The null-terminated characters to compare with.
+    /// \return TRUE if the string contains different characters, otherwise FALSE.
+    bool operator!=(const char_type* other) const
+    {
+        return static_cast<std::basic_string_view<char_type>>(*this) != std::basic_string_view<char_type>(other);
+    }
+
+protected:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty base string instance over provided storage.
+    /// \param[in] storage The storage for the string, which must hold capacity + 1 characters.
+    /// \param[in] capacity The maximum number of characters the string can hold, excluding the null terminator.
+    base(char_type* storage, std::size_t capacity)
+        : m_begin(storage),
+          m_end(storage),
+          m_capacity(storage + capacity)
+    {
+        // Terminate the empty string.
+        *base::m_end = char_type(0);
+    }
+
+    // MEMORY
+    /// \brief Stores a pointer to the beginning of the string's storage.
+    char_type* m_begin;
+    /// \brief Stores a pointer to the end of the string's characters, which always holds the null terminator.
+    char_type* m_end;
+    /// \brief Stores a pointer to the capacity limit of the string's characters. One additional character of storage
+    /// exists past this limit for the null terminator.
+    char_type* m_capacity;
+
+private:
+    // FORMATTING
+    /// \brief Appends the digits of an unsigned value to the end of the string.
+    /// \param[in] value The value to append.
+    /// \param[in] radix The radix to format the value in, from 2 to 36.
+    /// \param[in] negative Indicates if a minus sign should prefix the digits.
+    /// \return TRUE if the operation succeeded, FALSE if the string does not have enough capacity or the radix is out of
+    /// range.
+    bool append_digits(unsigned long value, uint8_t radix, bool negative)
+    {
+        // Verify the radix has digits to format with.
+        if(radix < 2 || radix > 36)
+        {
+            return false;
+        }
+
+        // Count the digits.
+        std::size_t digits = 1;
+        for(unsigned long remaining = value / radix; remaining != 0; remaining /= radix)
+        {
+            ++digits;
+        }
+
+        // Verify string space.
+        if(static_cast<std::size_t>(base::m_capacity - base::m_end) < digits + negative)
+        {
+            return false;
+        }
+
+        // Write the sign.
+        if(negative)
+        {
+            *base::m_end++ = char_type('-');
+        }
+
+        // Write the digits from least to most significant.
+        base::m_end += digits;
+        for(auto digit = base::m_end; digit != base::m_end - digits;)
+        {
+            uint8_t remainder = value % radix;
+            *--digit = char_type(remainder < 10 ? '0' + remainder : 'a' + remainder - 10);
+            value /= radix;
+        }
+        *base::m_end = char_type(0);
+
+        // Indicate success.
+        return true;
+    }
+};
+
+/// \brief Indicates the end of the string, or that a search found no match.
+template <typename char_type>
+constexpr std::size_t base<char_type>::npos;
+
+}}
+
+#endif
\ No newline at end of file
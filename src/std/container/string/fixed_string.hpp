@@ -0,0 +1,70 @@
+/// \file std/container/string/fixed_string.hpp
+/// \brief Defines the std::fixed_string template class.
+#ifndef STD___CONTAINER___STRING___FIXED_STRING_H
+#define STD___CONTAINER___STRING___FIXED_STRING_H
+
+// std
+#include <std/container/string/base.hpp>
+
+namespace std {
+
+/// \brief A capacity-bounded, null-terminated string stored inline without dynamic allocation.
+/// \tparam capacity_value The maximum number of characters the string can hold, excluding the null terminator.
+template <std::size_t capacity_value>
+class fixed_string
+    : public std::container::string::base<char>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty fixed string instance.
+    fixed_string()
+        : std::container::string::base<char>(m_storage, capacity_value)
+    {}
+    /// \brief Constructs a new fixed string instance from a sequence of characters.
+    /// \param[in] characters The characters to initialize the string with.
+    /// \note The string is left empty if the characters exceed the capacity.
+    fixed_string(const std::string_view& characters)
+        : std::container::string::base<char>(m_storage, capacity_value)
+    {
+        fixed_string::append(characters);
+    }
+    /// \brief Constructs a new fixed string instance from a null-terminated sequence of characters.
+    /// \param[in] characters The null-terminated characters to initialize the string with.
+    /// \note The string is left empty if the characters exceed the capacity.
+    fixed_string(const char* characters)
+        : std::container::string::base<char>(m_storage, capacity_value)
+    {
+        fixed_string::append(characters);
+    }
+    /// \brief Copy-constructs a new fixed string from an existing fixed string.
+    /// \param[in] other The other fixed string to copy-construct from.
+    fixed_string(const std::fixed_string<capacity_value>& other)
+        : std::container::string::base<char>(m_storage, capacity_value)
+    {
+        fixed_string::append(other);
+    }
+
+    // MODIFIERS
+    /// \brief Copy-assigns the contents of another fixed string to this fixed string.
+    /// \param[in] other The other fixed string to copy-assign from.
+    /// \return A reference to this fixed string.
+    std::fixed_string<capacity_value>& operator=(const std::fixed_string<capacity_value>& other)
+    {
+        // Check for self-assignment.
+        if(&other != this)
+        {
+            fixed_string::assign(other);
+        }
+
+        return *this;
+    }
+
+private:
+    // DATA
+    /// \brief Stores the string's characters and null terminator.
+    char m_storage[capacity_value + 1];
+};
+
+}
+
+#endif
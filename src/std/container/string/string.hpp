@@ -0,0 +1,117 @@
+/// \file std/container/string/string.hpp
+/// \brief Defines the std::basic_string template class and std::string type definition.
+#ifndef STD___CONTAINER___STRING___STRING_H
+#define STD___CONTAINER___STRING___STRING_H
+
+// std
+#include <std/container/string/base.hpp>
+
+namespace std {
+
+/// \brief A capacity-bounded, null-terminated string allocated once at construction.
+/// \tparam char_type The character type of the string.
+template <typename char_type>
+class basic_string
+    : public std::container::string::base<char_type>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty string instance.
+    /// \param[in] capacity The maximum number of characters the string can hold, excluding the null terminator.
+    basic_string(std::size_t capacity)
+        : std::container::string::base<char_type>(new char_type[capacity + 1], capacity)
+    {}
+    /// \brief Constructs a new string instance from a sequence of characters.
+    /// \param[in] capacity The maximum number of characters the string can hold, excluding the null terminator.
+    /// \param[in] characters The characters to initialize the string with.
+    /// \note The string is left empty if the characters exceed the capacity.
+    basic_string(std::size_t capacity, const std::basic_string_view<char_type>& characters)
+        : std::container::string::base<char_type>(new char_type[capacity + 1], capacity)
+    {
+        basic_string::append(characters);
+    }
+    /// \brief Copy-constructs a new string from an existing string.
+    /// \param[in] other The other string to copy-construct from.
+    /// \note This performs a deep copy.
+    basic_string(const std::basic_string<char_type>& other)
+        : std::container::string::base<char_type>(new char_type[other.capacity() + 1], other.capacity())
+    {
+        basic_string::append(other);
+    }
+    /// \brief Move-constructs a new string from an existing string.
+    /// \param[in] other The other string to move-construct from.
+    basic_string(std::basic_string<char_type>&& other)
+        : std::container::string::base<char_type>(new char_type[other.capacity() + 1], other.capacity())
+    {
+        basic_string::swap(other);
+    }
+    ~basic_string()
+    {
+        // Clean up allocated memory.
+        delete [] basic_string::m_begin;
+    }
+
+    // MODIFIERS
+    /// \brief Swaps the contents of this string with another string.
+    /// \param[in] other The other string to swap with.
+    void swap(std::basic_string<char_type>& other)
+    {
+        // Store this string's pointers in a temporary.
+        auto temp_begin = basic_string::m_begin;
+        auto temp_end = basic_string::m_end;
+        auto temp_capacity = basic_string::m_capacity;
+
+        // Store the other string's pointers in this string.
+        basic_string::m_begin = other.m_begin;
+        basic_string::m_end = other.m_end;
+        basic_string::m_capacity = other.m_capacity;
+
+        // Store this string's original pointers in the other string.
+        other.m_begin = temp_begin;
+        other.m_end = temp_end;
+        other.m_capacity = temp_capacity;
+    }
+    /// \brief Copy-assigns the contents of another string to this string.
+    /// \param[in] other The other string to copy-assign from.
+    /// \return A reference to this string.
+    /// \note This performs a deep copy, reallocating this string to the other string's capacity.
+    std::basic_string<char_type>& operator=(const std::basic_string<char_type>& other)
+    {
+        // Check for self-assignment.
+        if(&other == this)
+        {
+            return *this;
+        }
+
+        // Create new memory based on the other string's capacity.
+        delete [] basic_string::m_begin;
+        basic_string::m_begin = new char_type[other.capacity() + 1];
+        basic_string::m_end = basic_string::m_begin;
+        basic_string::m_capacity = basic_string::m_begin + other.capacity();
+
+        // Copy characters from other.
+        basic_string::append(other);
+
+        return *this;
+    }
+    /// \brief Move-assigns the contents of another string to this string.
+    /// \param[in] other The other string to move-assign from.
+    /// \return A reference to this string.
+    std::basic_string<char_type>& operator=(std::basic_string<char_type>&& other)
+    {
+        // Take the other string's memory, leaving it this string's memory.
+        basic_string::swap(other);
+
+        // Reset the other string to an empty string.
+        other.clear();
+
+        return *this;
+    }
+};
+
+/// \brief A capacity-bounded, null-terminated string of characters.
+using string = std::basic_string<char>;
+
+}
+
+#endif
@@ -0,0 +1,333 @@
+/// \file std/container/string/string_view.hpp
+/// \brief Defines the std::basic_string_view template class.
+#ifndef STD___CONTAINER___STRING___STRING_VIEW_H
+#define STD___CONTAINER___STRING___STRING_VIEW_H
+
+// std
+#include <std/container/dynamic/vector.hpp>
+#include <std/container/fixed/array.hpp>
+#include <std/container/iterator.hpp>
+#include <std/stddef.hpp>
+
+namespace std {
+
+/// \brief A non-owning, read-only view of a sequence of characters.
+/// \tparam char_type The character type of the view.
+template <typename char_type>
+class basic_string_view
+{
+public:
+    // CONSTANTS
+    /// \brief Indicates the end of the view, or that a search found no match.
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty string view instance.
+    constexpr basic_string_view()
+        : m_begin(nullptr),
+          m_size(0)
+    {}
+    /// \brief Constructs a new string view instance over a character sequence.
+    /// \param[in] data The beginning of the character sequence.
+    /// \param[in] size The number of characters in the sequence.
+    constexpr basic_string_view(const char_type* data, std::size_t size)
+        : m_begin(data),
+          m_size(size)
+    {}
+    /// \brief Constructs a new string view instance over a null-terminated character sequence.
+    /// \param[in] data The null-terminated character sequence.
+    basic_string_view(const char_type* data)
+        : m_begin(data),
+          m_size(0)
+    {
+        // Find the null terminator.
+        while(data[basic_string_view::m_size] != char_type(0))
+        {
+            ++basic_string_view::m_size;
+        }
+    }
+    /// \brief Constructs a new string view instance over the characters of an array.
+    /// \tparam size_value The size of the array.
+    /// \param[in] array The array to view. All characters of the array are viewed.
+    template <std::size_t size_value>
+    constexpr basic_string_view(const std::array<char_type,size_value>& array)
+        : m_begin(array.data()),
+          m_size(size_value)
+    {}
+    /// \brief Constructs a new string view instance over the characters of a vector.
+    /// \param[in] vector The vector to view.
+    /// \note The view is invalidated if the vector's size is reduced.
+    basic_string_view(const std::vector<char_type>& vector)
+        : m_begin(vector.data()),
+          m_size(vector.size())
+    {}
+
+    // ACCESS
+    /// \brief Gets a const_iterator to the beginning of the view.
+    /// \return The begin const_iterator.
+    constexpr std::const_iterator<char_type> begin() const
+    {
+        return basic_string_view::m_begin;
+    }
+    /// \brief Gets a const_iterator to the end of the view.
+    /// \return The end const_iterator.
+    constexpr std::const_iterator<char_type> end() const
+    {
+        return basic_string_view::m_begin + basic_string_view::m_size;
+    }
+    /// \brief Gets a const_iterator to the beginning of the view.
+    /// \return The begin const_iterator.
+    constexpr std::const_iterator<char_type> cbegin() const
+    {
+        return basic_string_view::m_begin;
+    }
+    /// \brief Gets a const_iterator to the end of the view.
+    /// \return The end const_iterator.
+    constexpr std::const_iterator<char_type> cend() const
+    {
+        return basic_string_view::m_begin + basic_string_view::m_size;
+    }
+    /// \brief Gets the character at a specified index.
+    /// \param[in] index The index of the character to get.
+    /// \return A const reference to the character.
+    constexpr const char_type& operator[](std::size_t index) const
+    {
+        return basic_string_view::m_begin[index];
+    }
+    /// \brief Gets the character at a specified index.
+    /// \param[in] index The index of the character to get.
+    /// \return A const reference to the character.
+    constexpr const char_type& at(std::size_t index) const
+    {
+        return basic_string_view::m_begin[index];
+    }
+    /// \brief Gets the first character in the view.
+    /// \return A const reference to the first character.
+    constexpr const char_type& front() const
+    {
+        return basic_string_view::m_begin[0];
+    }
+    /// \brief Gets the last character in the view.
+    /// \return A const reference to the last character.
+    constexpr const char_type& back() const
+    {
+        return basic_string_view::m_begin[basic_string_view::m_size - 1];
+    }
+    /// \brief Gets a pointer to the view's character sequence.
+    /// \return A pointer to the character sequence.
+    /// \note The sequence is not necessarily null-terminated.
+    constexpr const char_type* data() const
+    {
+        return basic_string_view::m_begin;
+    }
+
+    // CAPACITY
+    /// \brief Gets the number of characters in the view.
+    /// \return The number of characters in the view.
+    constexpr std::size_t size() const
+    {
+        return basic_string_view::m_size;
+    }
+    /// \brief Gets the number of characters in the view.
+    /// \return The number of characters in the view.
+    constexpr std::size_t length() const
+    {
+        return basic_string_view::m_size;
+    }
+    /// \brief Checks if the view is empty.
+    /// \return TRUE if the view is empty, otherwise FALSE.
+    constexpr bool empty() const
+    {
+        return basic_string_view::m_size == 0;
+    }
+
+    // MODIFIERS
+    /// \brief Shrinks the view by moving its start forward.
+    /// \param[in] count The number of characters to remove from the start of the view.
+    void remove_prefix(std::size_t count)
+    {
+        basic_string_view::m_begin += count;
+        basic_string_view::m_size -= count;
+    }
+    /// \brief Shrinks the view by moving its end backward.
+    /// \param[in] count The number of characters to remove from the end of the view.
+    void remove_suffix(std::size_t count)
+    {
+        basic_string_view::m_size -= count;
+    }
+
+    // OPERATIONS
+    /// \brief Gets a view of the first characters of this view.
+    /// \param[in] count The maximum number of characters to view.
+    /// \return A view of the first characters. The count is clamped to the size of this view.
+    std::basic_string_view<char_type> first(std::size_t count) const
+    {
+        return basic_string_view::substr(0, count);
+    }
+    /// \brief Gets a view of the last characters of this view.
+    /// \param[in] count The maximum number of characters to view.
+    /// \return A view of the last characters. The count is clamped to the size of this view.
+    std::basic_string_view<char_type> last(std::size_t count) const
+    {
+        return count < basic_string_view::m_size ? basic_string_view::substr(basic_string_view::m_size - count) : *this;
+    }
+    /// \brief Gets a view of a substring of this view.
+    /// \param[in] position The index of the first character of the substring.
+    /// \param[in] count The maximum number of characters in the substring.
+    /// \return A view of the substring. The substring is clamped to the end of this view.
+    std::basic_string_view<char_type> substr(std::size_t position = 0, std::size_t count = npos) const
+    {
+        // Clamp position and count to the view.
+        if(position > basic_string_view::m_size)
+        {
+            position = basic_string_view::m_size;
+        }
+        if(count > basic_string_view::m_size - position)
+        {
+            count = basic_string_view::m_size - position;
+        }
+
+        return std::basic_string_view<char_type>(basic_string_view::m_begin + position, count);
+    }
+    /// \brief Lexicographically compares this view with another view.
+    /// \param[in] other The other view to compare with.
+    /// \return A negative value if this view is less than the other, zero if equal, or a positive value if greater.
+    int compare(const std::basic_string_view<char_type>& other) const
+    {
+        // Compare the common prefix.
+        std::size_t count = basic_string_view::m_size < other.m_size ? basic_string_view::m_size : other.m_size;
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            if(basic_string_view::m_begin[i] != other.m_begin[i])
+            {
+                return basic_string_view::m_begin[i] < other.m_begin[i] ? -1 : 1;
+            }
+        }
+
+        // Compare lengths.
+        if(basic_string_view::m_size == other.m_size)
+        {
+            return 0;
+        }
+        return basic_string_view::m_size < other.m_size ? -1 : 1;
+    }
+    /// \brief Checks if this view begins with another view.
+    /// \param[in] prefix The prefix to check for.
+    /// \return TRUE if this view begins with the prefix, otherwise FALSE.
+    bool starts_with(const std::basic_string_view<char_type>& prefix) const
+    {
+        return basic_string_view::m_size >= prefix.m_size && basic_string_view::substr(0, prefix.m_size) == prefix;
+    }
+    /// \brief Checks if this view ends with another view.
+    /// \param[in] suffix The suffix to check for.
+    /// \return TRUE if this view ends with the suffix, otherwise FALSE.
+    bool ends_with(const std::basic_string_view<char_type>& suffix) const
+    {
+        return basic_string_view::m_size >= suffix.m_size && basic_string_view::substr(basic_string_view::m_size - suffix.m_size) == suffix;
+    }
+
+    // LOOKUP
+    /// \brief Finds the first occurrence of a character.
+    /// \param[in] character The character to find.
+    /// \param[in] position The index to start searching from.
+    /// \return The index of the found character, or npos if not found.
+    std::size_t find(char_type character, std::size_t position = 0) const
+    {
+        for(; position < basic_string_view::m_size; ++position)
+        {
+            if(basic_string_view::m_begin[position] == character)
+            {
+                return position;
+            }
+        }
+
+        return npos;
+    }
+    /// \brief Finds the first occurrence of a substring.
+    /// \param[in] substring The substring to find.
+    /// \param[in] position The index to start searching from.
+    /// \return The index of the beginning of the found substring, or npos if not found.
+    std::size_t find(const std::basic_string_view<char_type>& substring, std::size_t position = 0) const
+    {
+        // Verify the substring can fit.
+        if(substring.m_size > basic_string_view::m_size)
+        {
+            return npos;
+        }
+
+        // Compare the substring at each candidate position.
+        for(std::size_t last = basic_string_view::m_size - substring.m_size; position <= last; ++position)
+        {
+            if(basic_string_view::substr(position, substring.m_size) == substring)
+            {
+                return position;
+            }
+        }
+
+        return npos;
+    }
+    /// \brief Finds the last occurrence of a character.
+    /// \param[in] character The character to find.
+    /// \return The index of the found character, or npos if not found.
+    std::size_t rfind(char_type character) const
+    {
+        for(std::size_t position = basic_string_view::m_size; position-- > 0;)
+        {
+            if(basic_string_view::m_begin[position] == character)
+            {
+                return position;
+            }
+        }
+
+        return npos;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this view is equal to another view.
+    /// \param[in] other The other view to compare with.
+    /// \return TRUE if the two views contain the same characters, otherwise FALSE.
+    bool operator==(const std::basic_string_view<char_type>& other) const
+    {
+        // Verify sizes match.
+        if(basic_string_view::m_size != other.m_size)
+        {
+            return false;
+        }
+
+        // Compare characters.
+        for(std::size_t i = 0; i < basic_string_view::m_size; ++i)
+        {
+            if(basic_string_view::m_begin[i] != other.m_begin[i])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+    /// \brief Checks if this view is unequal with another view.
+    /// \param[in] other The other view to compare with.
+    /// \return TRUE if the two views contain different characters, otherwise FALSE.
+    bool operator!=(const std::basic_string_view<char_type>& other) const
+    {
+        return !basic_string_view::operator==(other);
+    }
+
+private:
+    // DATA
+    /// \brief The beginning of the viewed character sequence.
+    const char_type* m_begin;
+    /// \brief The number of characters in the view.
+    std::size_t m_size;
+};
+
+/// \brief Indicates the end of the view, or that a search found no match.
+template <typename char_type>
+constexpr std::size_t basic_string_view<char_type>::npos;
+
+/// \brief A non-owning, read-only view of a sequence of chars.
+using string_view = std::basic_string_view<char>;
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+/// \file std/functional/comparison.hpp
+/// \brief Defines the std::less, std::greater, and std::equal_to template classes.
+#ifndef STD___FUNCTIONAL___COMPARISON_H
+#define STD___FUNCTIONAL___COMPARISON_H
+
+namespace std {
+
+/// \brief A function object that compares two objects with operator<.
+/// \tparam object_type The type of the objects to compare, or void to compare objects of any types.
+template <typename object_type = void>
+struct less
+{
+    /// \brief Checks if one object is less than another.
+    /// \param[in] a The first object to compare.
+    /// \param[in] b The second object to compare.
+    /// \return TRUE if a is less than b, otherwise FALSE.
+    constexpr bool operator()(const object_type& a, const object_type& b) const
+    {
+        return a < b;
+    }
+};
+
+/// \brief A function object that compares two objects of any types with operator<.
+/// \details Neither object is converted before comparing, so a value of one type (e.g. an int literal) can be searched
+/// for within a range of another type (e.g. uint16_t) under the usual arithmetic conversions.
+template <>
+struct less<void>
+{
+    /// \brief Checks if one object is less than another.
+    /// \tparam a_type The type of the first object.
+    /// \tparam b_type The type of the second object.
+    /// \param[in] a The first object to compare.
+    /// \param[in] b The second object to compare.
+    /// \return TRUE if a is less than b, otherwise FALSE.
+    template <typename a_type, typename b_type>
+    constexpr bool operator()(const a_type& a, const b_type& b) const
+    {
+        return a < b;
+    }
+};
+
+/// \brief A function object that compares two objects with operator>.
+/// \tparam object_type The type of the objects to compare.
+template <typename object_type>
+struct greater
+{
+    /// \brief Checks if one object is greater than another.
+    /// \param[in] a The first object to compare.
+    /// \param[in] b The second object to compare.
+    /// \return TRUE if a is greater than b, otherwise FALSE.
+    constexpr bool operator()(const object_type& a, const object_type& b) const
+    {
+        return a > b;
+    }
+};
+
+/// \brief A function object that compares two objects with operator==.
+/// \tparam object_type The type of the objects to compare.
+template <typename object_type>
+struct equal_to
+{
+    /// \brief Checks if one object is equal to another.
+    /// \param[in] a The first object to compare.
+    /// \param[in] b The second object to compare.
+    /// \return TRUE if a is equal to b, otherwise FALSE.
+    constexpr bool operator()(const object_type& a, const object_type& b) const
+    {
+        return a == b;
+    }
+};
+
+}
+
+#endif
\ No newline at end of file
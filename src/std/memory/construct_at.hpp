@@ -0,0 +1,59 @@
+/// \file std/memory/construct_at.hpp
+/// \brief Defines the std::construct_at and std::destroy_at template functions.
+#ifndef STD___MEMORY___CONSTRUCT_AT_H
+#define STD___MEMORY___CONSTRUCT_AT_H
+
+// std
+#include <std/stddef.hpp>
+#include <std/utility/forward.hpp>
+
+namespace std {
+
+namespace memory {
+
+/// \brief A tag that selects the library's own placement new.
+/// \details Not every Arduino core declares the standard placement new, and declaring it here would conflict with the
+/// cores that do. A placement new overloaded on this tag is always available and never conflicts.
+struct placement
+{};
+
+}
+
+}
+
+/// \brief Constructs an object at an address without allocating.
+/// \param[in] address The address to construct the object at.
+/// \return The address.
+inline void* operator new(std::size_t, std::memory::placement, void* address) noexcept
+{
+    return address;
+}
+/// \brief Matches the library's placement new, called if a constructor throws.
+inline void operator delete(void*, std::memory::placement, void*) noexcept
+{}
+
+namespace std {
+
+/// \brief Constructs an object in existing storage.
+/// \tparam object_type The type of the object to construct.
+/// \tparam argument_types The types of the constructor arguments.
+/// \param[in] address The address of uninitialized storage for the object.
+/// \param[in] arguments The arguments to forward to the object's constructor.
+/// \return A pointer to the constructed object.
+template <typename object_type, typename... argument_types>
+object_type* construct_at(object_type* address, argument_types&&... arguments)
+{
+    return ::new(std::memory::placement(), static_cast<void*>(address)) object_type(std::forward<argument_types>(arguments)...);
+}
+/// \brief Destroys an object without deallocating its storage.
+/// \tparam object_type The type of the object to destroy.
+/// \param[in] address The address of the object.
+template <typename object_type>
+void destroy_at(object_type* address)
+{
+    address->~object_type();
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,227 @@
+/// \file std/numeric/accumulate.hpp
+/// \brief Defines the std::accumulate and std::inner_product template functions.
+#ifndef STD___NUMERIC___ACCUMULATE_H
+#define STD___NUMERIC___ACCUMULATE_H
+
+// std
+#include <std/container/fixed/array.hpp>
+#include <std/numeric/widen.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/move.hpp>
+
+namespace std {
+
+namespace numeric {
+
+/// \brief The number of elements processed per loop iteration by the std::array numeric kernels.
+constexpr std::size_t unroll_factor = 4;
+
+/// \brief Unrolls numeric kernels over a compile-time number of elements.
+/// \tparam count_value The number of elements to unroll over.
+/// \details Each kernel recurses into the next element at compile time, which the compiler flattens into straight
+/// line code without a loop counter or branch.
+template <std::size_t count_value>
+struct unroll
+{
+    /// \brief Adds elements to a sum.
+    /// \tparam object_type The type of the elements.
+    /// \tparam sum_type The type of the sum.
+    /// \param[in] data The elements to add.
+    /// \param[in] sum The sum to add to.
+    /// \return The resulting sum.
+    template <typename object_type, typename sum_type>
+    static sum_type accumulate(const object_type* data, sum_type sum)
+    {
+        return std::numeric::unroll<count_value - 1>::accumulate(data + 1, std::move(sum) + *data);
+    }
+    /// \brief Adds products of element pairs to a sum.
+    /// \tparam object_type_a The type of the first elements.
+    /// \tparam object_type_b The type of the second elements.
+    /// \tparam sum_type The type of the sum.
+    /// \param[in] data_a The first elements.
+    /// \param[in] data_b The second elements.
+    /// \param[in] sum The sum to add to.
+    /// \return The resulting sum.
+    /// \note Elements are converted to the sum type before multiplying, so products do not overflow the element type.
+    template <typename object_type_a, typename object_type_b, typename sum_type>
+    static sum_type inner_product(const object_type_a* data_a, const object_type_b* data_b, sum_type sum)
+    {
+        return std::numeric::unroll<count_value - 1>::inner_product(data_a + 1, data_b + 1, std::move(sum) + sum_type(*data_a) * sum_type(*data_b));
+    }
+};
+/// \brief Terminates numeric kernel unrolling.
+template <>
+struct unroll<0>
+{
+    /// \brief Adds no elements to a sum.
+    /// \tparam object_type The type of the elements.
+    /// \tparam sum_type The type of the sum.
+    /// \param[in] sum The sum to add to.
+    /// \return The unchanged sum.
+    template <typename object_type, typename sum_type>
+    static sum_type accumulate(const object_type*, sum_type sum)
+    {
+        return sum;
+    }
+    /// \brief Adds no products to a sum.
+    /// \tparam object_type_a The type of the first elements.
+    /// \tparam object_type_b The type of the second elements.
+    /// \tparam sum_type The type of the sum.
+    /// \param[in] sum The sum to add to.
+    /// \return The unchanged sum.
+    template <typename object_type_a, typename object_type_b, typename sum_type>
+    static sum_type inner_product(const object_type_a*, const object_type_b*, sum_type sum)
+    {
+        return sum;
+    }
+};
+
+}
+
+/// \brief Sums a range of elements.
+/// \tparam iterator_type The input iterator type of the range.
+/// \tparam sum_type The type of the sum.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] init The initial value of the sum. Its type determines the type of the sum.
+/// \return The sum of init and all elements.
+template <typename iterator_type, typename sum_type>
+sum_type accumulate(iterator_type first, iterator_type last, sum_type init)
+{
+    for(; first != last; ++first)
+    {
+        init = std::move(init) + *first;
+    }
+
+    return init;
+}
+/// \brief Folds a range of elements with a binary operation.
+/// \tparam iterator_type The input iterator type of the range.
+/// \tparam sum_type The type of the result.
+/// \tparam operation_type The type of the binary operation.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] init The initial value of the result.
+/// \param[in] operation The binary operation, called as operation(result, element).
+/// \return The folded result.
+template <typename iterator_type, typename sum_type, typename operation_type>
+sum_type accumulate(iterator_type first, iterator_type last, sum_type init, operation_type operation)
+{
+    for(; first != last; ++first)
+    {
+        init = operation(std::move(init), *first);
+    }
+
+    return init;
+}
+/// \brief Sums the elements of an array.
+/// \tparam object_type The type of the elements.
+/// \tparam size_value The size of the array.
+/// \tparam sum_type The type of the sum.
+/// \param[in] array The array to sum.
+/// \param[in] init The initial value of the sum. Its type determines the type of the sum.
+/// \return The sum of init and all elements.
+/// \details The loop is unrolled by std::numeric::unroll_factor using the array's compile-time size, with the
+/// remaining elements summed by straight line code.
+template <typename object_type, std::size_t size_value, typename sum_type>
+sum_type accumulate(const std::array<object_type,size_value>& array, sum_type init)
+{
+    const object_type* data = array.data();
+    for(std::size_t i = 0; i < size_value / std::numeric::unroll_factor; ++i, data += std::numeric::unroll_factor)
+    {
+        init = std::numeric::unroll<std::numeric::unroll_factor>::accumulate(data, std::move(init));
+    }
+
+    return std::numeric::unroll<size_value % std::numeric::unroll_factor>::accumulate(data, std::move(init));
+}
+/// \brief Sums the elements of an array into a widened accumulator.
+/// \tparam object_type The type of the elements.
+/// \tparam size_value The size of the array.
+/// \param[in] array The array to sum.
+/// \return The sum of all elements, as the std::numeric::widen type of the elements (e.g. int32_t for int16_t).
+template <typename object_type, std::size_t size_value>
+typename std::numeric::widen<object_type>::type accumulate(const std::array<object_type,size_value>& array)
+{
+    return std::accumulate(array, typename std::numeric::widen<object_type>::type(0));
+}
+/// \brief Sums the products of two ranges of elements.
+/// \tparam iterator_type_a The input iterator type of the first range.
+/// \tparam iterator_type_b The input iterator type of the second range.
+/// \tparam sum_type The type of the sum.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \param[in] init The initial value of the sum. Its type determines the type of the sum.
+/// \return The sum of init and the products of all element pairs.
+template <typename iterator_type_a, typename iterator_type_b, typename sum_type>
+sum_type inner_product(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b, sum_type init)
+{
+    for(; first_a != last_a; ++first_a, ++first_b)
+    {
+        init = std::move(init) + *first_a * *first_b;
+    }
+
+    return init;
+}
+/// \brief Folds the combinations of two ranges of elements with binary operations.
+/// \tparam iterator_type_a The input iterator type of the first range.
+/// \tparam iterator_type_b The input iterator type of the second range.
+/// \tparam sum_type The type of the result.
+/// \tparam sum_operation_type The type of the binary operation that folds combinations into the result.
+/// \tparam product_operation_type The type of the binary operation that combines element pairs.
+/// \param[in] first_a The beginning of the first range.
+/// \param[in] last_a The end of the first range.
+/// \param[in] first_b The beginning of the second range, which must be at least as long as the first range.
+/// \param[in] init The initial value of the result.
+/// \param[in] sum_operation The binary operation, called as sum_operation(result, combination).
+/// \param[in] product_operation The binary operation, called as product_operation(element_a, element_b).
+/// \return The folded result.
+template <typename iterator_type_a, typename iterator_type_b, typename sum_type, typename sum_operation_type, typename product_operation_type>
+sum_type inner_product(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b, sum_type init, sum_operation_type sum_operation, product_operation_type product_operation)
+{
+    for(; first_a != last_a; ++first_a, ++first_b)
+    {
+        init = sum_operation(std::move(init), product_operation(*first_a, *first_b));
+    }
+
+    return init;
+}
+/// \brief Sums the products of the elements of two arrays.
+/// \tparam object_type_a The type of the elements of the first array.
+/// \tparam object_type_b The type of the elements of the second array.
+/// \tparam size_value The size of the arrays.
+/// \tparam sum_type The type of the sum.
+/// \param[in] array_a The first array.
+/// \param[in] array_b The second array.
+/// \param[in] init The initial value of the sum. Its type determines the type of the sum.
+/// \return The sum of init and the products of all element pairs.
+/// \details The loop is unrolled by std::numeric::unroll_factor using the arrays' compile-time size. Elements are
+/// converted to the sum type before multiplying.
+template <typename object_type_a, typename object_type_b, std::size_t size_value, typename sum_type>
+sum_type inner_product(const std::array<object_type_a,size_value>& array_a, const std::array<object_type_b,size_value>& array_b, sum_type init)
+{
+    const object_type_a* data_a = array_a.data();
+    const object_type_b* data_b = array_b.data();
+    for(std::size_t i = 0; i < size_value / std::numeric::unroll_factor; ++i, data_a += std::numeric::unroll_factor, data_b += std::numeric::unroll_factor)
+    {
+        init = std::numeric::unroll<std::numeric::unroll_factor>::inner_product(data_a, data_b, std::move(init));
+    }
+
+    return std::numeric::unroll<size_value % std::numeric::unroll_factor>::inner_product(data_a, data_b, std::move(init));
+}
+/// \brief Sums the products of the elements of two arrays into a widened accumulator.
+/// \tparam object_type The type of the elements.
+/// \tparam size_value The size of the arrays.
+/// \param[in] array_a The first array.
+/// \param[in] array_b The second array.
+/// \return The sum of the products of all element pairs, as the std::numeric::widen type of the elements.
+/// \note The widened type holds any single product, but a sum of many large products may still overflow it.
+template <typename object_type, std::size_t size_value>
+typename std::numeric::widen<object_type>::type inner_product(const std::array<object_type,size_value>& array_a, const std::array<object_type,size_value>& array_b)
+{
+    return std::inner_product(array_a, array_b, typename std::numeric::widen<object_type>::type(0));
+}
+
+}
+
+#endif
\ No newline at end of file
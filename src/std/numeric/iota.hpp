@@ -0,0 +1,25 @@
+/// \file std/numeric/iota.hpp
+/// \brief Defines the std::iota template function.
+#ifndef STD___NUMERIC___IOTA_H
+#define STD___NUMERIC___IOTA_H
+
+namespace std {
+
+/// \brief Fills a range with sequentially increasing values.
+/// \tparam iterator_type The forward iterator type of the range.
+/// \tparam object_type The type of the values.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] value The value of the first element, which is incremented for each subsequent element.
+template <typename iterator_type, typename object_type>
+void iota(iterator_type first, iterator_type last, object_type value)
+{
+    for(; first != last; ++first, ++value)
+    {
+        *first = value;
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,127 @@
+/// \file std/numeric/partial_sum.hpp
+/// \brief Defines the std::partial_sum and std::adjacent_difference template functions.
+#ifndef STD___NUMERIC___PARTIAL_SUM_H
+#define STD___NUMERIC___PARTIAL_SUM_H
+
+// std
+#include <std/utility/move.hpp>
+
+namespace std {
+
+/// \brief Writes the running sums of a range of elements to an output range.
+/// \tparam iterator_type The input iterator type of the range.
+/// \tparam output_iterator_type The output iterator type of the output range.
+/// \tparam operation_type The type of the binary operation.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] output The beginning of the output range, which may be first to compute the sums in place.
+/// \param[in] operation The binary operation, called as operation(sum, element).
+/// \return An iterator to the end of the output range.
+/// \details The running sum is kept in a local of the element type, so each element is read once.
+template <typename iterator_type, typename output_iterator_type, typename operation_type>
+output_iterator_type partial_sum(iterator_type first, iterator_type last, output_iterator_type output, operation_type operation)
+{
+    if(first == last)
+    {
+        return output;
+    }
+
+    // Write the first element, and each subsequent running sum.
+    auto sum = *first;
+    *output = sum;
+    while(++first != last)
+    {
+        sum = operation(std::move(sum), *first);
+        *++output = sum;
+    }
+
+    return ++output;
+}
+/// \brief Writes the running sums of a range of elements to an output range using operator+.
+/// \tparam iterator_type The input iterator type of the range.
+/// \tparam output_iterator_type The output iterator type of the output range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] output The beginning of the output range, which may be first to compute the sums in place.
+/// \return An iterator to the end of the output range.
+template <typename iterator_type, typename output_iterator_type>
+output_iterator_type partial_sum(iterator_type first, iterator_type last, output_iterator_type output)
+{
+    if(first == last)
+    {
+        return output;
+    }
+
+    // Write the first element, and each subsequent running sum.
+    auto sum = *first;
+    *output = sum;
+    while(++first != last)
+    {
+        sum = std::move(sum) + *first;
+        *++output = sum;
+    }
+
+    return ++output;
+}
+/// \brief Writes the differences between adjacent elements of a range to an output range.
+/// \tparam iterator_type The input iterator type of the range.
+/// \tparam output_iterator_type The output iterator type of the output range.
+/// \tparam operation_type The type of the binary operation.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] output The beginning of the output range, which may be first to compute the differences in place.
+/// \param[in] operation The binary operation, called as operation(element, previous element).
+/// \return An iterator to the end of the output range.
+/// \details The first element is copied unchanged. The previous element is kept in a local, so each element is read
+/// once and the range can be differenced in place.
+template <typename iterator_type, typename output_iterator_type, typename operation_type>
+output_iterator_type adjacent_difference(iterator_type first, iterator_type last, output_iterator_type output, operation_type operation)
+{
+    if(first == last)
+    {
+        return output;
+    }
+
+    // Write the first element, and each subsequent difference.
+    auto previous = *first;
+    *output = previous;
+    while(++first != last)
+    {
+        auto current = *first;
+        *++output = operation(current, std::move(previous));
+        previous = std::move(current);
+    }
+
+    return ++output;
+}
+/// \brief Writes the differences between adjacent elements of a range to an output range using operator-.
+/// \tparam iterator_type The input iterator type of the range.
+/// \tparam output_iterator_type The output iterator type of the output range.
+/// \param[in] first The beginning of the range.
+/// \param[in] last The end of the range.
+/// \param[in] output The beginning of the output range, which may be first to compute the differences in place.
+/// \return An iterator to the end of the output range.
+template <typename iterator_type, typename output_iterator_type>
+output_iterator_type adjacent_difference(iterator_type first, iterator_type last, output_iterator_type output)
+{
+    if(first == last)
+    {
+        return output;
+    }
+
+    // Write the first element, and each subsequent difference.
+    auto previous = *first;
+    *output = previous;
+    while(++first != last)
+    {
+        auto current = *first;
+        *++output = current - previous;
+        previous = std::move(current);
+    }
+
+    return ++output;
+}
+
+}
+
+#endif
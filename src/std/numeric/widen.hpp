@@ -0,0 +1,122 @@
+/// \file std/numeric/widen.hpp
+/// \brief Defines the std::numeric::widen template struct.
+#ifndef STD___NUMERIC___WIDEN_H
+#define STD___NUMERIC___WIDEN_H
+
+// std
+#include <std/stddef.hpp>
+
+// arduino
+#include <Arduino.h>
+
+namespace std {
+
+/// \brief Contains all code for std numeric components.
+namespace numeric {
+
+/// \brief Selects an integer type twice the size of an integer type.
+/// \tparam size_value The size of the integer type to widen, in bytes.
+/// \tparam signed_value TRUE if the integer type is signed, otherwise FALSE.
+/// \details 64-bit integers are not widened further.
+template <std::size_t size_value, bool signed_value>
+struct widen_integer
+{
+    /// \brief The widened integer type.
+    using type = int64_t;
+};
+/// \brief Selects an unsigned integer type twice the size of an unsigned integer type.
+/// \tparam size_value The size of the integer type to widen, in bytes.
+template <std::size_t size_value>
+struct widen_integer<size_value,false>
+{
+    /// \brief The widened integer type.
+    using type = uint64_t;
+};
+/// \brief Selects a signed integer type twice the size of a one-byte signed integer type.
+template <>
+struct widen_integer<1,true>
+{
+    /// \brief The widened integer type.
+    using type = int16_t;
+};
+/// \brief Selects an unsigned integer type twice the size of a one-byte unsigned integer type.
+template <>
+struct widen_integer<1,false>
+{
+    /// \brief The widened integer type.
+    using type = uint16_t;
+};
+/// \brief Selects a signed integer type twice the size of a two-byte signed integer type.
+template <>
+struct widen_integer<2,true>
+{
+    /// \brief The widened integer type.
+    using type = int32_t;
+};
+/// \brief Selects an unsigned integer type twice the size of a two-byte unsigned integer type.
+template <>
+struct widen_integer<2,false>
+{
+    /// \brief The widened integer type.
+    using type = uint32_t;
+};
+
+/// \brief Selects a type wide enough to accumulate sums and products of a type without overflow.
+/// \tparam object_type The type to widen.
+/// \details Integer types are widened to an integer type twice their size (e.g. int16_t accumulates into int32_t),
+/// while other types (e.g. float) accumulate into themselves.
+template <typename object_type>
+struct widen
+{
+    /// \brief The widened type.
+    using type = object_type;
+};
+/// \brief Selects a type wide enough to accumulate sums and products of a char.
+template <>
+struct widen<char>
+    : std::numeric::widen_integer<sizeof(char), (char(-1) < char(0))>
+{};
+/// \brief Selects a type wide enough to accumulate sums and products of a signed char.
+template <>
+struct widen<signed char>
+    : std::numeric::widen_integer<sizeof(signed char), true>
+{};
+/// \brief Selects a type wide enough to accumulate sums and products of an unsigned char.
+template <>
+struct widen<unsigned char>
+    : std::numeric::widen_integer<sizeof(unsigned char), false>
+{};
+/// \brief Selects a type wide enough to accumulate sums and products of a short.
+template <>
+struct widen<short>
+    : std::numeric::widen_integer<sizeof(short), true>
+{};
+/// \brief Selects a type wide enough to accumulate sums and products of an unsigned short.
+template <>
+struct widen<unsigned short>
+    : std::numeric::widen_integer<sizeof(unsigned short), false>
+{};
+/// \brief Selects a type wide enough to accumulate sums and products of an int.
+template <>
+struct widen<int>
+    : std::numeric::widen_integer<sizeof(int), true>
+{};
+/// \brief Selects a type wide enough to accumulate sums and products of an unsigned int.
+template <>
+struct widen<unsigned int>
+    : std::numeric::widen_integer<sizeof(unsigned int), false>
+{};
+/// \brief Selects a type wide enough to accumulate sums and products of a long.
+template <>
+struct widen<long>
+    : std::numeric::widen_integer<sizeof(long), true>
+{};
+/// \brief Selects a type wide enough to accumulate sums and products of an unsigned long.
+template <>
+struct widen<unsigned long>
+    : std::numeric::widen_integer<sizeof(unsigned long), false>
+{};
+
+}}
+
+#endif
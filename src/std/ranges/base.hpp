@@ -0,0 +1,175 @@
+/// \file std/ranges/base.hpp
+/// \brief Defines the std::ranges::range, std::ranges::subrange, and std::ranges::next components shared by all views.
+#ifndef STD___RANGES___BASE_H
+#define STD___RANGES___BASE_H
+
+// std
+#include <std/container/iterator.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/declval.hpp>
+#include <std/utility/remove_reference.hpp>
+
+namespace std {
+
+/// \brief Contains all code for std range and view components.
+namespace ranges {
+
+/// \brief Gets the iterator type of a range and its begin/end iterators.
+/// \tparam range_type The type of the range, which must provide begin() and end() members. A const range uses its
+/// const iterators.
+template <typename range_type>
+struct range
+{
+    /// \brief The iterator type of the range.
+    using iterator = decltype(std::declval<range_type&>().begin());
+
+    /// \brief Gets an iterator to the beginning of a range.
+    /// \param[in] range The range.
+    /// \return An iterator to the beginning of the range.
+    static iterator begin(range_type& range)
+    {
+        return range.begin();
+    }
+    /// \brief Gets an iterator to the end of a range.
+    /// \param[in] range The range.
+    /// \return An iterator to the end of the range.
+    static iterator end(range_type& range)
+    {
+        return range.end();
+    }
+};
+/// \brief Gets the iterator type of a C array and its begin/end iterators.
+/// \tparam object_type The object type of the array.
+/// \tparam size_value The size of the array.
+template <typename object_type, std::size_t size_value>
+struct range<object_type[size_value]>
+{
+    /// \brief The iterator type of the array.
+    using iterator = object_type*;
+
+    /// \brief Gets an iterator to the beginning of an array.
+    /// \param[in] range The array.
+    /// \return An iterator to the beginning of the array.
+    static iterator begin(object_type (&range)[size_value])
+    {
+        return range;
+    }
+    /// \brief Gets an iterator to the end of an array.
+    /// \param[in] range The array.
+    /// \return An iterator to the end of the array.
+    static iterator end(object_type (&range)[size_value])
+    {
+        return range + size_value;
+    }
+};
+
+/// \brief Gets the category of an iterator adaptor that supports at most bidirectional traversal.
+/// \tparam category_type The category tag of the underlying iterator.
+template <typename category_type>
+struct bidirectional_category
+{
+    /// \brief The category tag of the adaptor.
+    using type = category_type;
+};
+/// \brief Gets the category of an iterator adaptor over a random access iterator, which is bidirectional.
+template <>
+struct bidirectional_category<std::random_access_iterator_tag>
+{
+    /// \brief The category tag of the adaptor.
+    using type = std::bidirectional_iterator_tag;
+};
+
+/// \brief Advances an iterator by a number of elements without passing a bound, by incrementing.
+/// \tparam iterator_type The input iterator type.
+/// \param[in] first The iterator to advance.
+/// \param[in] count The number of elements to advance by.
+/// \param[in] last The bound to stop at.
+/// \return The advanced iterator, or last if fewer than count elements remain.
+template <typename iterator_type>
+iterator_type next(iterator_type first, std::size_t count, iterator_type last, std::input_iterator_tag)
+{
+    for(; count > 0 && first != last; --count)
+    {
+        ++first;
+    }
+
+    return first;
+}
+/// \brief Advances a random access iterator by a number of elements without passing a bound, in constant time.
+/// \tparam iterator_type The random access iterator type.
+/// \param[in] first The iterator to advance.
+/// \param[in] count The number of elements to advance by.
+/// \param[in] last The bound to stop at.
+/// \return The advanced iterator, or last if fewer than count elements remain.
+template <typename iterator_type>
+iterator_type next(iterator_type first, std::size_t count, iterator_type last, std::random_access_iterator_tag)
+{
+    return (static_cast<std::size_t>(last - first) < count) ? last : first + count;
+}
+/// \brief Advances an iterator by a number of elements without passing a bound.
+/// \tparam iterator_type The input iterator type.
+/// \param[in] first The iterator to advance.
+/// \param[in] count The number of elements to advance by.
+/// \param[in] last The bound to stop at.
+/// \return The advanced iterator, or last if fewer than count elements remain.
+/// \details Runs in O(1) for random access iterators, and otherwise in O(count).
+template <typename iterator_type>
+iterator_type next(iterator_type first, std::size_t count, iterator_type last)
+{
+    return std::ranges::next(first, count, last, typename std::iterator_traits<iterator_type>::iterator_category());
+}
+
+/// \brief A view of a range between two iterators.
+/// \tparam iterator_type The iterator type of the range.
+template <typename iterator_type>
+class subrange
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new subrange instance.
+    /// \param[in] first The beginning of the range.
+    /// \param[in] last The end of the range.
+    subrange(iterator_type first, iterator_type last)
+        : m_first(first),
+          m_last(last)
+    {}
+
+    // ITERATORS
+    /// \brief Gets an iterator to the beginning of the view.
+    /// \return An iterator to the beginning of the view.
+    iterator_type begin() const
+    {
+        return subrange::m_first;
+    }
+    /// \brief Gets an iterator to the end of the view.
+    /// \return An iterator to the end of the view.
+    iterator_type end() const
+    {
+        return subrange::m_last;
+    }
+
+    // CAPACITY
+    /// \brief Checks if the view is empty.
+    /// \return TRUE if the view is empty, otherwise FALSE.
+    bool empty() const
+    {
+        return subrange::m_first == subrange::m_last;
+    }
+
+private:
+    // DATA
+    /// \brief The beginning of the range.
+    iterator_type m_first;
+    /// \brief The end of the range.
+    iterator_type m_last;
+};
+
+}
+
+/// \brief Contains the view adaptors, which create views with function call syntax (e.g. std::views::take(range, 4))
+/// or pipe syntax (e.g. range | std::views::take(4)).
+namespace views {}
+
+}
+
+#endif
\ No newline at end of file
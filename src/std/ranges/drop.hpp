@@ -0,0 +1,59 @@
+/// \file std/ranges/drop.hpp
+/// \brief Defines the std::views::drop adaptor.
+#ifndef STD___RANGES___DROP_H
+#define STD___RANGES___DROP_H
+
+// std
+#include <std/ranges/base.hpp>
+
+namespace std {
+
+namespace ranges {
+
+/// \brief Stores the argument of a std::views::drop adaptor for pipe syntax.
+struct drop_closure
+{
+    /// \brief The number of elements to drop.
+    std::size_t count;
+};
+
+/// \brief Creates a view of a range without its first elements with pipe syntax.
+/// \tparam range_type The type of the range.
+/// \param[in] range The range to view, which must outlive the view.
+/// \param[in] closure The adaptor closure holding the number of elements.
+/// \return A subrange of the elements of the range after the first count elements, or no elements if the range is shorter.
+/// \details Runs in O(1) for pointer iterators (e.g. std::vector and std::array), and otherwise in O(count).
+template <typename range_type>
+std::ranges::subrange<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator> operator|(range_type&& range, const std::ranges::drop_closure& closure)
+{
+    using range_traits = std::ranges::range<typename std::remove_reference<range_type>::type>;
+    return std::ranges::subrange<typename range_traits::iterator>(std::ranges::next(range_traits::begin(range), closure.count, range_traits::end(range)), range_traits::end(range));
+}
+
+}
+
+namespace views {
+
+/// \brief Creates a view of a range without its first elements.
+/// \tparam range_type The type of the range.
+/// \param[in] range The range to view, which must outlive the view.
+/// \param[in] count The number of elements to drop.
+/// \return A subrange of the elements of the range after the first count elements, or no elements if the range is shorter.
+template <typename range_type>
+std::ranges::subrange<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator> drop(range_type&& range, std::size_t count)
+{
+    return range | std::ranges::drop_closure{count};
+}
+/// \brief Creates an adaptor closure for viewing a range without its first elements with pipe syntax.
+/// \param[in] count The number of elements to drop.
+/// \return The adaptor closure.
+inline std::ranges::drop_closure drop(std::size_t count)
+{
+    return std::ranges::drop_closure{count};
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,203 @@
+/// \file std/ranges/filter.hpp
+/// \brief Defines the std::ranges::filter_view template class and std::views::filter adaptor.
+#ifndef STD___RANGES___FILTER_H
+#define STD___RANGES___FILTER_H
+
+// std
+#include <std/ranges/base.hpp>
+
+namespace std {
+
+namespace ranges {
+
+/// \brief A view of the elements of a range that satisfy a predicate.
+/// \tparam iterator_type The iterator type of the underlying range.
+/// \tparam predicate_type The type of the unary predicate.
+/// \details Elements are tested lazily as the view is iterated, so no intermediate storage is used.
+template <typename iterator_type, typename predicate_type>
+class filter_view
+{
+public:
+    /// \brief An iterator that skips the elements of the underlying range that do not satisfy the predicate.
+    class iterator
+    {
+    public:
+        // TRAITS
+        /// \brief The category tag of the iterator.
+        using iterator_category = typename std::ranges::bidirectional_category<typename std::iterator_traits<iterator_type>::iterator_category>::type;
+        /// \brief The type of the elements the iterator points to.
+        using value_type = typename std::iterator_traits<iterator_type>::value_type;
+        /// \brief The type of the distance between two iterators.
+        using difference_type = std::ptrdiff_t;
+        /// \brief The type returned by the iterator's operator->.
+        using pointer = typename std::iterator_traits<iterator_type>::pointer;
+        /// \brief The type returned by dereferencing the iterator.
+        using reference = typename std::iterator_traits<iterator_type>::reference;
+
+        // CONSTRUCTORS
+        /// \brief Constructs a new iterator instance at the first satisfying element at or after a position.
+        /// \param[in] current The position in the underlying range.
+        /// \param[in] last The end of the underlying range.
+        /// \param[in] predicate The unary predicate.
+        iterator(iterator_type current, iterator_type last, const predicate_type& predicate)
+            : m_current(current),
+              m_last(last),
+              m_predicate(predicate)
+        {
+            iterator::satisfy();
+        }
+
+        // ACCESS
+        /// \brief Gets the element the iterator points to.
+        /// \return The element of the underlying range.
+        reference operator*() const
+        {
+            return *iterator::m_current;
+        }
+
+        // MODIFIERS
+        /// \brief Advances the iterator to the next satisfying element.
+        /// \return A reference to this iterator.
+        iterator& operator++()
+        {
+            ++iterator::m_current;
+            iterator::satisfy();
+            return *this;
+        }
+        /// \brief Moves the iterator back to the previous satisfying element.
+        /// \return A reference to this iterator.
+        /// \note Requires a bidirectional underlying iterator and a satisfying element before this iterator.
+        iterator& operator--()
+        {
+            do
+            {
+                --iterator::m_current;
+            } while(!iterator::m_predicate(*iterator::m_current));
+
+            return *this;
+        }
+
+        // COMPARISON
+        /// \brief Checks if this iterator points to the same element as another iterator.
+        /// \param[in] other The other iterator to compare with.
+        /// \return TRUE if the iterators are equal, otherwise FALSE.
+        bool operator==(const iterator& other) const
+        {
+            return iterator::m_current == other.m_current;
+        }
+        /// \brief Checks if this iterator points to a different element than another iterator.
+        /// \param[in] other The other iterator to compare with.
+        /// \return TRUE if the iterators are unequal, otherwise FALSE.
+        bool operator!=(const iterator& other) const
+        {
+            return iterator::m_current != other.m_current;
+        }
+
+    private:
+        // DATA
+        /// \brief The position in the underlying range.
+        iterator_type m_current;
+        /// \brief The end of the underlying range.
+        iterator_type m_last;
+        /// \brief The unary predicate.
+        predicate_type m_predicate;
+
+        // METHODS
+        /// \brief Advances the position to the first satisfying element at or after it.
+        void satisfy()
+        {
+            while(iterator::m_current != iterator::m_last && !iterator::m_predicate(*iterator::m_current))
+            {
+                ++iterator::m_current;
+            }
+        }
+    };
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new filter_view instance.
+    /// \param[in] first The beginning of the underlying range.
+    /// \param[in] last The end of the underlying range.
+    /// \param[in] predicate The unary predicate that elements must satisfy.
+    filter_view(iterator_type first, iterator_type last, const predicate_type& predicate)
+        : m_first(first),
+          m_last(last),
+          m_predicate(predicate)
+    {}
+
+    // ITERATORS
+    /// \brief Gets an iterator to the first satisfying element.
+    /// \return An iterator to the first satisfying element.
+    /// \details Runs in O(n), as it searches for the first satisfying element.
+    iterator begin() const
+    {
+        return iterator(filter_view::m_first, filter_view::m_last, filter_view::m_predicate);
+    }
+    /// \brief Gets an iterator to the end of the view.
+    /// \return An iterator to the end of the view.
+    iterator end() const
+    {
+        return iterator(filter_view::m_last, filter_view::m_last, filter_view::m_predicate);
+    }
+
+private:
+    // DATA
+    /// \brief The beginning of the underlying range.
+    iterator_type m_first;
+    /// \brief The end of the underlying range.
+    iterator_type m_last;
+    /// \brief The unary predicate that elements must satisfy.
+    predicate_type m_predicate;
+};
+
+/// \brief Stores the argument of a std::views::filter adaptor for pipe syntax.
+/// \tparam predicate_type The type of the unary predicate.
+template <typename predicate_type>
+struct filter_closure
+{
+    /// \brief The unary predicate.
+    predicate_type predicate;
+};
+
+/// \brief Creates a filter_view of a range with pipe syntax.
+/// \tparam range_type The type of the range.
+/// \tparam predicate_type The type of the unary predicate.
+/// \param[in] range The range to view, which must outlive the view.
+/// \param[in] closure The adaptor closure holding the predicate.
+/// \return The filter_view of the range.
+template <typename range_type, typename predicate_type>
+std::ranges::filter_view<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator,predicate_type> operator|(range_type&& range, const std::ranges::filter_closure<predicate_type>& closure)
+{
+    using range_traits = std::ranges::range<typename std::remove_reference<range_type>::type>;
+    return std::ranges::filter_view<typename range_traits::iterator,predicate_type>(range_traits::begin(range), range_traits::end(range), closure.predicate);
+}
+
+}
+
+namespace views {
+
+/// \brief Creates a view of the elements of a range that satisfy a predicate.
+/// \tparam range_type The type of the range.
+/// \tparam predicate_type The type of the unary predicate.
+/// \param[in] range The range to view, which must outlive the view.
+/// \param[in] predicate The unary predicate, called as predicate(element).
+/// \return The filter_view of the range.
+template <typename range_type, typename predicate_type>
+std::ranges::filter_view<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator,predicate_type> filter(range_type&& range, predicate_type predicate)
+{
+    return range | std::ranges::filter_closure<predicate_type>{predicate};
+}
+/// \brief Creates an adaptor closure for viewing the elements of a range that satisfy a predicate with pipe syntax.
+/// \tparam predicate_type The type of the unary predicate.
+/// \param[in] predicate The unary predicate, called as predicate(element).
+/// \return The adaptor closure.
+template <typename predicate_type>
+std::ranges::filter_closure<predicate_type> filter(predicate_type predicate)
+{
+    return std::ranges::filter_closure<predicate_type>{predicate};
+}
+
+}
+
+}
+
+#endif
\ No newline at end of file
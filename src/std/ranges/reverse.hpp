@@ -0,0 +1,93 @@
+/// \file std/ranges/reverse.hpp
+/// \brief Defines the std::ranges::reverse_view template class and std::views::reverse adaptor.
+#ifndef STD___RANGES___REVERSE_H
+#define STD___RANGES___REVERSE_H
+
+// std
+#include <std/container/reverse_iterator.hpp>
+#include <std/ranges/base.hpp>
+
+namespace std {
+
+namespace ranges {
+
+/// \brief A view of the elements of a range in reverse order.
+/// \tparam iterator_type The bidirectional iterator type of the underlying range.
+template <typename iterator_type>
+class reverse_view
+{
+public:
+    /// \brief An iterator that traverses the underlying range backwards.
+    using iterator = std::reverse_iterator<iterator_type>;
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new reverse_view instance.
+    /// \param[in] first The beginning of the underlying range.
+    /// \param[in] last The end of the underlying range.
+    reverse_view(iterator_type first, iterator_type last)
+        : m_first(first),
+          m_last(last)
+    {}
+
+    // ITERATORS
+    /// \brief Gets an iterator to the beginning of the view, which is the last element of the underlying range.
+    /// \return An iterator to the beginning of the view.
+    iterator begin() const
+    {
+        return iterator(reverse_view::m_last);
+    }
+    /// \brief Gets an iterator to the end of the view.
+    /// \return An iterator to the end of the view.
+    iterator end() const
+    {
+        return iterator(reverse_view::m_first);
+    }
+
+private:
+    // DATA
+    /// \brief The beginning of the underlying range.
+    iterator_type m_first;
+    /// \brief The end of the underlying range.
+    iterator_type m_last;
+};
+
+/// \brief Stores a std::views::reverse adaptor for pipe syntax.
+struct reverse_closure
+{};
+
+/// \brief Creates a reverse_view of a range with pipe syntax.
+/// \tparam range_type The type of the range.
+/// \param[in] range The range to view, which must outlive the view.
+/// \return The reverse_view of the range.
+template <typename range_type>
+std::ranges::reverse_view<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator> operator|(range_type&& range, const std::ranges::reverse_closure&)
+{
+    using range_traits = std::ranges::range<typename std::remove_reference<range_type>::type>;
+    return std::ranges::reverse_view<typename range_traits::iterator>(range_traits::begin(range), range_traits::end(range));
+}
+
+}
+
+namespace views {
+
+/// \brief Creates a view of the elements of a range in reverse order.
+/// \tparam range_type The type of the range.
+/// \param[in] range The range to view, which must outlive the view and have bidirectional iterators.
+/// \return The reverse_view of the range.
+template <typename range_type>
+std::ranges::reverse_view<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator> reverse(range_type&& range)
+{
+    return range | std::ranges::reverse_closure();
+}
+/// \brief Creates an adaptor closure for viewing the elements of a range in reverse order with pipe syntax.
+/// \return The adaptor closure.
+inline std::ranges::reverse_closure reverse()
+{
+    return std::ranges::reverse_closure();
+}
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,59 @@
+/// \file std/ranges/take.hpp
+/// \brief Defines the std::views::take adaptor.
+#ifndef STD___RANGES___TAKE_H
+#define STD___RANGES___TAKE_H
+
+// std
+#include <std/ranges/base.hpp>
+
+namespace std {
+
+namespace ranges {
+
+/// \brief Stores the argument of a std::views::take adaptor for pipe syntax.
+struct take_closure
+{
+    /// \brief The number of elements to take.
+    std::size_t count;
+};
+
+/// \brief Creates a view of the first elements of a range with pipe syntax.
+/// \tparam range_type The type of the range.
+/// \param[in] range The range to view, which must outlive the view.
+/// \param[in] closure The adaptor closure holding the number of elements.
+/// \return A subrange of the first count elements of the range, or all elements if the range is shorter.
+/// \details Runs in O(1) for pointer iterators (e.g. std::vector and std::array), and otherwise in O(count).
+template <typename range_type>
+std::ranges::subrange<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator> operator|(range_type&& range, const std::ranges::take_closure& closure)
+{
+    using range_traits = std::ranges::range<typename std::remove_reference<range_type>::type>;
+    return std::ranges::subrange<typename range_traits::iterator>(range_traits::begin(range), std::ranges::next(range_traits::begin(range), closure.count, range_traits::end(range)));
+}
+
+}
+
+namespace views {
+
+/// \brief Creates a view of the first elements of a range.
+/// \tparam range_type The type of the range.
+/// \param[in] range The range to view, which must outlive the view.
+/// \param[in] count The number of elements to take.
+/// \return A subrange of the first count elements of the range, or all elements if the range is shorter.
+template <typename range_type>
+std::ranges::subrange<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator> take(range_type&& range, std::size_t count)
+{
+    return range | std::ranges::take_closure{count};
+}
+/// \brief Creates an adaptor closure for viewing the first elements of a range with pipe syntax.
+/// \param[in] count The number of elements to take.
+/// \return The adaptor closure.
+inline std::ranges::take_closure take(std::size_t count)
+{
+    return std::ranges::take_closure{count};
+}
+
+}
+
+}
+
+#endif
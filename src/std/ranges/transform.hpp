@@ -0,0 +1,186 @@
+/// \file std/ranges/transform.hpp
+/// \brief Defines the std::ranges::transform_view template class and std::views::transform adaptor.
+#ifndef STD___RANGES___TRANSFORM_H
+#define STD___RANGES___TRANSFORM_H
+
+// std
+#include <std/ranges/base.hpp>
+#include <std/utility/declval.hpp>
+#include <std/utility/remove_reference.hpp>
+
+namespace std {
+
+namespace ranges {
+
+/// \brief A view of the results of applying a function to each element of a range.
+/// \tparam iterator_type The iterator type of the underlying range.
+/// \tparam function_type The type of the unary function.
+/// \details The function is applied lazily each time an element is accessed, so no intermediate storage is used.
+template <typename iterator_type, typename function_type>
+class transform_view
+{
+public:
+    /// \brief The type of the results of the function.
+    using result_type = decltype(std::declval<const function_type&>()(*std::declval<iterator_type&>()));
+
+    /// \brief An iterator that applies the function to the elements of the underlying range.
+    class iterator
+    {
+    public:
+        // TRAITS
+        /// \brief The category tag of the iterator.
+        using iterator_category = typename std::ranges::bidirectional_category<typename std::iterator_traits<iterator_type>::iterator_category>::type;
+        /// \brief The type of the elements the iterator points to.
+        using value_type = typename std::remove_reference<result_type>::type;
+        /// \brief The type of the distance between two iterators.
+        using difference_type = std::ptrdiff_t;
+        /// \brief The type returned by the iterator's operator->.
+        using pointer = void;
+        /// \brief The type returned by dereferencing the iterator.
+        using reference = result_type;
+
+        // CONSTRUCTORS
+        /// \brief Constructs a new iterator instance.
+        /// \param[in] current The position in the underlying range.
+        /// \param[in] function The unary function.
+        iterator(iterator_type current, const function_type& function)
+            : m_current(current),
+              m_function(function)
+        {}
+
+        // ACCESS
+        /// \brief Gets the result of applying the function to the element the iterator points to.
+        /// \return The result of the function.
+        reference operator*() const
+        {
+            return iterator::m_function(*iterator::m_current);
+        }
+
+        // MODIFIERS
+        /// \brief Advances the iterator to the next element.
+        /// \return A reference to this iterator.
+        iterator& operator++()
+        {
+            ++iterator::m_current;
+            return *this;
+        }
+        /// \brief Moves the iterator back to the previous element.
+        /// \return A reference to this iterator.
+        /// \note Requires a bidirectional underlying iterator.
+        iterator& operator--()
+        {
+            --iterator::m_current;
+            return *this;
+        }
+
+        // COMPARISON
+        /// \brief Checks if this iterator points to the same element as another iterator.
+        /// \param[in] other The other iterator to compare with.
+        /// \return TRUE if the iterators are equal, otherwise FALSE.
+        bool operator==(const iterator& other) const
+        {
+            return iterator::m_current == other.m_current;
+        }
+        /// \brief Checks if this iterator points to a different element than another iterator.
+        /// \param[in] other The other iterator to compare with.
+        /// \return TRUE if the iterators are unequal, otherwise FALSE.
+        bool operator!=(const iterator& other) const
+        {
+            return iterator::m_current != other.m_current;
+        }
+
+    private:
+        // DATA
+        /// \brief The position in the underlying range.
+        iterator_type m_current;
+        /// \brief The unary function.
+        function_type m_function;
+    };
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new transform_view instance.
+    /// \param[in] first The beginning of the underlying range.
+    /// \param[in] last The end of the underlying range.
+    /// \param[in] function The unary function to apply to each element.
+    transform_view(iterator_type first, iterator_type last, const function_type& function)
+        : m_first(first),
+          m_last(last),
+          m_function(function)
+    {}
+
+    // ITERATORS
+    /// \brief Gets an iterator to the beginning of the view.
+    /// \return An iterator to the beginning of the view.
+    iterator begin() const
+    {
+        return iterator(transform_view::m_first, transform_view::m_function);
+    }
+    /// \brief Gets an iterator to the end of the view.
+    /// \return An iterator to the end of the view.
+    iterator end() const
+    {
+        return iterator(transform_view::m_last, transform_view::m_function);
+    }
+
+private:
+    // DATA
+    /// \brief The beginning of the underlying range.
+    iterator_type m_first;
+    /// \brief The end of the underlying range.
+    iterator_type m_last;
+    /// \brief The unary function to apply to each element.
+    function_type m_function;
+};
+
+/// \brief Stores the argument of a std::views::transform adaptor for pipe syntax.
+/// \tparam function_type The type of the unary function.
+template <typename function_type>
+struct transform_closure
+{
+    /// \brief The unary function.
+    function_type function;
+};
+
+/// \brief Creates a transform_view of a range with pipe syntax.
+/// \tparam range_type The type of the range.
+/// \tparam function_type The type of the unary function.
+/// \param[in] range The range to view, which must outlive the view.
+/// \param[in] closure The adaptor closure holding the function.
+/// \return The transform_view of the range.
+template <typename range_type, typename function_type>
+std::ranges::transform_view<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator,function_type> operator|(range_type&& range, const std::ranges::transform_closure<function_type>& closure)
+{
+    using range_traits = std::ranges::range<typename std::remove_reference<range_type>::type>;
+    return std::ranges::transform_view<typename range_traits::iterator,function_type>(range_traits::begin(range), range_traits::end(range), closure.function);
+}
+
+}
+
+namespace views {
+
+/// \brief Creates a view of the results of applying a function to each element of a range.
+/// \tparam range_type The type of the range.
+/// \tparam function_type The type of the unary function.
+/// \param[in] range The range to view, which must outlive the view.
+/// \param[in] function The unary function, called as function(element). Must be callable as const.
+/// \return The transform_view of the range.
+template <typename range_type, typename function_type>
+std::ranges::transform_view<typename std::ranges::range<typename std::remove_reference<range_type>::type>::iterator,function_type> transform(range_type&& range, function_type function)
+{
+    return range | std::ranges::transform_closure<function_type>{function};
+}
+/// \brief Creates an adaptor closure for viewing the results of applying a function to a range with pipe syntax.
+/// \tparam function_type The type of the unary function.
+/// \param[in] function The unary function, called as function(element). Must be callable as const.
+/// \return The adaptor closure.
+template <typename function_type>
+std::ranges::transform_closure<function_type> transform(function_type function)
+{
+    return std::ranges::transform_closure<function_type>{function};
+}
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,176 @@
+/// \file std/ranges/zip.hpp
+/// \brief Defines the std::ranges::zip_view template class and std::views::zip adaptor.
+#ifndef STD___RANGES___ZIP_H
+#define STD___RANGES___ZIP_H
+
+// std
+#include <std/ranges/base.hpp>
+
+namespace std {
+
+namespace ranges {
+
+/// \brief The element of a zip_view, which refers to an element from each range.
+/// \tparam first_type The reference type of the elements of the first range.
+/// \tparam second_type The reference type of the elements of the second range.
+template <typename first_type, typename second_type>
+struct zip_reference
+{
+    /// \brief The element of the first range.
+    first_type first;
+    /// \brief The element of the second range.
+    second_type second;
+};
+
+/// \brief A view of the elements of two ranges in lockstep.
+/// \tparam iterator_type_a The iterator type of the first range.
+/// \tparam iterator_type_b The iterator type of the second range.
+/// \details The view ends when either range ends. Each element is a zip_reference, so elements of both ranges can be
+/// read and written in place through its first and second members.
+template <typename iterator_type_a, typename iterator_type_b>
+class zip_view
+{
+public:
+    /// \brief The type of the elements of the view.
+    using element = std::ranges::zip_reference<typename std::iterator_traits<iterator_type_a>::reference,typename std::iterator_traits<iterator_type_b>::reference>;
+
+    /// \brief An iterator that traverses both underlying ranges together.
+    class iterator
+    {
+    public:
+        // TRAITS
+        /// \brief The category tag of the iterator.
+        using iterator_category = std::forward_iterator_tag;
+        /// \brief The type of the elements the iterator points to.
+        using value_type = element;
+        /// \brief The type of the distance between two iterators.
+        using difference_type = std::ptrdiff_t;
+        /// \brief The type returned by the iterator's operator->.
+        using pointer = void;
+        /// \brief The type returned by dereferencing the iterator.
+        using reference = element;
+
+        // CONSTRUCTORS
+        /// \brief Constructs a new iterator instance.
+        /// \param[in] current_a The position in the first range.
+        /// \param[in] current_b The position in the second range.
+        iterator(iterator_type_a current_a, iterator_type_b current_b)
+            : m_current_a(current_a),
+              m_current_b(current_b)
+        {}
+
+        // ACCESS
+        /// \brief Gets the elements the iterator points to.
+        /// \return A zip_reference to the elements of both ranges.
+        reference operator*() const
+        {
+            return reference{*iterator::m_current_a, *iterator::m_current_b};
+        }
+
+        // MODIFIERS
+        /// \brief Advances the iterator to the next elements.
+        /// \return A reference to this iterator.
+        iterator& operator++()
+        {
+            ++iterator::m_current_a;
+            ++iterator::m_current_b;
+            return *this;
+        }
+        /// \brief Moves the iterator back to the previous elements.
+        /// \return A reference to this iterator.
+        /// \note Requires bidirectional underlying iterators.
+        iterator& operator--()
+        {
+            --iterator::m_current_a;
+            --iterator::m_current_b;
+            return *this;
+        }
+
+        // COMPARISON
+        /// \brief Checks if this iterator has reached the position of another iterator in either range.
+        /// \param[in] other The other iterator to compare with.
+        /// \return TRUE if the iterators are equal, otherwise FALSE.
+        /// \details Comparing either position makes the end iterator match as soon as the shorter range ends.
+        bool operator==(const iterator& other) const
+        {
+            return iterator::m_current_a == other.m_current_a || iterator::m_current_b == other.m_current_b;
+        }
+        /// \brief Checks if this iterator has not reached the position of another iterator in either range.
+        /// \param[in] other The other iterator to compare with.
+        /// \return TRUE if the iterators are unequal, otherwise FALSE.
+        bool operator!=(const iterator& other) const
+        {
+            return !iterator::operator==(other);
+        }
+
+    private:
+        // DATA
+        /// \brief The position in the first range.
+        iterator_type_a m_current_a;
+        /// \brief The position in the second range.
+        iterator_type_b m_current_b;
+    };
+
+    // CONSTRUCTORS
+    /// \brief Constructs a new zip_view instance.
+    /// \param[in] first_a The beginning of the first range.
+    /// \param[in] last_a The end of the first range.
+    /// \param[in] first_b The beginning of the second range.
+    /// \param[in] last_b The end of the second range.
+    zip_view(iterator_type_a first_a, iterator_type_a last_a, iterator_type_b first_b, iterator_type_b last_b)
+        : m_first_a(first_a),
+          m_last_a(last_a),
+          m_first_b(first_b),
+          m_last_b(last_b)
+    {}
+
+    // ITERATORS
+    /// \brief Gets an iterator to the beginning of the view.
+    /// \return An iterator to the beginning of the view.
+    iterator begin() const
+    {
+        return iterator(zip_view::m_first_a, zip_view::m_first_b);
+    }
+    /// \brief Gets an iterator to the end of the view.
+    /// \return An iterator to the end of the view.
+    /// \note Iterating backwards from the end is only valid if both ranges are the same length.
+    iterator end() const
+    {
+        return iterator(zip_view::m_last_a, zip_view::m_last_b);
+    }
+
+private:
+    // DATA
+    /// \brief The beginning of the first range.
+    iterator_type_a m_first_a;
+    /// \brief The end of the first range.
+    iterator_type_a m_last_a;
+    /// \brief The beginning of the second range.
+    iterator_type_b m_first_b;
+    /// \brief The end of the second range.
+    iterator_type_b m_last_b;
+};
+
+}
+
+namespace views {
+
+/// \brief Creates a view of the elements of two ranges in lockstep.
+/// \tparam range_type_a The type of the first range.
+/// \tparam range_type_b The type of the second range.
+/// \param[in] range_a The first range to view, which must outlive the view.
+/// \param[in] range_b The second range to view, which must outlive the view.
+/// \return The zip_view of the ranges, which is as long as the shorter range.
+template <typename range_type_a, typename range_type_b>
+std::ranges::zip_view<typename std::ranges::range<typename std::remove_reference<range_type_a>::type>::iterator,typename std::ranges::range<typename std::remove_reference<range_type_b>::type>::iterator> zip(range_type_a&& range_a, range_type_b&& range_b)
+{
+    using range_traits_a = std::ranges::range<typename std::remove_reference<range_type_a>::type>;
+    using range_traits_b = std::ranges::range<typename std::remove_reference<range_type_b>::type>;
+    return std::ranges::zip_view<typename range_traits_a::iterator,typename range_traits_b::iterator>(range_traits_a::begin(range_a), range_traits_a::end(range_a), range_traits_b::begin(range_b), range_traits_b::end(range_b));
+}
+
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -11,6 +11,9 @@ namespace std {
 /// \brief An unsigned integer type large enough to hold the maximum possible size of any object on the system.
 using size_t = ::size_t;
 
+/// \brief A signed integer type large enough to hold the difference between two pointers.
+using ptrdiff_t = ::ptrdiff_t;
+
 }
 
 #endif
\ No newline at end of file
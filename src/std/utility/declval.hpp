@@ -0,0 +1,17 @@
+/// \file std/utility/declval.hpp
+/// \brief Defines the std::declval template function.
+#ifndef STD___UTILITY___DECLVAL_H
+#define STD___UTILITY___DECLVAL_H
+
+namespace std {
+
+/// \brief Gets a reference to an object of a type in an unevaluated context (e.g. decltype), without constructing one.
+/// \tparam object_type The type of the object. An lvalue reference type gives an lvalue.
+/// \return A reference to the object.
+/// \note Only declared, so it may not be called in evaluated code.
+template <typename object_type>
+object_type&& declval() noexcept;
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,27 @@
+/// \file std/utility/enable_if.hpp
+/// \brief Defines the std::enable_if template struct.
+#ifndef STD___UTILITY___ENABLE_IF_H
+#define STD___UTILITY___ENABLE_IF_H
+
+namespace std {
+
+/// \brief Removes a template from overload resolution unless a condition holds.
+/// \tparam condition_value The condition.
+/// \tparam object_type The type to provide if the condition holds.
+/// \details Has no type member if the condition is FALSE, so using the type member in a template's signature removes
+/// the template from consideration.
+template <bool condition_value, typename object_type = void>
+struct enable_if
+{};
+/// \brief Provides a type because the condition holds.
+/// \tparam object_type The type to provide.
+template <typename object_type>
+struct enable_if<true, object_type>
+{
+    /// \brief The provided type.
+    using type = object_type;
+};
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,25 @@
+/// \file std/utility/errc.hpp
+/// \brief Defines the std::errc error code enumeration.
+#ifndef STD___UTILITY___ERRC_H
+#define STD___UTILITY___ERRC_H
+
+// std
+#include <std/stddef.hpp>
+
+namespace std {
+
+/// \brief Error codes reported by the library's std::expected results.
+/// \details Only the conditions the library can actually report are enumerated, so the codes fit in a single byte.
+enum class errc : uint8_t
+{
+    /// \brief An argument was outside of the valid domain.
+    invalid_argument,
+    /// \brief The container did not have capacity for the operation.
+    no_buffer_space,
+    /// \brief A result could not be represented by its type.
+    result_out_of_range
+};
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,290 @@
+/// \file std/utility/expected.hpp
+/// \brief Defines the std::expected and std::unexpected template classes.
+#ifndef STD___UTILITY___EXPECTED_H
+#define STD___UTILITY___EXPECTED_H
+
+// std
+#include <std/memory/construct_at.hpp>
+#include <std/utility/is_trivially_copyable.hpp>
+#include <std/utility/move.hpp>
+
+namespace std {
+
+/// \brief Wraps an error value for constructing an std::expected that contains an error.
+/// \tparam error_type The type of the error.
+template <typename error_type>
+class unexpected
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new unexpected instance.
+    /// \param[in] error The error value.
+    constexpr explicit unexpected(const error_type& error)
+        : m_error(error)
+    {}
+
+    // ACCESS
+    /// \brief Gets the error value.
+    /// \return A const reference to the error value.
+    constexpr const error_type& error() const
+    {
+        return unexpected::m_error;
+    }
+
+private:
+    // DATA
+    /// \brief The error value.
+    error_type m_error;
+};
+
+/// \brief Creates an std::unexpected from an error value.
+/// \tparam error_type The type of the error.
+/// \param[in] error The error value.
+/// \return The unexpected wrapping the error.
+template <typename error_type>
+constexpr std::unexpected<error_type> make_unexpected(const error_type& error)
+{
+    return std::unexpected<error_type>(error);
+}
+
+namespace utility {
+
+/// \brief The storage of an std::expected, which defines how it is copied, moved and destroyed.
+/// \tparam object_type The type of the value.
+/// \tparam error_type The type of the error.
+/// \tparam trivial Indicates if both the value and the error are trivially copyable.
+/// \details This specialization constructs, assigns and destroys the active member explicitly.
+template <typename object_type, typename error_type, bool trivial = std::is_trivially_copyable<object_type>::value && std::is_trivially_copyable<error_type>::value>
+class expected_storage
+{
+protected:
+    // CONSTRUCTORS
+    /// \brief Constructs a new storage instance, leaving the active member unconstructed.
+    /// \param[in] has_value Indicates if the value, rather than the error, will be constructed.
+    expected_storage(bool has_value)
+        : m_has_value(has_value)
+    {}
+    /// \brief Copy-constructs a new storage instance from another storage instance.
+    /// \param[in] other The other storage to copy.
+    expected_storage(const std::utility::expected_storage<object_type,error_type,trivial>& other)
+        : m_has_value(other.m_has_value)
+    {
+        expected_storage::construct(other);
+    }
+    /// \brief Move-constructs a new storage instance from another storage instance.
+    /// \param[in] other The other storage to move.
+    expected_storage(std::utility::expected_storage<object_type,error_type,trivial>&& other)
+        : m_has_value(other.m_has_value)
+    {
+        expected_storage::construct(std::move(other));
+    }
+    ~expected_storage()
+    {
+        expected_storage::destroy();
+    }
+
+    // MODIFIERS
+    /// \brief Copy-assigns another storage instance to this storage instance.
+    /// \param[in] other The other storage to copy.
+    /// \return A reference to this storage.
+    std::utility::expected_storage<object_type,error_type,trivial>& operator=(const std::utility::expected_storage<object_type,error_type,trivial>& other)
+    {
+        if(this != &other)
+        {
+            expected_storage::destroy();
+            expected_storage::m_has_value = other.m_has_value;
+            expected_storage::construct(other);
+        }
+
+        return *this;
+    }
+    /// \brief Move-assigns another storage instance to this storage instance.
+    /// \param[in] other The other storage to move.
+    /// \return A reference to this storage.
+    std::utility::expected_storage<object_type,error_type,trivial>& operator=(std::utility::expected_storage<object_type,error_type,trivial>&& other)
+    {
+        if(this != &other)
+        {
+            expected_storage::destroy();
+            expected_storage::m_has_value = other.m_has_value;
+            expected_storage::construct(std::move(other));
+        }
+
+        return *this;
+    }
+
+    // DATA
+    /// \brief Stores either the value or the error, as indicated by m_has_value.
+    union
+    {
+        /// \brief The contained value.
+        object_type m_value;
+        /// \brief The contained error.
+        error_type m_error;
+    };
+    /// \brief Indicates if the storage contains a value rather than an error.
+    bool m_has_value;
+
+private:
+    // METHODS
+    /// \brief Copy-constructs the active member of another storage instance into this storage.
+    /// \param[in] other The other storage, whose m_has_value must match this storage's.
+    void construct(const std::utility::expected_storage<object_type,error_type,trivial>& other)
+    {
+        if(other.m_has_value)
+        {
+            std::construct_at(&(expected_storage::m_value), other.m_value);
+        }
+        else
+        {
+            std::construct_at(&(expected_storage::m_error), other.m_error);
+        }
+    }
+    /// \brief Move-constructs the active member of another storage instance into this storage.
+    /// \param[in] other The other storage, whose m_has_value must match this storage's.
+    void construct(std::utility::expected_storage<object_type,error_type,trivial>&& other)
+    {
+        if(other.m_has_value)
+        {
+            std::construct_at(&(expected_storage::m_value), std::move(other.m_value));
+        }
+        else
+        {
+            std::construct_at(&(expected_storage::m_error), std::move(other.m_error));
+        }
+    }
+    /// \brief Destroys the active member of this storage.
+    void destroy()
+    {
+        if(expected_storage::m_has_value)
+        {
+            std::destroy_at(&(expected_storage::m_value));
+        }
+        else
+        {
+            std::destroy_at(&(expected_storage::m_error));
+        }
+    }
+};
+/// \brief The storage of an std::expected whose value and error are both trivially copyable.
+/// \tparam object_type The type of the value.
+/// \tparam error_type The type of the error.
+/// \details Copy, move and destruction are left implicit, so the expected is itself trivially copyable and can be
+/// passed and returned in registers.
+template <typename object_type, typename error_type>
+class expected_storage<object_type,error_type,true>
+{
+protected:
+    // CONSTRUCTORS
+    /// \brief Constructs a new storage instance, leaving the active member unconstructed.
+    /// \param[in] has_value Indicates if the value, rather than the error, will be constructed.
+    expected_storage(bool has_value)
+        : m_has_value(has_value)
+    {}
+
+    // DATA
+    /// \brief Stores either the value or the error, as indicated by m_has_value.
+    union
+    {
+        /// \brief The contained value.
+        object_type m_value;
+        /// \brief The contained error.
+        error_type m_error;
+    };
+    /// \brief Indicates if the storage contains a value rather than an error.
+    bool m_has_value;
+};
+
+}
+
+/// \brief The result of an operation, which contains either a value or an error.
+/// \tparam object_type The type of the value.
+/// \tparam error_type The type of the error.
+/// \details The value and error share inline storage, so no memory is allocated. Accessing the value of an expected
+/// that contains an error (or vice versa) is undefined, so has_value() or operator bool should be checked first. An
+/// expected whose value and error are trivially copyable is itself trivially copyable.
+template <typename object_type, typename error_type>
+class expected
+    : public std::utility::expected_storage<object_type,error_type>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new expected instance containing a copy of a value.
+    /// \param[in] value The value to copy.
+    expected(const object_type& value)
+        : std::utility::expected_storage<object_type,error_type>(true)
+    {
+        std::construct_at(&(expected::m_value), value);
+    }
+    /// \brief Constructs a new expected instance containing a moved value.
+    /// \param[in] value The value to move.
+    expected(object_type&& value)
+        : std::utility::expected_storage<object_type,error_type>(true)
+    {
+        std::construct_at(&(expected::m_value), std::move(value));
+    }
+    /// \brief Constructs a new expected instance containing an error.
+    /// \tparam other_error_type The type of the unexpected error, which must be convertible to error_type.
+    /// \param[in] error The unexpected error.
+    template <typename other_error_type>
+    expected(const std::unexpected<other_error_type>& error)
+        : std::utility::expected_storage<object_type,error_type>(false)
+    {
+        std::construct_at(&(expected::m_error), error.error());
+    }
+
+    // ACCESS
+    /// \brief Checks if the expected contains a value.
+    /// \return TRUE if the expected contains a value, FALSE if it contains an error.
+    bool has_value() const
+    {
+        return expected::m_has_value;
+    }
+    /// \brief Checks if the expected contains a value.
+    /// \return TRUE if the expected contains a value, FALSE if it contains an error.
+    explicit operator bool() const
+    {
+        return expected::m_has_value;
+    }
+    /// \brief Gets the contained value.
+    /// \return A reference to the value. The expected must contain a value.
+    object_type& operator*()
+    {
+        return expected::m_value;
+    }
+    /// \brief Gets the contained value.
+    /// \return A const reference to the value. The expected must contain a value.
+    const object_type& operator*() const
+    {
+        return expected::m_value;
+    }
+    /// \brief Accesses the members of the contained value.
+    /// \return A pointer to the value. The expected must contain a value.
+    object_type* operator->()
+    {
+        return &(expected::m_value);
+    }
+    /// \brief Accesses the members of the contained value.
+    /// \return A const pointer to the value. The expected must contain a value.
+    const object_type* operator->() const
+    {
+        return &(expected::m_value);
+    }
+    /// \brief Gets the contained value, or a fallback value if the expected contains an error.
+    /// \param[in] fallback The value to return if the expected contains an error.
+    /// \return A copy of the contained value, or the fallback value.
+    object_type value_or(const object_type& fallback) const
+    {
+        return expected::m_has_value ? expected::m_value : fallback;
+    }
+    /// \brief Gets the contained error.
+    /// \return A const reference to the error. The expected must contain an error.
+    const error_type& error() const
+    {
+        return expected::m_error;
+    }
+};
+
+}
+
+#endif
\ No newline at end of file
@@ -9,14 +9,24 @@
 namespace std {
 
 /// \brief Forwards a value while maintaining its value category.
-/// \tparam object_type The type of the object to be forwardd.
+/// \tparam object_type The type of the object to be forwarded, which must be specified explicitly. An lvalue reference
+/// type forwards the object as an lvalue, and any other type forwards it as an rvalue.
 /// \param[in] object The object to forward.
-/// \return The value with it's value category preserved.
+/// \return The value with its value category preserved.
 template <typename object_type>
-typename std::remove_reference<object_type>::type&& forward(object_type& object)
+object_type&& forward(typename std::remove_reference<object_type>::type& object)
 {
-    // Convert the object to an r_value reference.
-    return static_cast<typename std::remove_reference<object_type>::type&&>(object);
+    // Collapse the reference to the forwarded value category.
+    return static_cast<object_type&&>(object);
+}
+/// \brief Forwards an rvalue as an rvalue.
+/// \tparam object_type The type of the object to be forwarded, which must be specified explicitly.
+/// \param[in] object The object to forward.
+/// \return The value as an rvalue.
+template <typename object_type>
+object_type&& forward(typename std::remove_reference<object_type>::type&& object)
+{
+    return static_cast<object_type&&>(object);
 }
 
 }
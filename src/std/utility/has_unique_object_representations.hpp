@@ -0,0 +1,26 @@
+/// \file std/utility/has_unique_object_representations.hpp
+/// \brief Defines the std::has_unique_object_representations template struct.
+#ifndef STD___UTILITY___HAS_UNIQUE_OBJECT_REPRESENTATIONS_H
+#define STD___UTILITY___HAS_UNIQUE_OBJECT_REPRESENTATIONS_H
+
+namespace std {
+
+/// \brief Checks if objects of a type with equal values always have equal bytes.
+/// \tparam object_type The type of the object to check.
+/// \details This holds for integers and structs of integers without padding, but not for floating point types (e.g.
+/// 0.0 and -0.0 are equal) or padded structs. Objects of such types can be compared for equality with memcmp. Uses the
+/// compiler's builtin trait.
+template <typename object_type>
+struct has_unique_object_representations
+{
+    /// \brief TRUE if the object type has unique object representations, otherwise FALSE.
+    static constexpr bool value = __has_unique_object_representations(object_type);
+};
+
+/// \brief TRUE if the object type has unique object representations, otherwise FALSE.
+template <typename object_type>
+constexpr bool has_unique_object_representations<object_type>::value;
+
+}
+
+#endif
\ No newline at end of file
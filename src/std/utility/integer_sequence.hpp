@@ -0,0 +1,82 @@
+/// \file std/utility/integer_sequence.hpp
+/// \brief Defines the std::index_sequence template class and std::make_index_sequence type definition.
+#ifndef STD___UTILITY___INTEGER_SEQUENCE_H
+#define STD___UTILITY___INTEGER_SEQUENCE_H
+
+// std
+#include <std/stddef.hpp>
+
+namespace std {
+
+/// \brief A compile-time sequence of indices.
+/// \tparam index_values The indices within the sequence.
+template <std::size_t... index_values>
+struct index_sequence
+{
+    /// \brief Gets the number of indices in the sequence.
+    /// \return The number of indices in the sequence.
+    static constexpr std::size_t size()
+    {
+        return sizeof...(index_values);
+    }
+};
+
+/// \brief Contains all code for utility components.
+namespace utility {
+
+/// \brief Contains all code for compile-time sequence components.
+namespace sequence {
+
+/// \brief Concatenates two index sequences, offsetting the second sequence by the size of the first.
+/// \tparam first_type The first index sequence.
+/// \tparam second_type The second index sequence.
+template <typename first_type, typename second_type>
+struct concatenate;
+
+/// \brief Concatenates two index sequences, offsetting the second sequence by the size of the first.
+/// \tparam first_values The indices of the first sequence.
+/// \tparam second_values The indices of the second sequence.
+template <std::size_t... first_values, std::size_t... second_values>
+struct concatenate<std::index_sequence<first_values...>, std::index_sequence<second_values...>>
+{
+    /// \brief Captures the concatenated index sequence.
+    using type = std::index_sequence<first_values..., (sizeof...(first_values) + second_values)...>;
+};
+
+/// \brief Generates an index sequence of a specified size.
+/// \tparam size_value The number of indices to generate.
+/// \details The sequence is built by halving, which keeps template recursion depth logarithmic in the size.
+template <std::size_t size_value>
+struct generate
+{
+    /// \brief Captures the generated index sequence.
+    using type = typename std::utility::sequence::concatenate<typename std::utility::sequence::generate<size_value / 2>::type,
+                                                              typename std::utility::sequence::generate<size_value - size_value / 2>::type>::type;
+};
+
+/// \brief Generates an empty index sequence.
+template <>
+struct generate<0>
+{
+    /// \brief Captures the generated index sequence.
+    using type = std::index_sequence<>;
+};
+
+/// \brief Generates an index sequence with a single index.
+template <>
+struct generate<1>
+{
+    /// \brief Captures the generated index sequence.
+    using type = std::index_sequence<0>;
+};
+
+}}
+
+/// \brief An index sequence containing the indices [0, size_value).
+/// \tparam size_value The number of indices in the sequence.
+template <std::size_t size_value>
+using make_index_sequence = typename std::utility::sequence::generate<size_value>::type;
+
+}
+
+#endif
\ No newline at end of file
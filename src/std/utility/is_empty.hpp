@@ -0,0 +1,24 @@
+/// \file std/utility/is_empty.hpp
+/// \brief Defines the std::is_empty template struct.
+#ifndef STD___UTILITY___IS_EMPTY_H
+#define STD___UTILITY___IS_EMPTY_H
+
+namespace std {
+
+/// \brief Checks if an object type is a class with no non-static data members, virtual functions, or virtual bases.
+/// \tparam object_type The type of the object to check.
+/// \details Uses the compiler's builtin trait, which is available in avr-gcc and all other supported toolchains.
+template <typename object_type>
+struct is_empty
+{
+    /// \brief TRUE if the object type is empty, otherwise FALSE.
+    static constexpr bool value = __is_empty(object_type);
+};
+
+/// \brief TRUE if the object type is empty, otherwise FALSE.
+template <typename object_type>
+constexpr bool is_empty<object_type>::value;
+
+}
+
+#endif
\ No newline at end of file
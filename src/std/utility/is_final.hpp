@@ -0,0 +1,24 @@
+/// \file std/utility/is_final.hpp
+/// \brief Defines the std::is_final template struct.
+#ifndef STD___UTILITY___IS_FINAL_H
+#define STD___UTILITY___IS_FINAL_H
+
+namespace std {
+
+/// \brief Checks if an object type is a class declared final.
+/// \tparam object_type The type of the object to check.
+/// \details Uses the compiler's builtin trait, which is available in avr-gcc and all other supported toolchains.
+template <typename object_type>
+struct is_final
+{
+    /// \brief TRUE if the object type is final, otherwise FALSE.
+    static constexpr bool value = __is_final(object_type);
+};
+
+/// \brief TRUE if the object type is final, otherwise FALSE.
+template <typename object_type>
+constexpr bool is_final<object_type>::value;
+
+}
+
+#endif
\ No newline at end of file
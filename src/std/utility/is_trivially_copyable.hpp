@@ -0,0 +1,24 @@
+/// \file std/utility/is_trivially_copyable.hpp
+/// \brief Defines the std::is_trivially_copyable template struct.
+#ifndef STD___UTILITY___IS_TRIVIALLY_COPYABLE_H
+#define STD___UTILITY___IS_TRIVIALLY_COPYABLE_H
+
+namespace std {
+
+/// \brief Checks if an object type can be copied by copying its bytes.
+/// \tparam object_type The type of the object to check.
+/// \details Uses the compiler's builtin trait, which is available in avr-gcc and all other supported toolchains.
+template <typename object_type>
+struct is_trivially_copyable
+{
+    /// \brief TRUE if the object type is trivially copyable, otherwise FALSE.
+    static constexpr bool value = __is_trivially_copyable(object_type);
+};
+
+/// \brief TRUE if the object type is trivially copyable, otherwise FALSE.
+template <typename object_type>
+constexpr bool is_trivially_copyable<object_type>::value;
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,373 @@
+/// \file std/utility/optional.hpp
+/// \brief Defines the std::optional template class.
+#ifndef STD___UTILITY___OPTIONAL_H
+#define STD___UTILITY___OPTIONAL_H
+
+// std
+#include <std/memory/construct_at.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/forward.hpp>
+#include <std/utility/is_trivially_copyable.hpp>
+#include <std/utility/move.hpp>
+
+namespace std {
+
+/// \brief The type of std::nullopt, which indicates an empty optional.
+struct nullopt_t
+{
+    /// \brief Constructs a new nullopt_t instance.
+    /// \details The constructor is explicit so that {} is not ambiguous between an empty optional and a nullopt_t.
+    constexpr explicit nullopt_t(int)
+    {}
+};
+
+/// \brief Indicates an empty optional.
+constexpr std::nullopt_t nullopt{0};
+
+namespace utility {
+
+/// \brief The storage of an std::optional, which defines how it is copied, moved and destroyed.
+/// \tparam object_type The type of the value.
+/// \tparam trivial Indicates if the value is trivially copyable.
+/// \details This specialization constructs, assigns and destroys the value explicitly.
+template <typename object_type, bool trivial = std::is_trivially_copyable<object_type>::value>
+class optional_storage
+{
+protected:
+    // CONSTRUCTORS
+    /// \brief Constructs a new storage instance that does not contain a value.
+    optional_storage()
+        : m_empty(),
+          m_has_value(false)
+    {}
+    /// \brief Copy-constructs a new storage instance from another storage instance.
+    /// \param[in] other The other storage to copy.
+    optional_storage(const std::utility::optional_storage<object_type,trivial>& other)
+        : m_has_value(other.m_has_value)
+    {
+        if(other.m_has_value)
+        {
+            std::construct_at(&(optional_storage::m_value), other.m_value);
+        }
+    }
+    /// \brief Move-constructs a new storage instance from another storage instance.
+    /// \param[in] other The other storage to move. Its value is moved from, but it still contains a value.
+    optional_storage(std::utility::optional_storage<object_type,trivial>&& other)
+        : m_has_value(other.m_has_value)
+    {
+        if(other.m_has_value)
+        {
+            std::construct_at(&(optional_storage::m_value), std::move(other.m_value));
+        }
+    }
+    ~optional_storage()
+    {
+        optional_storage::destroy();
+    }
+
+    // MODIFIERS
+    /// \brief Copy-assigns another storage instance to this storage instance.
+    /// \param[in] other The other storage to copy.
+    /// \return A reference to this storage.
+    std::utility::optional_storage<object_type,trivial>& operator=(const std::utility::optional_storage<object_type,trivial>& other)
+    {
+        if(!other.m_has_value)
+        {
+            optional_storage::destroy();
+        }
+        else if(optional_storage::m_has_value)
+        {
+            optional_storage::m_value = other.m_value;
+        }
+        else
+        {
+            std::construct_at(&(optional_storage::m_value), other.m_value);
+            optional_storage::m_has_value = true;
+        }
+
+        return *this;
+    }
+    /// \brief Move-assigns another storage instance to this storage instance.
+    /// \param[in] other The other storage to move. Its value is moved from, but it still contains a value.
+    /// \return A reference to this storage.
+    std::utility::optional_storage<object_type,trivial>& operator=(std::utility::optional_storage<object_type,trivial>&& other)
+    {
+        if(!other.m_has_value)
+        {
+            optional_storage::destroy();
+        }
+        else if(optional_storage::m_has_value)
+        {
+            optional_storage::m_value = std::move(other.m_value);
+        }
+        else
+        {
+            std::construct_at(&(optional_storage::m_value), std::move(other.m_value));
+            optional_storage::m_has_value = true;
+        }
+
+        return *this;
+    }
+    /// \brief Destroys the value, if any, leaving the storage empty.
+    void destroy()
+    {
+        if(optional_storage::m_has_value)
+        {
+            std::destroy_at(&(optional_storage::m_value));
+            optional_storage::m_has_value = false;
+        }
+    }
+
+    // DATA
+    /// \brief Stores the value, which is only constructed while the storage contains a value.
+    union
+    {
+        /// \brief The contained value.
+        object_type m_value;
+        /// \brief The active member while the storage is empty, so that copies never read uninitialized storage.
+        uint8_t m_empty;
+    };
+    /// \brief Indicates if the storage contains a value.
+    bool m_has_value;
+};
+/// \brief The storage of an std::optional of a trivially copyable value.
+/// \tparam object_type The type of the value.
+/// \details Copy, move and destruction are left implicit, so the optional is itself trivially copyable and can be
+/// passed and returned in registers.
+template <typename object_type>
+class optional_storage<object_type,true>
+{
+protected:
+    // CONSTRUCTORS
+    /// \brief Constructs a new storage instance that does not contain a value.
+    optional_storage()
+        : m_empty(),
+          m_has_value(false)
+    {}
+
+    // MODIFIERS
+    /// \brief Leaves the storage empty. The value has a trivial destructor, so it is not destroyed.
+    void destroy()
+    {
+        optional_storage::m_has_value = false;
+    }
+
+    // DATA
+    /// \brief Stores the value, which is only constructed while the storage contains a value.
+    union
+    {
+        /// \brief The contained value.
+        object_type m_value;
+        /// \brief The active member while the storage is empty, so that copies never read uninitialized storage.
+        uint8_t m_empty;
+    };
+    /// \brief Indicates if the storage contains a value.
+    bool m_has_value;
+};
+
+}
+
+/// \brief An object that may or may not contain a value.
+/// \tparam object_type The type of the value.
+/// \details The value is stored inline within the optional, so no memory is allocated. Accessing the value of an empty
+/// optional is undefined, so has_value() or operator bool should be checked first, or value_or() used. An optional of a
+/// trivially copyable value is itself trivially copyable.
+template <typename object_type>
+class optional
+    : public std::utility::optional_storage<object_type>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty optional instance.
+    optional()
+    {}
+    /// \brief Constructs a new empty optional instance.
+    optional(std::nullopt_t)
+    {}
+    /// \brief Constructs a new optional instance containing a copy of a value.
+    /// \param[in] value The value to copy.
+    optional(const object_type& value)
+    {
+        std::construct_at(&(optional::m_value), value);
+        optional::m_has_value = true;
+    }
+    /// \brief Constructs a new optional instance containing a moved value.
+    /// \param[in] value The value to move.
+    optional(object_type&& value)
+    {
+        std::construct_at(&(optional::m_value), std::move(value));
+        optional::m_has_value = true;
+    }
+
+    // ACCESS
+    /// \brief Checks if the optional contains a value.
+    /// \return TRUE if the optional contains a value, otherwise FALSE.
+    bool has_value() const
+    {
+        return optional::m_has_value;
+    }
+    /// \brief Checks if the optional contains a value.
+    /// \return TRUE if the optional contains a value, otherwise FALSE.
+    explicit operator bool() const
+    {
+        return optional::m_has_value;
+    }
+    /// \brief Gets the contained value.
+    /// \return A reference to the value. The optional must contain a value.
+    object_type& operator*()
+    {
+        return optional::m_value;
+    }
+    /// \brief Gets the contained value.
+    /// \return A const reference to the value. The optional must contain a value.
+    const object_type& operator*() const
+    {
+        return optional::m_value;
+    }
+    /// \brief Accesses the members of the contained value.
+    /// \return A pointer to the value. The optional must contain a value.
+    object_type* operator->()
+    {
+        return &(optional::m_value);
+    }
+    /// \brief Accesses the members of the contained value.
+    /// \return A const pointer to the value. The optional must contain a value.
+    const object_type* operator->() const
+    {
+        return &(optional::m_value);
+    }
+    /// \brief Gets the contained value, or a fallback value if the optional is empty.
+    /// \param[in] fallback The value to return if the optional is empty.
+    /// \return A copy of the contained value, or the fallback value.
+    object_type value_or(const object_type& fallback) const
+    {
+        return optional::m_has_value ? optional::m_value : fallback;
+    }
+
+    // MODIFIERS
+    /// \brief Destroys the contained value, if any, leaving the optional empty.
+    void reset()
+    {
+        optional::destroy();
+    }
+    /// \brief Constructs a new contained value in place, destroying any previous value.
+    /// \tparam argument_types The types of the constructor arguments.
+    /// \param[in] arguments The arguments to forward to the value's constructor.
+    /// \return A reference to the new value.
+    template <typename... argument_types>
+    object_type& emplace(argument_types&&... arguments)
+    {
+        optional::reset();
+        std::construct_at(&(optional::m_value), std::forward<argument_types>(arguments)...);
+        optional::m_has_value = true;
+        return optional::m_value;
+    }
+    /// \brief Empties the optional.
+    /// \return A reference to this optional.
+    std::optional<object_type>& operator=(std::nullopt_t)
+    {
+        optional::reset();
+        return *this;
+    }
+    /// \brief Swaps the contents of this optional with another optional.
+    /// \param[in] other The other optional to swap with.
+    void swap(std::optional<object_type>& other)
+    {
+        std::optional<object_type> temporary(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temporary);
+    }
+
+    // COMPARISON
+    /// \brief Checks if this optional is equal to another optional.
+    /// \param[in] other The other optional to compare with.
+    /// \return TRUE if both are empty, or both contain equal values, otherwise FALSE.
+    bool operator==(const std::optional<object_type>& other) const
+    {
+        // Compare the values only once both are known to exist.
+        if(!optional::m_has_value || !other.m_has_value)
+        {
+            return optional::m_has_value == other.m_has_value;
+        }
+        return optional::m_value == other.m_value;
+    }
+    /// \brief Checks if this optional is unequal with another optional.
+    /// \param[in] other The other optional to compare with.
+    /// \return TRUE if the optionals are unequal, otherwise FALSE.
+    bool operator!=(const std::optional<object_type>& other) const
+    {
+        return !optional::operator==(other);
+    }};
+
+/// \brief An object that may or may not refer to another object.
+/// \tparam object_type The type of the referenced object.
+/// \details Stored as a single pointer, where nullptr indicates an empty optional. Assigning an optional reference
+/// rebinds it rather than assigning through to the referenced object.
+template <typename object_type>
+class optional<object_type&>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new empty optional reference instance.
+    optional()
+        : m_pointer(nullptr)
+    {}
+    /// \brief Constructs a new empty optional reference instance.
+    optional(std::nullopt_t)
+        : m_pointer(nullptr)
+    {}
+    /// \brief Constructs a new optional reference instance that refers to an object.
+    /// \param[in] object The object to refer to.
+    optional(object_type& object)
+        : m_pointer(&object)
+    {}
+
+    // ACCESS
+    /// \brief Checks if the optional refers to an object.
+    /// \return TRUE if the optional refers to an object, otherwise FALSE.
+    bool has_value() const
+    {
+        return optional::m_pointer != nullptr;
+    }
+    /// \brief Checks if the optional refers to an object.
+    /// \return TRUE if the optional refers to an object, otherwise FALSE.
+    explicit operator bool() const
+    {
+        return optional::m_pointer != nullptr;
+    }
+    /// \brief Gets the referenced object.
+    /// \return A reference to the object. The optional must refer to an object.
+    object_type& operator*() const
+    {
+        return *optional::m_pointer;
+    }
+    /// \brief Accesses the members of the referenced object.
+    /// \return A pointer to the object. The optional must refer to an object.
+    object_type* operator->() const
+    {
+        return optional::m_pointer;
+    }
+    /// \brief Gets a copy of the referenced object, or a fallback value if the optional is empty.
+    /// \param[in] fallback The value to return if the optional is empty.
+    /// \return A copy of the referenced object, or the fallback value.
+    object_type value_or(const object_type& fallback) const
+    {
+        return optional::m_pointer ? *optional::m_pointer : fallback;
+    }
+
+    // MODIFIERS
+    /// \brief Empties the optional.
+    void reset()
+    {
+        optional::m_pointer = nullptr;
+    }
+
+private:
+    // DATA
+    /// \brief A pointer to the referenced object, or nullptr if the optional is empty.
+    object_type* m_pointer;
+};
+
+}
+
+#endif
\ No newline at end of file
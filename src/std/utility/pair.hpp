@@ -5,6 +5,7 @@
 
 // std
 #include <std/utility/forward.hpp>
+#include <std/utility/swap.hpp>
 
 namespace std {
 
@@ -20,7 +21,7 @@ struct pair
     /// \brief Constructs a new pair instance with copy-constructed values.
     /// \param[in] first The first value to copy-construct from.
     /// \param[in] second The second value to copy-construct from.
-    pair(const first_type& first, const second_type& second)
+    constexpr pair(const first_type& first, const second_type& second)
         : first(first),
           second(second)
     {}
@@ -33,16 +34,12 @@ struct pair
     {}
     /// \brief Constructs a new pair instance with values copy-constructed from another pair.
     /// \param[in] other The other pair to copy-construct from.
-    pair(const std::pair<first_type,second_type>& other)
-        : first(other.first),
-          second(other.second)
-    {}
+    /// \details The copy and move operations are defaulted, so a pair of trivially copyable values is itself trivially
+    /// copyable (e.g. for reading from flash memory).
+    pair(const std::pair<first_type,second_type>& other) = default;
     /// \brief Constructs a new pair instance with values move-constructed from another pair.
     /// \param[in] other The other pair to move-construct from.
-    pair(std::pair<first_type,second_type>&& other)
-        : first(std::forward<first_type>(other.first)),
-          second(std::forward<second_type>(other.second))
-    {}
+    pair(std::pair<first_type,second_type>&& other) = default;
 
     // VALUES
     /// \brief The first value within this pair.
@@ -53,27 +50,19 @@ struct pair
     // MODIFIERS
     /// \brief Assigns values from another pair to this pair.
     /// \param[in] other The other pair to assign values from.
-    void operator=(const std::pair<first_type,second_type>& other)
-    {
-        // Copy the values from the other pair.
-        pair::first = other.first;
-        pair::second = other.second;
-    }
+    /// \return A reference to this pair.
+    std::pair<first_type,second_type>& operator=(const std::pair<first_type,second_type>& other) = default;
+    /// \brief Moves values from another pair to this pair.
+    /// \param[in] other The other pair to move values from.
+    /// \return A reference to this pair.
+    std::pair<first_type,second_type>& operator=(std::pair<first_type,second_type>&& other) = default;
     /// \brief Swaps the values of this pair with another pair.
     /// \param[in] other The other pair to swap values with.
     void swap(std::pair<first_type,second_type>& other)
     {
-        // Create temporaries for swap.
-        first_type first_copy = pair::first;
-        second_type second_copy = pair::second;
-
-        // Copy other into this pair.
-        pair::first = other.first;
-        pair::second = other.second;
-
-        // Copy temporaries into other pair.
-        other.first = first_copy;
-        other.second = second_copy;
+        // Exchange the values with moves rather than copies.
+        std::swap(pair::first, other.first);
+        std::swap(pair::second, other.second);
     }
 
     // COMPARISON
@@ -0,0 +1,26 @@
+/// \file std/utility/swap.hpp
+/// \brief Defines the std::swap template function.
+#ifndef STD___UTILITY___SWAP_H
+#define STD___UTILITY___SWAP_H
+
+// std
+#include <std/utility/move.hpp>
+
+namespace std {
+
+/// \brief Swaps the values of two objects.
+/// \tparam object_type The type of the objects to swap.
+/// \param[in] a The first object to swap.
+/// \param[in] b The second object to swap.
+/// \details The values are exchanged with moves, so objects that own resources are swapped without deep copies.
+template <typename object_type>
+void swap(object_type& a, object_type& b)
+{
+    object_type temp(std::move(a));
+    a = std::move(b);
+    b = std::move(temp);
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,656 @@
+/// \file std/utility/tuple.hpp
+/// \brief Defines the std::tuple template class, the std::get, std::apply, std::tie, and std::make_tuple template
+/// functions, and the std::tuple_size and std::tuple_element traits for tuples and pairs.
+#ifndef STD___UTILITY___TUPLE_H
+#define STD___UTILITY___TUPLE_H
+
+// std
+#include <std/stddef.hpp>
+#include <std/utility/declval.hpp>
+#include <std/utility/enable_if.hpp>
+#include <std/utility/forward.hpp>
+#include <std/utility/integer_sequence.hpp>
+#include <std/utility/is_empty.hpp>
+#include <std/utility/is_final.hpp>
+#include <std/utility/move.hpp>
+#include <std/utility/pair.hpp>
+#include <std/utility/remove_reference.hpp>
+#include <std/utility/swap.hpp>
+#include <std/utility/variadic.hpp>
+
+namespace std {
+
+template <typename... types>
+class tuple;
+
+// TRAITS
+/// \brief Gets the number of elements of a tuple-like type.
+/// \tparam tuple_type The tuple-like type.
+template <typename tuple_type>
+struct tuple_size;
+/// \brief Gets the number of elements of a const tuple-like type.
+/// \tparam tuple_type The tuple-like type.
+template <typename tuple_type>
+struct tuple_size<const tuple_type>
+    : public std::tuple_size<tuple_type>
+{};
+/// \brief Gets the number of elements of a tuple.
+/// \tparam types The element types of the tuple.
+template <typename... types>
+struct tuple_size<std::tuple<types...>>
+{
+    /// \brief The number of elements.
+    static constexpr std::size_t value = sizeof...(types);
+};
+/// \brief Gets the number of elements of a pair, which is two.
+/// \tparam first_type The object type of the first value.
+/// \tparam second_type The object type of the second value.
+template <typename first_type, typename second_type>
+struct tuple_size<std::pair<first_type,second_type>>
+{
+    /// \brief The number of elements.
+    static constexpr std::size_t value = 2;
+};
+
+/// \brief The number of elements.
+template <typename... types>
+constexpr std::size_t tuple_size<std::tuple<types...>>::value;
+/// \brief The number of elements.
+template <typename first_type, typename second_type>
+constexpr std::size_t tuple_size<std::pair<first_type,second_type>>::value;
+
+/// \brief Gets the type of an element of a tuple-like type.
+/// \tparam index_value The index of the element.
+/// \tparam tuple_type The tuple-like type.
+template <std::size_t index_value, typename tuple_type>
+struct tuple_element;
+/// \brief Gets the type of an element of a const tuple-like type.
+/// \tparam index_value The index of the element.
+/// \tparam tuple_type The tuple-like type.
+template <std::size_t index_value, typename tuple_type>
+struct tuple_element<index_value, const tuple_type>
+{
+    /// \brief The type of the element.
+    using type = const typename std::tuple_element<index_value, tuple_type>::type;
+};
+/// \brief Gets the type of an element of a tuple.
+/// \tparam index_value The index of the element.
+/// \tparam types The element types of the tuple.
+template <std::size_t index_value, typename... types>
+struct tuple_element<index_value, std::tuple<types...>>
+{
+    /// \brief The type of the element.
+    using type = typename std::utility::variadic::type_at<index_value, types...>::type;
+};
+/// \brief Gets the type of an element of a pair.
+/// \tparam index_value The index of the element, which is 0 for the first value and 1 for the second value.
+/// \tparam first_type The object type of the first value.
+/// \tparam second_type The object type of the second value.
+template <std::size_t index_value, typename first_type, typename second_type>
+struct tuple_element<index_value, std::pair<first_type,second_type>>
+{
+    /// \brief The type of the element.
+    using type = typename std::utility::variadic::type_at<index_value, first_type, second_type>::type;
+};
+
+namespace utility {
+
+/// \brief Contains all code for implementing tuples.
+namespace product {
+
+/// \brief Stores a single element of a tuple.
+/// \tparam index_value The index of the element, which keeps leaves of the same type distinct.
+/// \tparam object_type The type of the element.
+/// \tparam empty_value Indicates if the element type is an empty, non-final class.
+template <std::size_t index_value, typename object_type, bool empty_value = std::is_empty<object_type>::value && !std::is_final<object_type>::value>
+class leaf
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new leaf instance with a value-initialized element.
+    leaf()
+        : m_value()
+    {}
+    /// \brief Constructs a new leaf instance with an element constructed from an argument.
+    /// \tparam argument_type The type of the argument.
+    /// \param[in] argument The argument to forward to the element's constructor.
+    template <typename argument_type>
+    explicit leaf(argument_type&& argument)
+        : m_value(std::forward<argument_type>(argument))
+    {}
+
+    // ACCESS
+    /// \brief Gets the element.
+    /// \return A reference to the element.
+    object_type& get()
+    {
+        return leaf::m_value;
+    }
+    /// \brief Gets the element.
+    /// \return A const reference to the element.
+    const object_type& get() const
+    {
+        return leaf::m_value;
+    }
+
+private:
+    // DATA
+    /// \brief The element.
+    object_type m_value;
+};
+/// \brief Stores a single empty element of a tuple as a base class, so it occupies no storage.
+/// \tparam index_value The index of the element, which keeps leaves of the same type distinct.
+/// \tparam object_type The type of the element.
+template <std::size_t index_value, typename object_type>
+class leaf<index_value, object_type, true>
+    : private object_type
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new leaf instance with a value-initialized element.
+    leaf()
+        : object_type()
+    {}
+    /// \brief Constructs a new leaf instance with an element constructed from an argument.
+    /// \tparam argument_type The type of the argument.
+    /// \param[in] argument The argument to forward to the element's constructor.
+    template <typename argument_type>
+    explicit leaf(argument_type&& argument)
+        : object_type(std::forward<argument_type>(argument))
+    {}
+
+    // ACCESS
+    /// \brief Gets the element.
+    /// \return A reference to the element.
+    object_type& get()
+    {
+        return *this;
+    }
+    /// \brief Gets the element.
+    /// \return A const reference to the element.
+    const object_type& get() const
+    {
+        return *this;
+    }
+};
+
+/// \brief Stores all elements of a tuple by inheriting one leaf per element.
+/// \tparam sequence_type The index sequence of the elements.
+/// \tparam types The element types.
+template <typename sequence_type, typename... types>
+class base;
+/// \brief Stores all elements of a tuple by inheriting one leaf per element.
+/// \tparam index_values The indices of the elements.
+/// \tparam types The element types.
+template <std::size_t... index_values, typename... types>
+class base<std::index_sequence<index_values...>, types...>
+    : public std::utility::product::leaf<index_values, types>...
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new base instance with value-initialized elements.
+    base()
+        : std::utility::product::leaf<index_values, types>()...
+    {}
+    /// \brief Constructs a new base instance with elements constructed from arguments.
+    /// \tparam argument_types The types of the arguments.
+    /// \param[in] arguments The arguments to forward to each element's constructor.
+    template <typename... argument_types>
+    explicit base(argument_types&&... arguments)
+        : std::utility::product::leaf<index_values, types>(std::forward<argument_types>(arguments))...
+    {}
+
+    // MODIFIERS
+    /// \brief Assigns the elements of another tuple to these elements.
+    /// \tparam other_types The element types of the other tuple.
+    /// \param[in] other The other tuple.
+    template <typename... other_types>
+    void assign(const std::tuple<other_types...>& other)
+    {
+        int expand[] = {0, (static_cast<void>(static_cast<std::utility::product::leaf<index_values, types>&>(*this).get() = static_cast<const std::utility::product::leaf<index_values, other_types>&>(other).get()), 0)...};
+        static_cast<void>(expand);
+    }
+    /// \brief Moves the elements of another tuple into these elements.
+    /// \tparam other_types The element types of the other tuple.
+    /// \param[in] other The other tuple.
+    template <typename... other_types>
+    void assign(std::tuple<other_types...>&& other)
+    {
+        int expand[] = {0, (static_cast<void>(static_cast<std::utility::product::leaf<index_values, types>&>(*this).get() = std::forward<other_types>(static_cast<std::utility::product::leaf<index_values, other_types>&>(other).get())), 0)...};
+        static_cast<void>(expand);
+    }
+    /// \brief Swaps these elements with the elements of another tuple.
+    /// \param[in] other The other tuple.
+    void swap(std::tuple<types...>& other)
+    {
+        int expand[] = {0, (std::swap(static_cast<std::utility::product::leaf<index_values, types>&>(*this).get(), static_cast<std::utility::product::leaf<index_values, types>&>(other).get()), 0)...};
+        static_cast<void>(expand);
+    }
+};
+
+/// \brief Compares the elements of two tuples from an index onwards.
+/// \tparam index_value The index of the first element to compare.
+/// \tparam count_value The number of elements.
+template <std::size_t index_value, std::size_t count_value>
+struct compare
+{
+    /// \brief Checks if the remaining elements of two tuples are equal.
+    /// \tparam types The element types of the tuples.
+    /// \param[in] a The first tuple.
+    /// \param[in] b The second tuple.
+    /// \return TRUE if the remaining elements are equal, otherwise FALSE.
+    template <typename... types>
+    static bool equal(const std::tuple<types...>& a, const std::tuple<types...>& b)
+    {
+        using leaf_type = std::utility::product::leaf<index_value, typename std::tuple_element<index_value, std::tuple<types...>>::type>;
+        return static_cast<const leaf_type&>(a).get() == static_cast<const leaf_type&>(b).get() && std::utility::product::compare<index_value + 1, count_value>::equal(a, b);
+    }
+    /// \brief Checks if the remaining elements of a tuple are lexicographically less than those of another tuple.
+    /// \tparam types The element types of the tuples.
+    /// \param[in] a The first tuple.
+    /// \param[in] b The second tuple.
+    /// \return TRUE if the remaining elements of the first tuple are less, otherwise FALSE.
+    template <typename... types>
+    static bool less(const std::tuple<types...>& a, const std::tuple<types...>& b)
+    {
+        using leaf_type = std::utility::product::leaf<index_value, typename std::tuple_element<index_value, std::tuple<types...>>::type>;
+        if(static_cast<const leaf_type&>(a).get() < static_cast<const leaf_type&>(b).get())
+        {
+            return true;
+        }
+        if(static_cast<const leaf_type&>(b).get() < static_cast<const leaf_type&>(a).get())
+        {
+            return false;
+        }
+        return std::utility::product::compare<index_value + 1, count_value>::less(a, b);
+    }
+};
+/// \brief Compares no remaining elements of two tuples.
+/// \tparam count_value The number of elements.
+template <std::size_t count_value>
+struct compare<count_value, count_value>
+{
+    /// \brief Checks if no remaining elements are equal.
+    /// \tparam types The element types of the tuples.
+    /// \return TRUE, as there are no remaining elements.
+    template <typename... types>
+    static bool equal(const std::tuple<types...>&, const std::tuple<types...>&)
+    {
+        return true;
+    }
+    /// \brief Checks if no remaining elements are less.
+    /// \tparam types The element types of the tuples.
+    /// \return FALSE, as there are no remaining elements.
+    template <typename... types>
+    static bool less(const std::tuple<types...>&, const std::tuple<types...>&)
+    {
+        return false;
+    }
+};
+
+/// \brief Checks if a constructor's arguments are a single tuple of the constructed type, which must be copied or moved
+/// rather than used to construct the elements.
+/// \tparam tuple_type The constructed tuple type.
+/// \tparam argument_types The types of the constructor arguments.
+template <typename tuple_type, typename... argument_types>
+struct is_self
+{
+    /// \brief TRUE if the arguments are a single tuple of the constructed type, otherwise FALSE.
+    static constexpr bool value = false;
+};
+/// \brief Identifies a single tuple argument of the constructed type.
+/// \tparam tuple_type The constructed tuple type.
+/// \tparam argument_type The type of the argument.
+template <typename tuple_type, typename argument_type>
+struct is_self<tuple_type, argument_type>
+{
+    /// \brief TRUE if the arguments are a single tuple of the constructed type, otherwise FALSE.
+    static constexpr bool value = std::utility::variadic::find<typename std::remove_reference<argument_type>::type, tuple_type, const tuple_type>::value < 2;
+};
+
+}}
+
+/// \brief A fixed-size collection of heterogeneous elements.
+/// \tparam types The element types.
+/// \details Each element is stored in its own base class, so elements that are empty classes (e.g. stateless
+/// comparators or deleters) occupy no storage. Elements are accessed with std::get, and tuples may be unpacked with
+/// structured bindings or std::apply.
+template <typename... types>
+class tuple
+    : public std::utility::product::base<std::make_index_sequence<sizeof...(types)>, types...>
+{
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new tuple instance with value-initialized elements.
+    tuple() = default;
+    /// \brief Constructs a new tuple instance with copy-constructed elements.
+    /// \param[in] values The values to copy-construct the elements from.
+    tuple(const types&... values)
+        : std::utility::product::base<std::make_index_sequence<sizeof...(types)>, types...>(values...)
+    {}
+    /// \brief Constructs a new tuple instance with elements constructed from arguments.
+    /// \tparam argument_types The types of the arguments, one per element.
+    /// \param[in] arguments The arguments to forward to each element's constructor.
+    template <typename... argument_types, typename = typename std::enable_if<sizeof...(argument_types) == sizeof...(types) && !std::utility::product::is_self<std::tuple<types...>, argument_types...>::value>::type>
+    tuple(argument_types&&... arguments)
+        : std::utility::product::base<std::make_index_sequence<sizeof...(types)>, types...>(std::forward<argument_types>(arguments)...)
+    {}
+    /// \brief Copy-constructs a new tuple instance from another tuple.
+    /// \param[in] other The other tuple to copy.
+    tuple(const std::tuple<types...>& other) = default;
+    /// \brief Move-constructs a new tuple instance from another tuple.
+    /// \param[in] other The other tuple to move.
+    tuple(std::tuple<types...>&& other) = default;
+
+    // MODIFIERS
+    /// \brief Copy-assigns the elements of another tuple to this tuple's elements.
+    /// \param[in] other The other tuple to copy.
+    /// \return A reference to this tuple.
+    /// \details Reference elements assign through to the referenced objects, which allows std::tie to unpack tuples.
+    std::tuple<types...>& operator=(const std::tuple<types...>& other)
+    {
+        tuple::assign(other);
+        return *this;
+    }
+    /// \brief Move-assigns the elements of another tuple to this tuple's elements.
+    /// \param[in] other The other tuple to move.
+    /// \return A reference to this tuple.
+    std::tuple<types...>& operator=(std::tuple<types...>&& other)
+    {
+        tuple::assign(std::move(other));
+        return *this;
+    }
+    /// \brief Copy-assigns the elements of a tuple of other types to this tuple's elements.
+    /// \tparam other_types The element types of the other tuple, which must be assignable to these elements.
+    /// \param[in] other The other tuple to copy.
+    /// \return A reference to this tuple.
+    template <typename... other_types>
+    std::tuple<types...>& operator=(const std::tuple<other_types...>& other)
+    {
+        tuple::assign(other);
+        return *this;
+    }
+    /// \brief Move-assigns the elements of a tuple of other types to this tuple's elements.
+    /// \tparam other_types The element types of the other tuple, which must be assignable to these elements.
+    /// \param[in] other The other tuple to move.
+    /// \return A reference to this tuple.
+    template <typename... other_types>
+    std::tuple<types...>& operator=(std::tuple<other_types...>&& other)
+    {
+        tuple::assign(std::move(other));
+        return *this;
+    }
+    /// \brief Swaps the elements of this tuple with those of another tuple.
+    /// \param[in] other The other tuple to swap with.
+    /// \details The elements are exchanged with std::swap, so elements that own resources are swapped without deep
+    /// copies.
+    void swap(std::tuple<types...>& other)
+    {
+        std::utility::product::base<std::make_index_sequence<sizeof...(types)>, types...>::swap(other);
+    }
+
+    // COMPARISON
+    /// \brief Checks if this tuple's elements are equal to another tuple's elements.
+    /// \param[in] other The other tuple to compare with.
+    /// \return TRUE if all elements are equal, otherwise FALSE.
+    bool operator==(const std::tuple<types...>& other) const
+    {
+        return std::utility::product::compare<0, sizeof...(types)>::equal(*this, other);
+    }
+    /// \brief Checks if this tuple's elements are unequal with another tuple's elements.
+    /// \param[in] other The other tuple to compare with.
+    /// \return TRUE if any elements are unequal, otherwise FALSE.
+    bool operator!=(const std::tuple<types...>& other) const
+    {
+        return !tuple::operator==(other);
+    }
+    /// \brief Checks if this tuple is lexicographically less than another tuple.
+    /// \param[in] other The other tuple to compare with.
+    /// \return TRUE if this tuple is less than the other tuple, otherwise FALSE.
+    bool operator<(const std::tuple<types...>& other) const
+    {
+        return std::utility::product::compare<0, sizeof...(types)>::less(*this, other);
+    }
+    /// \brief Checks if this tuple is lexicographically less than or equal to another tuple.
+    /// \param[in] other The other tuple to compare with.
+    /// \return TRUE if this tuple is less than or equal to the other tuple, otherwise FALSE.
+    bool operator<=(const std::tuple<types...>& other) const
+    {
+        return !other.operator<(*this);
+    }
+    /// \brief Checks if this tuple is lexicographically greater than another tuple.
+    /// \param[in] other The other tuple to compare with.
+    /// \return TRUE if this tuple is greater than the other tuple, otherwise FALSE.
+    bool operator>(const std::tuple<types...>& other) const
+    {
+        return other.operator<(*this);
+    }
+    /// \brief Checks if this tuple is lexicographically greater than or equal to another tuple.
+    /// \param[in] other The other tuple to compare with.
+    /// \return TRUE if this tuple is greater than or equal to the other tuple, otherwise FALSE.
+    bool operator>=(const std::tuple<types...>& other) const
+    {
+        return !tuple::operator<(other);
+    }
+};
+/// \brief An empty tuple.
+template <>
+class tuple<>
+{
+public:
+    // MODIFIERS
+    /// \brief Swaps this empty tuple with another empty tuple, which does nothing.
+    void swap(std::tuple<>&)
+    {}
+
+    // COMPARISON
+    /// \brief Checks if this empty tuple is equal to another empty tuple.
+    /// \return TRUE, as all empty tuples are equal.
+    bool operator==(const std::tuple<>&) const
+    {
+        return true;
+    }
+    /// \brief Checks if this empty tuple is unequal with another empty tuple.
+    /// \return FALSE, as all empty tuples are equal.
+    bool operator!=(const std::tuple<>&) const
+    {
+        return false;
+    }
+};
+
+// ACCESS
+/// \brief Gets an element of a tuple.
+/// \tparam index_value The index of the element.
+/// \tparam types The element types of the tuple.
+/// \param[in] tuple The tuple.
+/// \return A reference to the element.
+template <std::size_t index_value, typename... types>
+typename std::tuple_element<index_value, std::tuple<types...>>::type& get(std::tuple<types...>& tuple)
+{
+    return static_cast<std::utility::product::leaf<index_value, typename std::tuple_element<index_value, std::tuple<types...>>::type>&>(tuple).get();
+}
+/// \brief Gets an element of a const tuple.
+/// \tparam index_value The index of the element.
+/// \tparam types The element types of the tuple.
+/// \param[in] tuple The tuple.
+/// \return A const reference to the element.
+template <std::size_t index_value, typename... types>
+const typename std::tuple_element<index_value, std::tuple<types...>>::type& get(const std::tuple<types...>& tuple)
+{
+    return static_cast<const std::utility::product::leaf<index_value, typename std::tuple_element<index_value, std::tuple<types...>>::type>&>(tuple).get();
+}
+/// \brief Gets an element of a tuple that is being moved from.
+/// \tparam index_value The index of the element.
+/// \tparam types The element types of the tuple.
+/// \param[in] tuple The tuple.
+/// \return An rvalue reference to the element, or an lvalue reference for reference elements.
+template <std::size_t index_value, typename... types>
+typename std::tuple_element<index_value, std::tuple<types...>>::type&& get(std::tuple<types...>&& tuple)
+{
+    return std::forward<typename std::tuple_element<index_value, std::tuple<types...>>::type>(std::get<index_value>(tuple));
+}
+
+namespace utility {
+namespace product {
+
+/// \brief Gets a value of a pair by index.
+/// \tparam index_value The index of the value, which is 0 for the first value and 1 for the second value.
+template <std::size_t index_value>
+struct pair_get;
+/// \brief Gets the first value of a pair.
+template <>
+struct pair_get<0>
+{
+    /// \brief Gets the first value of a pair.
+    /// \tparam first_type The object type of the first value.
+    /// \tparam second_type The object type of the second value.
+    /// \param[in] pair The pair.
+    /// \return A reference to the first value.
+    template <typename first_type, typename second_type>
+    static first_type& get(std::pair<first_type,second_type>& pair)
+    {
+        return pair.first;
+    }
+    /// \brief Gets the first value of a const pair.
+    /// \tparam first_type The object type of the first value.
+    /// \tparam second_type The object type of the second value.
+    /// \param[in] pair The pair.
+    /// \return A const reference to the first value.
+    template <typename first_type, typename second_type>
+    static const first_type& get(const std::pair<first_type,second_type>& pair)
+    {
+        return pair.first;
+    }
+};
+/// \brief Gets the second value of a pair.
+template <>
+struct pair_get<1>
+{
+    /// \brief Gets the second value of a pair.
+    /// \tparam first_type The object type of the first value.
+    /// \tparam second_type The object type of the second value.
+    /// \param[in] pair The pair.
+    /// \return A reference to the second value.
+    template <typename first_type, typename second_type>
+    static second_type& get(std::pair<first_type,second_type>& pair)
+    {
+        return pair.second;
+    }
+    /// \brief Gets the second value of a const pair.
+    /// \tparam first_type The object type of the first value.
+    /// \tparam second_type The object type of the second value.
+    /// \param[in] pair The pair.
+    /// \return A const reference to the second value.
+    template <typename first_type, typename second_type>
+    static const second_type& get(const std::pair<first_type,second_type>& pair)
+    {
+        return pair.second;
+    }
+};
+
+}}
+
+/// \brief Gets a value of a pair by index.
+/// \tparam index_value The index of the value, which is 0 for the first value and 1 for the second value.
+/// \tparam first_type The object type of the first value.
+/// \tparam second_type The object type of the second value.
+/// \param[in] pair The pair.
+/// \return A reference to the value.
+template <std::size_t index_value, typename first_type, typename second_type>
+typename std::tuple_element<index_value, std::pair<first_type,second_type>>::type& get(std::pair<first_type,second_type>& pair)
+{
+    return std::utility::product::pair_get<index_value>::get(pair);
+}
+/// \brief Gets a value of a const pair by index.
+/// \tparam index_value The index of the value, which is 0 for the first value and 1 for the second value.
+/// \tparam first_type The object type of the first value.
+/// \tparam second_type The object type of the second value.
+/// \param[in] pair The pair.
+/// \return A const reference to the value.
+template <std::size_t index_value, typename first_type, typename second_type>
+const typename std::tuple_element<index_value, std::pair<first_type,second_type>>::type& get(const std::pair<first_type,second_type>& pair)
+{
+    return std::utility::product::pair_get<index_value>::get(pair);
+}
+/// \brief Gets a value of a pair that is being moved from by index.
+/// \tparam index_value The index of the value, which is 0 for the first value and 1 for the second value.
+/// \tparam first_type The object type of the first value.
+/// \tparam second_type The object type of the second value.
+/// \param[in] pair The pair.
+/// \return An rvalue reference to the value.
+template <std::size_t index_value, typename first_type, typename second_type>
+typename std::tuple_element<index_value, std::pair<first_type,second_type>>::type&& get(std::pair<first_type,second_type>&& pair)
+{
+    return std::forward<typename std::tuple_element<index_value, std::pair<first_type,second_type>>::type>(std::get<index_value>(pair));
+}
+
+// CREATION
+/// \brief Creates a tuple of references to objects, for unpacking a tuple by assignment.
+/// \tparam types The types of the objects.
+/// \param[in] objects The objects to reference.
+/// \return A tuple of references to the objects.
+template <typename... types>
+std::tuple<types&...> tie(types&... objects)
+{
+    return std::tuple<types&...>(objects...);
+}
+/// \brief Creates a tuple from values.
+/// \tparam types The types of the values, which are deduced by value so arrays decay to pointers.
+/// \param[in] values The values to move into the tuple.
+/// \return The tuple.
+template <typename... types>
+std::tuple<types...> make_tuple(types... values)
+{
+    return std::tuple<types...>(std::move(values)...);
+}
+
+namespace utility {
+namespace product {
+
+/// \brief Gets the type returned by calling a function with the elements of a tuple.
+/// \tparam function_type The type of the function.
+/// \tparam tuple_type The type of the tuple, which may be a reference.
+/// \tparam sequence_type The index sequence of the tuple's elements.
+template <typename function_type, typename tuple_type, typename sequence_type>
+struct apply_result;
+/// \brief Gets the type returned by calling a function with the elements of a tuple.
+/// \tparam function_type The type of the function.
+/// \tparam tuple_type The type of the tuple, which may be a reference.
+/// \tparam index_values The indices of the tuple's elements.
+template <typename function_type, typename tuple_type, std::size_t... index_values>
+struct apply_result<function_type, tuple_type, std::index_sequence<index_values...>>
+{
+    /// \brief The type returned by the function.
+    using type = decltype(std::declval<function_type>()(std::get<index_values>(std::declval<tuple_type>())...));
+};
+
+/// \brief Calls a function with the elements of a tuple.
+/// \tparam function_type The type of the function.
+/// \tparam tuple_type The type of the tuple, which may be a reference.
+/// \tparam index_values The indices of the tuple's elements.
+/// \param[in] function The function.
+/// \param[in] tuple The tuple.
+/// \return The result of the function.
+template <typename function_type, typename tuple_type, std::size_t... index_values>
+typename std::utility::product::apply_result<function_type, tuple_type, std::index_sequence<index_values...>>::type apply(function_type&& function, tuple_type&& tuple, std::index_sequence<index_values...>)
+{
+    return std::forward<function_type>(function)(std::get<index_values>(std::forward<tuple_type>(tuple))...);
+}
+
+}}
+
+/// \brief Calls a function with the elements of a tuple as its arguments.
+/// \tparam function_type The type of the function.
+/// \tparam tuple_type The type of the tuple-like object (e.g. std::tuple or std::pair).
+/// \param[in] function The function.
+/// \param[in] tuple The tuple whose elements are passed to the function, in order.
+/// \return The result of the function.
+template <typename function_type, typename tuple_type>
+typename std::utility::product::apply_result<function_type, tuple_type, std::make_index_sequence<std::tuple_size<typename std::remove_reference<tuple_type>::type>::value>>::type apply(function_type&& function, tuple_type&& tuple)
+{
+    return std::utility::product::apply(std::forward<function_type>(function), std::forward<tuple_type>(tuple), std::make_index_sequence<std::tuple_size<typename std::remove_reference<tuple_type>::type>::value>());
+}
+
+}
+
+#endif
\ No newline at end of file
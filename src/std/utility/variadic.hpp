@@ -0,0 +1,139 @@
+/// \file std/utility/variadic.hpp
+/// \brief Defines compile-time helpers for querying a pack of types.
+#ifndef STD___UTILITY___VARIADIC_H
+#define STD___UTILITY___VARIADIC_H
+
+// std
+#include <std/stddef.hpp>
+
+namespace std {
+namespace utility {
+
+/// \brief Contains all code for querying a pack of types at compile time.
+namespace variadic {
+
+/// \brief Gets the type at an index within a pack of types.
+/// \tparam index_value The index of the type, which must be less than the number of types.
+/// \tparam types The pack of types.
+template <std::size_t index_value, typename... types>
+struct type_at;
+/// \brief Gets the type at an index within a pack of types by skipping the first type.
+/// \tparam index_value The index of the type.
+/// \tparam first_type The first type of the pack.
+/// \tparam other_types The remaining types of the pack.
+template <std::size_t index_value, typename first_type, typename... other_types>
+struct type_at<index_value, first_type, other_types...>
+{
+    /// \brief The type at the index.
+    using type = typename std::utility::variadic::type_at<index_value - 1, other_types...>::type;
+};
+/// \brief Gets the first type of a pack of types.
+/// \tparam first_type The first type of the pack.
+/// \tparam other_types The remaining types of the pack.
+template <typename first_type, typename... other_types>
+struct type_at<0, first_type, other_types...>
+{
+    /// \brief The type at the index.
+    using type = first_type;
+};
+
+/// \brief Finds the position of a type within a pack of types.
+/// \tparam object_type The type to find.
+/// \tparam types The pack of types.
+/// \details The position is the number of types if the type is not found.
+template <typename object_type, typename... types>
+struct find
+{
+    /// \brief The position of the type.
+    static constexpr std::size_t value = 0;
+};
+/// \brief Finds the position of a type at the front of a pack of types.
+/// \tparam object_type The type to find.
+/// \tparam other_types The remaining types of the pack.
+template <typename object_type, typename... other_types>
+struct find<object_type, object_type, other_types...>
+{
+    /// \brief The position of the type.
+    static constexpr std::size_t value = 0;
+};
+/// \brief Finds the position of a type after the front of a pack of types.
+/// \tparam object_type The type to find.
+/// \tparam first_type The first type of the pack, which is not the type to find.
+/// \tparam other_types The remaining types of the pack.
+template <typename object_type, typename first_type, typename... other_types>
+struct find<object_type, first_type, other_types...>
+{
+    /// \brief The position of the type.
+    static constexpr std::size_t value = 1 + std::utility::variadic::find<object_type, other_types...>::value;
+};
+
+/// \brief Holds the position of a type found within a pack of types.
+/// \tparam position_value The position of the type.
+/// \tparam count_value The number of types in the pack.
+template <std::size_t position_value, std::size_t count_value>
+struct found
+{
+    /// \brief The index of the type.
+    static constexpr std::size_t value = position_value;
+};
+/// \brief Holds no position for a type missing from a pack of types.
+/// \tparam count_value The number of types in the pack.
+template <std::size_t count_value>
+struct found<count_value, count_value>
+{};
+
+/// \brief Gets the index of a type within a pack of types.
+/// \tparam object_type The type to find. A const type is found as its non-const type.
+/// \tparam types The pack of types.
+/// \details Has no value member if the type is not in the pack, so it can remove overloads from consideration.
+template <typename object_type, typename... types>
+struct index_of
+    : public std::utility::variadic::found<std::utility::variadic::find<object_type, types...>::value, sizeof...(types)>
+{};
+/// \brief Gets the index of a const type within a pack of types.
+/// \tparam object_type The type to find.
+/// \tparam types The pack of types.
+template <typename object_type, typename... types>
+struct index_of<const object_type, types...>
+    : public std::utility::variadic::index_of<object_type, types...>
+{};
+
+/// \brief Gets the largest size of a pack of types.
+/// \tparam types The pack of types.
+template <typename... types>
+struct largest_size
+{
+    /// \brief The largest size.
+    static constexpr std::size_t value = 1;
+};
+/// \brief Gets the largest size of a pack of types by comparing the first type with the remaining types.
+/// \tparam first_type The first type of the pack.
+/// \tparam other_types The remaining types of the pack.
+template <typename first_type, typename... other_types>
+struct largest_size<first_type, other_types...>
+{
+    /// \brief The largest size.
+    static constexpr std::size_t value = sizeof(first_type) > std::utility::variadic::largest_size<other_types...>::value ? sizeof(first_type) : std::utility::variadic::largest_size<other_types...>::value;
+};
+
+/// \brief Gets the largest alignment of a pack of types.
+/// \tparam types The pack of types.
+template <typename... types>
+struct largest_alignment
+{
+    /// \brief The largest alignment.
+    static constexpr std::size_t value = 1;
+};
+/// \brief Gets the largest alignment of a pack of types by comparing the first type with the remaining types.
+/// \tparam first_type The first type of the pack.
+/// \tparam other_types The remaining types of the pack.
+template <typename first_type, typename... other_types>
+struct largest_alignment<first_type, other_types...>
+{
+    /// \brief The largest alignment.
+    static constexpr std::size_t value = alignof(first_type) > std::utility::variadic::largest_alignment<other_types...>::value ? alignof(first_type) : std::utility::variadic::largest_alignment<other_types...>::value;
+};
+
+}}}
+
+#endif
\ No newline at end of file
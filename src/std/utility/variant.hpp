@@ -0,0 +1,572 @@
+/// \file std/utility/variant.hpp
+/// \brief Defines the std::variant template class and the std::visit, std::get, and std::get_if template functions.
+#ifndef STD___UTILITY___VARIANT_H
+#define STD___UTILITY___VARIANT_H
+
+// std
+#include <std/memory/construct_at.hpp>
+#include <std/stddef.hpp>
+#include <std/utility/declval.hpp>
+#include <std/utility/forward.hpp>
+#include <std/utility/move.hpp>
+#include <std/utility/remove_reference.hpp>
+#include <std/utility/variadic.hpp>
+
+namespace std {
+
+template <typename... types>
+class variant;
+
+namespace utility {
+
+/// \brief Contains all code for dispatching on the active alternative of a variant.
+namespace visitation {
+
+/// \brief Calls a visitor with an alternative, selected at runtime by its index through a table of function pointers.
+/// \tparam result_type The type returned by the visitor.
+/// \tparam visitor_type The type of the visitor.
+/// \tparam types The alternative types, which are const for const visitation.
+template <typename result_type, typename visitor_type, typename... types>
+struct jump_table
+{
+    /// \brief Calls a visitor with an alternative of a specific type.
+    /// \tparam object_type The type of the alternative.
+    /// \param[in] visitor The visitor.
+    /// \param[in] storage The storage of the alternative.
+    /// \return The result of the visitor.
+    template <typename object_type>
+    static result_type invoke(visitor_type& visitor, void* storage)
+    {
+        return visitor(*static_cast<object_type*>(storage));
+    }
+    /// \brief Calls a visitor with the alternative at an index.
+    /// \param[in] index The index of the alternative, which must be less than the number of alternatives.
+    /// \param[in] visitor The visitor.
+    /// \param[in] storage The storage of the alternative.
+    /// \return The result of the visitor.
+    /// \details The table is built at compile time, so dispatch is a single indirect call regardless of the number
+    /// of alternatives.
+    static result_type call(std::size_t index, visitor_type& visitor, void* storage)
+    {
+        static constexpr result_type (*table[])(visitor_type&, void*) = {&jump_table::invoke<types>...};
+        return table[index](visitor, storage);
+    }
+};
+
+/// \brief Gets the type returned by calling a visitor with an alternative.
+/// \tparam visitor_type The type of the visitor, which may be a reference.
+/// \tparam object_type The type of the alternative, which is const for const visitation.
+template <typename visitor_type, typename object_type>
+struct result
+{
+    /// \brief The type returned by the visitor.
+    using type = decltype(std::declval<visitor_type&>()(std::declval<object_type&>()));
+};
+
+/// \brief Destroys an alternative.
+struct destroy
+{
+    /// \brief Destroys an alternative.
+    /// \tparam object_type The type of the alternative.
+    /// \param[in] object The alternative.
+    template <typename object_type>
+    void operator()(object_type& object) const
+    {
+        std::destroy_at(&object);
+    }
+};
+/// \brief Copy-constructs an alternative into uninitialized storage.
+struct copy_construct
+{
+    /// \brief The uninitialized storage.
+    void* destination;
+    /// \brief Copy-constructs an alternative into the storage.
+    /// \tparam object_type The type of the alternative.
+    /// \param[in] object The alternative to copy.
+    template <typename object_type>
+    void operator()(const object_type& object) const
+    {
+        std::construct_at(static_cast<object_type*>(copy_construct::destination), object);
+    }
+};
+/// \brief Move-constructs an alternative into uninitialized storage.
+struct move_construct
+{
+    /// \brief The uninitialized storage.
+    void* destination;
+    /// \brief Move-constructs an alternative into the storage.
+    /// \tparam object_type The type of the alternative.
+    /// \param[in] object The alternative to move.
+    template <typename object_type>
+    void operator()(object_type& object) const
+    {
+        std::construct_at(static_cast<object_type*>(move_construct::destination), std::move(object));
+    }
+};
+/// \brief Copy-assigns an alternative to an alternative of the same type.
+struct copy_assign
+{
+    /// \brief The storage of the alternative to assign to.
+    void* destination;
+    /// \brief Copy-assigns an alternative to the destination.
+    /// \tparam object_type The type of the alternative.
+    /// \param[in] object The alternative to copy.
+    template <typename object_type>
+    void operator()(const object_type& object) const
+    {
+        *static_cast<object_type*>(copy_assign::destination) = object;
+    }
+};
+/// \brief Move-assigns an alternative to an alternative of the same type.
+struct move_assign
+{
+    /// \brief The storage of the alternative to assign to.
+    void* destination;
+    /// \brief Move-assigns an alternative to the destination.
+    /// \tparam object_type The type of the alternative.
+    /// \param[in] object The alternative to move.
+    template <typename object_type>
+    void operator()(object_type& object) const
+    {
+        *static_cast<object_type*>(move_assign::destination) = std::move(object);
+    }
+};
+/// \brief Compares an alternative with an alternative of the same type.
+struct equal
+{
+    /// \brief The storage of the alternative to compare with.
+    const void* other;
+    /// \brief Checks if an alternative is equal to the other alternative.
+    /// \tparam object_type The type of the alternative.
+    /// \param[in] object The alternative.
+    /// \return TRUE if the alternatives are equal, otherwise FALSE.
+    template <typename object_type>
+    bool operator()(const object_type& object) const
+    {
+        return object == *static_cast<const object_type*>(equal::other);
+    }
+};
+
+/// \brief Provides the free variant functions with access to a variant's storage.
+struct access
+{
+    /// \brief Gets the storage of a variant.
+    /// \tparam types The alternative types of the variant.
+    /// \param[in] variant The variant.
+    /// \return A pointer to the variant's storage.
+    template <typename... types>
+    static void* storage(std::variant<types...>& variant)
+    {
+        return variant.m_storage;
+    }
+    /// \brief Gets the storage of a variant.
+    /// \tparam types The alternative types of the variant.
+    /// \param[in] variant The variant.
+    /// \return A const pointer to the variant's storage.
+    template <typename... types>
+    static const void* storage(const std::variant<types...>& variant)
+    {
+        return variant.m_storage;
+    }
+};
+
+}}
+
+/// \brief An empty alternative, for variants that may hold nothing or whose first alternative is not
+/// default-constructible.
+struct monostate
+{
+    /// \brief Checks if this monostate is equal to another monostate.
+    /// \return TRUE, as all monostates are equal.
+    constexpr bool operator==(const std::monostate&) const
+    {
+        return true;
+    }
+    /// \brief Checks if this monostate is unequal with another monostate.
+    /// \return FALSE, as all monostates are equal.
+    constexpr bool operator!=(const std::monostate&) const
+    {
+        return false;
+    }
+};
+
+/// \brief Gets the number of alternatives of a variant type.
+/// \tparam variant_type The variant type.
+template <typename variant_type>
+struct variant_size;
+/// \brief Gets the number of alternatives of a variant type.
+/// \tparam types The alternative types of the variant.
+template <typename... types>
+struct variant_size<std::variant<types...>>
+{
+    /// \brief The number of alternatives.
+    static constexpr std::size_t value = sizeof...(types);
+};
+
+/// \brief The number of alternatives.
+template <typename... types>
+constexpr std::size_t variant_size<std::variant<types...>>::value;
+
+/// \brief Gets the type of an alternative of a variant type.
+/// \tparam index_value The index of the alternative.
+/// \tparam variant_type The variant type.
+template <std::size_t index_value, typename variant_type>
+struct variant_alternative;
+/// \brief Gets the type of an alternative of a variant type.
+/// \tparam index_value The index of the alternative.
+/// \tparam types The alternative types of the variant.
+template <std::size_t index_value, typename... types>
+struct variant_alternative<index_value, std::variant<types...>>
+{
+    /// \brief The type of the alternative.
+    using type = typename std::utility::variadic::type_at<index_value, types...>::type;
+};
+
+/// \brief A type-safe union that holds one of several alternative types.
+/// \tparam types The alternative types.
+/// \details The active alternative is stored inline, in storage sized and aligned for the largest alternative, along
+/// with a single byte index. No memory is allocated, so variants may be stored contiguously in containers (e.g.
+/// std::vector<std::variant<...>>). Operations on the active alternative dispatch through a compile-time table of
+/// function pointers rather than a chain of comparisons.
+/// \note Values are converted into a variant only when their type exactly matches an alternative.
+template <typename... types>
+class variant
+{
+    static_assert(sizeof...(types) > 0 && sizeof...(types) < 256, "A variant must have between 1 and 255 alternatives.");
+
+public:
+    // CONSTRUCTORS
+    /// \brief Constructs a new variant instance holding a default-constructed first alternative.
+    variant()
+        : m_index(0)
+    {
+        std::construct_at(static_cast<typename std::variant_alternative<0,std::variant<types...>>::type*>(static_cast<void*>(variant::m_storage)));
+    }
+    /// \brief Constructs a new variant instance holding a value.
+    /// \tparam object_type The type of the value, which must be one of the alternative types.
+    /// \tparam index_value The index of the alternative, which is deduced.
+    /// \param[in] value The value to copy or move into the variant.
+    template <typename object_type, std::size_t index_value = std::utility::variadic::index_of<typename std::remove_reference<object_type>::type, types...>::value>
+    variant(object_type&& value)
+        : m_index(index_value)
+    {
+        std::construct_at(static_cast<typename std::variant_alternative<index_value,std::variant<types...>>::type*>(static_cast<void*>(variant::m_storage)), std::forward<object_type>(value));
+    }
+    /// \brief Copy-constructs a new variant instance from another variant.
+    /// \param[in] other The other variant to copy.
+    variant(const std::variant<types...>& other)
+        : m_index(other.m_index)
+    {
+        std::utility::visitation::copy_construct operation{variant::m_storage};
+        other.visit(operation);
+    }
+    /// \brief Move-constructs a new variant instance from another variant.
+    /// \param[in] other The other variant to move. Its alternative is moved from, but remains active.
+    variant(std::variant<types...>&& other)
+        : m_index(other.m_index)
+    {
+        std::utility::visitation::move_construct operation{variant::m_storage};
+        other.visit(operation);
+    }
+    ~variant()
+    {
+        variant::destroy();
+    }
+
+    // ACCESS
+    /// \brief Gets the index of the active alternative.
+    /// \return The index of the active alternative.
+    std::size_t index() const
+    {
+        return variant::m_index;
+    }
+    /// \brief Calls a visitor with the active alternative.
+    /// \tparam visitor_type The type of the visitor, which must be callable with every alternative type and return
+    /// the same type for each.
+    /// \param[in] visitor The visitor.
+    /// \return The result of the visitor.
+    template <typename visitor_type>
+    typename std::utility::visitation::result<visitor_type,typename std::variant_alternative<0,std::variant<types...>>::type>::type visit(visitor_type&& visitor)
+    {
+        using result_type = typename std::utility::visitation::result<visitor_type,typename std::variant_alternative<0,std::variant<types...>>::type>::type;
+        return std::utility::visitation::jump_table<result_type,typename std::remove_reference<visitor_type>::type,types...>::call(variant::m_index, visitor, variant::m_storage);
+    }
+    /// \brief Calls a visitor with the active alternative.
+    /// \tparam visitor_type The type of the visitor, which must be callable with every const alternative type and
+    /// return the same type for each.
+    /// \param[in] visitor The visitor.
+    /// \return The result of the visitor.
+    template <typename visitor_type>
+    typename std::utility::visitation::result<visitor_type,const typename std::variant_alternative<0,std::variant<types...>>::type>::type visit(visitor_type&& visitor) const
+    {
+        using result_type = typename std::utility::visitation::result<visitor_type,const typename std::variant_alternative<0,std::variant<types...>>::type>::type;
+        return std::utility::visitation::jump_table<result_type,typename std::remove_reference<visitor_type>::type,const types...>::call(variant::m_index, visitor, const_cast<unsigned char*>(variant::m_storage));
+    }
+
+    // MODIFIERS
+    /// \brief Constructs a new alternative in place, destroying the active alternative.
+    /// \tparam object_type The type of the alternative to construct.
+    /// \tparam argument_types The types of the constructor arguments.
+    /// \param[in] arguments The arguments to forward to the alternative's constructor.
+    /// \return A reference to the new alternative.
+    template <typename object_type, typename... argument_types>
+    object_type& emplace(argument_types&&... arguments)
+    {
+        return variant::emplace<std::utility::variadic::index_of<object_type, types...>::value>(std::forward<argument_types>(arguments)...);
+    }
+    /// \brief Constructs a new alternative in place, destroying the active alternative.
+    /// \tparam index_value The index of the alternative to construct.
+    /// \tparam argument_types The types of the constructor arguments.
+    /// \param[in] arguments The arguments to forward to the alternative's constructor.
+    /// \return A reference to the new alternative.
+    template <std::size_t index_value, typename... argument_types>
+    typename std::variant_alternative<index_value,std::variant<types...>>::type& emplace(argument_types&&... arguments)
+    {
+        variant::destroy();
+        variant::m_index = index_value;
+        return *std::construct_at(static_cast<typename std::variant_alternative<index_value,std::variant<types...>>::type*>(static_cast<void*>(variant::m_storage)), std::forward<argument_types>(arguments)...);
+    }
+    /// \brief Assigns a value to this variant.
+    /// \tparam object_type The type of the value, which must be one of the alternative types.
+    /// \tparam index_value The index of the alternative, which is deduced.
+    /// \param[in] value The value to copy or move into the variant.
+    /// \return A reference to this variant.
+    /// \details Assigns to the active alternative if it has the same type, otherwise replaces it.
+    template <typename object_type, std::size_t index_value = std::utility::variadic::index_of<typename std::remove_reference<object_type>::type, types...>::value>
+    std::variant<types...>& operator=(object_type&& value)
+    {
+        if(variant::m_index == index_value)
+        {
+            *static_cast<typename std::variant_alternative<index_value,std::variant<types...>>::type*>(static_cast<void*>(variant::m_storage)) = std::forward<object_type>(value);
+        }
+        else
+        {
+            variant::emplace<index_value>(std::forward<object_type>(value));
+        }
+
+        return *this;
+    }
+    /// \brief Copy-assigns another variant to this variant.
+    /// \param[in] other The other variant to copy.
+    /// \return A reference to this variant.
+    /// \details Assigns to the active alternative if the other variant holds the same alternative, otherwise replaces
+    /// it.
+    std::variant<types...>& operator=(const std::variant<types...>& other)
+    {
+        if(this == &other)
+        {
+            return *this;
+        }
+
+        if(variant::m_index == other.m_index)
+        {
+            std::utility::visitation::copy_assign operation{variant::m_storage};
+            other.visit(operation);
+        }
+        else
+        {
+            variant::destroy();
+            variant::m_index = other.m_index;
+            std::utility::visitation::copy_construct operation{variant::m_storage};
+            other.visit(operation);
+        }
+
+        return *this;
+    }
+    /// \brief Move-assigns another variant to this variant.
+    /// \param[in] other The other variant to move. Its alternative is moved from, but remains active.
+    /// \return A reference to this variant.
+    std::variant<types...>& operator=(std::variant<types...>&& other)
+    {
+        if(this == &other)
+        {
+            return *this;
+        }
+
+        if(variant::m_index == other.m_index)
+        {
+            std::utility::visitation::move_assign operation{variant::m_storage};
+            other.visit(operation);
+        }
+        else
+        {
+            variant::destroy();
+            variant::m_index = other.m_index;
+            std::utility::visitation::move_construct operation{variant::m_storage};
+            other.visit(operation);
+        }
+
+        return *this;
+    }
+
+    // COMPARISON
+    /// \brief Checks if this variant is equal to another variant.
+    /// \param[in] other The other variant to compare with.
+    /// \return TRUE if both variants hold the same alternative with equal values, otherwise FALSE.
+    bool operator==(const std::variant<types...>& other) const
+    {
+        std::utility::visitation::equal operation{other.m_storage};
+        return variant::m_index == other.m_index && variant::visit(operation);
+    }
+    /// \brief Checks if this variant is unequal with another variant.
+    /// \param[in] other The other variant to compare with.
+    /// \return TRUE if the variants are unequal, otherwise FALSE.
+    bool operator!=(const std::variant<types...>& other) const
+    {
+        return !variant::operator==(other);
+    }
+
+private:
+    // DATA
+    /// \brief The storage of the active alternative.
+    alignas(std::utility::variadic::largest_alignment<types...>::value) unsigned char m_storage[std::utility::variadic::largest_size<types...>::value];
+    /// \brief The index of the active alternative.
+    uint8_t m_index;
+
+    // METHODS
+    /// \brief Destroys the active alternative.
+    void destroy()
+    {
+        std::utility::visitation::destroy operation;
+        variant::visit(operation);
+    }
+
+    // FRIENDS
+    friend struct std::utility::visitation::access;
+};
+
+/// \brief Calls a visitor with the active alternative of a variant.
+/// \tparam visitor_type The type of the visitor, which must be callable with every alternative type and return the
+/// same type for each.
+/// \tparam types The alternative types of the variant.
+/// \param[in] visitor The visitor.
+/// \param[in] variant The variant to visit.
+/// \return The result of the visitor.
+/// \details Dispatches through a compile-time table of function pointers in constant time.
+template <typename visitor_type, typename... types>
+typename std::utility::visitation::result<visitor_type,typename std::variant_alternative<0,std::variant<types...>>::type>::type visit(visitor_type&& visitor, std::variant<types...>& variant)
+{
+    return variant.visit(std::forward<visitor_type>(visitor));
+}
+/// \brief Calls a visitor with the active alternative of a const variant.
+/// \tparam visitor_type The type of the visitor, which must be callable with every const alternative type and return
+/// the same type for each.
+/// \tparam types The alternative types of the variant.
+/// \param[in] visitor The visitor.
+/// \param[in] variant The variant to visit.
+/// \return The result of the visitor.
+/// \details Dispatches through a compile-time table of function pointers in constant time.
+template <typename visitor_type, typename... types>
+typename std::utility::visitation::result<visitor_type,const typename std::variant_alternative<0,std::variant<types...>>::type>::type visit(visitor_type&& visitor, const std::variant<types...>& variant)
+{
+    return variant.visit(std::forward<visitor_type>(visitor));
+}
+
+/// \brief Checks if a variant holds an alternative of a specific type.
+/// \tparam object_type The type of the alternative.
+/// \tparam types The alternative types of the variant.
+/// \param[in] variant The variant.
+/// \return TRUE if the variant holds the alternative, otherwise FALSE.
+template <typename object_type, typename... types>
+bool holds_alternative(const std::variant<types...>& variant)
+{
+    return variant.index() == std::utility::variadic::index_of<object_type, types...>::value;
+}
+
+/// \brief Gets a pointer to the alternative at an index of a variant, if it is active.
+/// \tparam index_value The index of the alternative.
+/// \tparam types The alternative types of the variant.
+/// \param[in] variant A pointer to the variant.
+/// \return A pointer to the alternative, or nullptr if the variant is null or holds a different alternative.
+template <std::size_t index_value, typename... types>
+typename std::variant_alternative<index_value,std::variant<types...>>::type* get_if(std::variant<types...>* variant)
+{
+    if(!variant || variant->index() != index_value)
+    {
+        return nullptr;
+    }
+    return static_cast<typename std::variant_alternative<index_value,std::variant<types...>>::type*>(std::utility::visitation::access::storage(*variant));
+}
+/// \brief Gets a pointer to the alternative at an index of a const variant, if it is active.
+/// \tparam index_value The index of the alternative.
+/// \tparam types The alternative types of the variant.
+/// \param[in] variant A pointer to the variant.
+/// \return A const pointer to the alternative, or nullptr if the variant is null or holds a different alternative.
+template <std::size_t index_value, typename... types>
+const typename std::variant_alternative<index_value,std::variant<types...>>::type* get_if(const std::variant<types...>* variant)
+{
+    if(!variant || variant->index() != index_value)
+    {
+        return nullptr;
+    }
+    return static_cast<const typename std::variant_alternative<index_value,std::variant<types...>>::type*>(std::utility::visitation::access::storage(*variant));
+}
+/// \brief Gets a pointer to the alternative of a specific type of a variant, if it is active.
+/// \tparam object_type The type of the alternative.
+/// \tparam types The alternative types of the variant.
+/// \param[in] variant A pointer to the variant.
+/// \return A pointer to the alternative, or nullptr if the variant is null or holds a different alternative.
+template <typename object_type, typename... types>
+object_type* get_if(std::variant<types...>* variant)
+{
+    return std::get_if<std::utility::variadic::index_of<object_type, types...>::value>(variant);
+}
+/// \brief Gets a pointer to the alternative of a specific type of a const variant, if it is active.
+/// \tparam object_type The type of the alternative.
+/// \tparam types The alternative types of the variant.
+/// \param[in] variant A pointer to the variant.
+/// \return A const pointer to the alternative, or nullptr if the variant is null or holds a different alternative.
+template <typename object_type, typename... types>
+const object_type* get_if(const std::variant<types...>* variant)
+{
+    return std::get_if<std::utility::variadic::index_of<object_type, types...>::value>(variant);
+}
+
+/// \brief Gets the alternative at an index of a variant.
+/// \tparam index_value The index of the alternative, which must be active.
+/// \tparam types The alternative types of the variant.
+/// \param[in] variant The variant.
+/// \return A reference to the alternative.
+/// \note Use std::get_if or std::holds_alternative if the active alternative is not known.
+template <std::size_t index_value, typename... types>
+typename std::variant_alternative<index_value,std::variant<types...>>::type& get(std::variant<types...>& variant)
+{
+    return *static_cast<typename std::variant_alternative<index_value,std::variant<types...>>::type*>(std::utility::visitation::access::storage(variant));
+}
+/// \brief Gets the alternative at an index of a const variant.
+/// \tparam index_value The index of the alternative, which must be active.
+/// \tparam types The alternative types of the variant.
+/// \param[in] variant The variant.
+/// \return A const reference to the alternative.
+/// \note Use std::get_if or std::holds_alternative if the active alternative is not known.
+template <std::size_t index_value, typename... types>
+const typename std::variant_alternative<index_value,std::variant<types...>>::type& get(const std::variant<types...>& variant)
+{
+    return *static_cast<const typename std::variant_alternative<index_value,std::variant<types...>>::type*>(std::utility::visitation::access::storage(variant));
+}
+/// \brief Gets the alternative of a specific type of a variant.
+/// \tparam object_type The type of the alternative, which must be active.
+/// \tparam types The alternative types of the variant.
+/// \param[in] variant The variant.
+/// \return A reference to the alternative.
+/// \note Use std::get_if or std::holds_alternative if the active alternative is not known.
+template <typename object_type, typename... types>
+object_type& get(std::variant<types...>& variant)
+{
+    return std::get<std::utility::variadic::index_of<object_type, types...>::value>(variant);
+}
+/// \brief Gets the alternative of a specific type of a const variant.
+/// \tparam object_type The type of the alternative, which must be active.
+/// \tparam types The alternative types of the variant.
+/// \param[in] variant The variant.
+/// \return A const reference to the alternative.
+/// \note Use std::get_if or std::holds_alternative if the active alternative is not known.
+template <typename object_type, typename... types>
+const object_type& get(const std::variant<types...>& variant)
+{
+    return std::get<std::utility::variadic::index_of<object_type, types...>::value>(variant);
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,89 @@
+// std
+#include <std.hpp>
+
+// NOTE: Prints the time taken by each benchmark over the serial port.
+
+/// \brief The number of elements in the benchmarked container.
+constexpr std::size_t container_size = 256;
+/// \brief The number of elements erased by each benchmark.
+constexpr std::size_t erase_count = 64;
+/// \brief The number of times each benchmark is repeated.
+constexpr std::size_t repetitions = 20;
+
+/// \brief Fills a vector with sequential values.
+/// \param[in] vector The vector to fill.
+void fill(std::vector<uint16_t>& vector)
+{
+    vector.clear();
+    for(std::size_t i = 0; i < container_size; ++i)
+    {
+        vector.push_back(i);
+    }
+}
+
+/// \brief Benchmarks erasing a block from the middle of a vector one element at a time.
+/// \param[in] vector The vector to benchmark with.
+/// \return The total time taken, in microseconds.
+unsigned long benchmark_erase_single(std::vector<uint16_t>& vector)
+{
+    unsigned long total = 0;
+    for(std::size_t r = 0; r < repetitions; ++r)
+    {
+        fill(vector);
+        unsigned long start = micros();
+        for(std::size_t i = 0; i < erase_count; ++i)
+        {
+            vector.erase(vector.begin() + container_size / 4);
+        }
+        total += micros() - start;
+    }
+    return total;
+}
+/// \brief Benchmarks erasing a block from the middle of a vector with a single range erase.
+/// \param[in] vector The vector to benchmark with.
+/// \return The total time taken, in microseconds.
+unsigned long benchmark_erase_range(std::vector<uint16_t>& vector)
+{
+    unsigned long total = 0;
+    for(std::size_t r = 0; r < repetitions; ++r)
+    {
+        fill(vector);
+        unsigned long start = micros();
+        vector.erase(vector.begin() + container_size / 4, vector.begin() + container_size / 4 + erase_count);
+        total += micros() - start;
+    }
+    return total;
+}
+
+/// \brief Prints the result of a benchmark.
+/// \param[in] name The name of the benchmark.
+/// \param[in] time The total time taken, in microseconds.
+void print(const char* name, unsigned long time)
+{
+    Serial.print(name);
+    Serial.print(": ");
+    Serial.print(time / repetitions);
+    Serial.println(" us");
+}
+
+// Execute setup tasks.
+void setup()
+{
+    // Open serial port.
+    Serial.begin(115200);
+
+    // Wait for board initialization to settle.
+    delay(1000);
+}
+
+// Execute continuous tasks.
+void loop()
+{
+    // Run erase benchmarks.
+    std::vector<uint16_t> vector(container_size);
+    print("erase single x64", benchmark_erase_single(vector));
+    print("erase range [64)", benchmark_erase_range(vector));
+
+    // Delay between runs.
+    delay(5000);
+}
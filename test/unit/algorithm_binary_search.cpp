@@ -0,0 +1,112 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_ALGORITHM_BINARY_SEARCH
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::algorithm::binary_search {
+
+// TESTS
+/// \brief Tests the std::lower_bound and std::upper_bound functions.
+test(algorithm_binary_search, lower_upper_bound)
+{
+    // Create sorted array with duplicates.
+    std::array<int,8> array = {1, 2, 2, 2, 5, 7, 7, 9};
+
+    // Verify bounds of present values.
+    assertEqual(std::lower_bound(array.begin(), array.end(), 2), array.begin() + 1);
+    assertEqual(std::upper_bound(array.begin(), array.end(), 2), array.begin() + 4);
+    assertEqual(std::lower_bound(array.begin(), array.end(), 9), array.begin() + 7);
+
+    // Verify bounds of absent values.
+    assertEqual(std::lower_bound(array.begin(), array.end(), 6), array.begin() + 5);
+    assertEqual(std::upper_bound(array.begin(), array.end(), 6), array.begin() + 5);
+    assertEqual(std::lower_bound(array.begin(), array.end(), 0), array.begin());
+    assertEqual(std::upper_bound(array.begin(), array.end(), 10), array.end());
+}
+/// \brief Tests the std::lower_bound function with a custom comparison.
+test(algorithm_binary_search, lower_bound_compare)
+{
+    // Create array sorted in descending order.
+    int array[5] = {9, 7, 5, 3, 1};
+
+    // Verify.
+    assertEqual(std::lower_bound(array, array + 5, 5, std::greater<int>()), array + 2);
+    assertEqual(std::upper_bound(array, array + 5, 5, std::greater<int>()), array + 3);
+}
+/// \brief Tests the std::equal_range function.
+test(algorithm_binary_search, equal_range)
+{
+    // Create sorted vector with duplicates.
+    std::vector<int> vector(10);
+    int values[9] = {1, 3, 3, 3, 3, 4, 6, 6, 8};
+    vector.assign(values, values + 9);
+
+    // Verify a present value.
+    auto range = vector.begin();
+    auto result = std::equal_range(vector.begin(), vector.end(), 3);
+    assertEqual(result.first, range + 1);
+    assertEqual(result.second, range + 5);
+
+    // Verify an absent value gives an empty range at its insertion point.
+    result = std::equal_range(vector.begin(), vector.end(), 5);
+    assertEqual(result.first, range + 6);
+    assertEqual(result.second, range + 6);
+}
+/// \brief Tests the std::binary_search function.
+test(algorithm_binary_search, binary_search)
+{
+    // Create sorted array.
+    int array[6] = {2, 4, 6, 8, 10, 12};
+
+    // Verify present and absent values.
+    assertTrue(std::binary_search(array, array + 6, 2));
+    assertTrue(std::binary_search(array, array + 6, 12));
+    assertFalse(std::binary_search(array, array + 6, 7));
+    assertFalse(std::binary_search(array, array + 6, 13));
+    assertFalse(std::binary_search(array, array, 2));
+}
+/// \brief Tests the std::branchless_lower_bound function matches std::lower_bound.
+test(algorithm_binary_search, branchless_lower_bound)
+{
+    // Create sorted array with duplicates.
+    int array[20];
+    for(int i = 0; i < 20; ++i)
+    {
+        array[i] = i / 3 * 2;
+    }
+
+    // Verify every size and value, including values outside the range.
+    for(int size = 0; size <= 20; ++size)
+    {
+        for(int value = -1; value <= 14; ++value)
+        {
+            assertEqual(std::branchless_lower_bound(array, array + size, value), std::lower_bound(array, array + size, value));
+        }
+    }
+}
+
+/// \brief Tests the binary search functions with a value type that differs from the element type.
+test(algorithm_binary_search, mixed_types)
+{
+    // Create sorted arrays whose elements cannot be converted to the value type without loss.
+    uint32_t large[] = {1, 10, 3000000000u, 4000000000u};
+    double fractional[] = {0.5, 1.5, 2.5};
+
+    // Verify the elements are compared without converting them to the value type.
+    assertEqual(std::lower_bound(large, large + 4, 20u), large + 2);
+    assertEqual(std::upper_bound(large, large + 4, 10u), large + 2);
+    assertEqual(std::branchless_lower_bound(large, large + 4, 20u), large + 2);
+    assertTrue(std::binary_search(large, large + 4, 10u));
+    assertFalse(std::binary_search(fractional, fractional + 3, 1));
+    assertEqual(std::equal_range(fractional, fractional + 3, 1).first, fractional + 1);
+}
+}
+
+#endif
\ No newline at end of file
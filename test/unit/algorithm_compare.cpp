@@ -0,0 +1,144 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_ALGORITHM_COMPARE
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::algorithm::compare {
+
+// TESTS
+/// \brief Tests the std::equal function with byte-comparable ranges.
+test(algorithm_compare, equal)
+{
+    // Create two equal ranges longer than a comparison block.
+    uint8_t a[40], b[40];
+    for(uint8_t i = 0; i < 40; ++i)
+    {
+        a[i] = i;
+        b[i] = i;
+    }
+
+    // Verify the ranges are equal.
+    assertTrue(std::equal(a, a + 40, b));
+    assertTrue(std::equal(a, a + 40, b, b + 40));
+
+    // Verify a changed last element is detected.
+    b[39] = 0xFF;
+    assertFalse(std::equal(a, a + 40, b));
+
+    // Verify ranges of different sizes are unequal.
+    assertFalse(std::equal(a, a + 39, b, b + 40));
+    assertTrue(std::equal(a, a + 39, b, b + 39));
+
+    // Verify empty ranges are equal.
+    assertTrue(std::equal(a, a, b));
+}
+/// \brief Tests the std::equal function with floating point ranges.
+test(algorithm_compare, equal_float)
+{
+    // Positive and negative zero compare equal despite having different bytes.
+    float a[3] = {1.0F, 0.0F, 2.0F};
+    float b[3] = {1.0F, -0.0F, 2.0F};
+    assertTrue(std::equal(a, a + 3, b));
+}
+/// \brief Tests the std::equal function with a predicate.
+test(algorithm_compare, equal_predicate)
+{
+    // Create two ranges that differ in case.
+    const char* a = "Hello";
+    const char* b = "hELLO";
+
+    // Verify the ranges are equal ignoring case.
+    assertTrue(std::equal(a, a + 5, b, [](char x, char y) { return (x | 0x20) == (y | 0x20); }));
+    assertFalse(std::equal(a, a + 5, b));
+}
+/// \brief Tests the std::mismatch function with byte-comparable ranges.
+test(algorithm_compare, mismatch)
+{
+    // Create two ranges longer than a comparison block.
+    uint16_t a[30], b[30];
+    for(uint16_t i = 0; i < 30; ++i)
+    {
+        a[i] = i;
+        b[i] = i;
+    }
+
+    // Verify equal ranges mismatch at the end.
+    std::pair<uint16_t*,uint16_t*> result = std::mismatch(a, a + 30, b);
+    assertTrue(result.first == a + 30);
+    assertTrue(result.second == b + 30);
+
+    // Verify the first differing element is found in each position.
+    for(uint16_t i = 0; i < 30; ++i)
+    {
+        b[i] = 1000;
+        result = std::mismatch(a, a + 30, b);
+        assertTrue(result.first == a + i);
+        assertTrue(result.second == b + i);
+        b[i] = i;
+    }
+}
+/// \brief Tests the std::mismatch function with two ranges of different sizes.
+test(algorithm_compare, mismatch_sized)
+{
+    // Create a range and a shorter prefix of it.
+    int a[5] = {1, 2, 3, 4, 5};
+    int b[3] = {1, 2, 3};
+
+    // Verify the mismatch is at the end of the shorter range.
+    std::pair<int*,int*> result = std::mismatch(a, a + 5, b, b + 3);
+    assertTrue(result.first == a + 3);
+    assertTrue(result.second == b + 3);
+}
+/// \brief Tests the std::mismatch function with a predicate.
+test(algorithm_compare, mismatch_predicate)
+{
+    // Create two ranges.
+    int a[4] = {1, 2, 3, 4};
+    int b[4] = {2, 3, 3, 5};
+
+    // Find the first pair where b is not greater than a.
+    std::pair<int*,int*> result = std::mismatch(a, a + 4, b, [](int x, int y) { return x < y; });
+    assertTrue(result.first == a + 2);
+    assertTrue(result.second == b + 2);
+}
+/// \brief Tests the std::lexicographical_compare function.
+test(algorithm_compare, lexicographical_compare)
+{
+    // Create ranges.
+    uint8_t a[4] = {1, 2, 3, 4};
+    uint8_t b[4] = {1, 2, 4, 0};
+    uint8_t c[2] = {1, 2};
+
+    // Verify the first differing element decides the order.
+    assertTrue(std::lexicographical_compare(a, a + 4, b, b + 4));
+    assertFalse(std::lexicographical_compare(b, b + 4, a, a + 4));
+
+    // Verify a prefix is ordered before the longer range.
+    assertTrue(std::lexicographical_compare(c, c + 2, a, a + 4));
+    assertFalse(std::lexicographical_compare(a, a + 4, c, c + 2));
+
+    // Verify equal ranges are not ordered.
+    assertFalse(std::lexicographical_compare(a, a + 4, a, a + 4));
+}
+/// \brief Tests the std::lexicographical_compare function with a comparison function object.
+test(algorithm_compare, lexicographical_compare_compare)
+{
+    // Create ranges.
+    int a[3] = {3, 2, 1};
+    int b[3] = {3, 1, 5};
+
+    // Verify ordering with a descending comparison.
+    assertTrue(std::lexicographical_compare(a, a + 3, b, b + 3, std::greater<int>()));
+    assertFalse(std::lexicographical_compare(b, b + 3, a, a + 3, std::greater<int>()));
+}
+
+}
+
+#endif
\ No newline at end of file
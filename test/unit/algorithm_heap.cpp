@@ -0,0 +1,68 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_ALGORITHM_HEAP
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::algorithm::heap {
+
+// TESTS
+/// \brief Tests the std::make_heap function.
+test(algorithm_heap, make_heap)
+{
+    // Create array.
+    int array[9] = {5, 1, 9, 3, 7, 2, 8, 6, 4};
+
+    // Make heap.
+    std::make_heap(array, array + 9);
+
+    // Verify heap with largest first.
+    assertTrue(std::is_heap(array, array + 9));
+    assertEqual(array[0], 9);
+}
+/// \brief Tests the std::push_heap and std::pop_heap functions.
+test(algorithm_heap, push_pop_heap)
+{
+    // Push values into a heap one at a time.
+    int array[6] = {4, 1, 6, 2, 5, 3};
+    for(int size = 1; size <= 6; ++size)
+    {
+        std::push_heap(array, array + size);
+        assertTrue(std::is_heap(array, array + size));
+    }
+
+    // Pop values and verify descending order.
+    for(int size = 6; size > 0; --size)
+    {
+        std::pop_heap(array, array + size);
+        assertEqual(array[size - 1], size);
+        assertTrue(std::is_heap(array, array + size - 1));
+    }
+}
+/// \brief Tests the std::sort_heap function with a custom comparison.
+test(algorithm_heap, sort_heap_compare)
+{
+    // Create array.
+    int array[7] = {3, 7, 1, 6, 2, 5, 4};
+
+    // Make a min-heap and sort it.
+    std::make_heap(array, array + 7, std::greater<int>());
+    assertEqual(array[0], 1);
+    std::sort_heap(array, array + 7, std::greater<int>());
+
+    // Verify descending order.
+    for(int i = 0; i < 7; ++i)
+    {
+        assertEqual(array[i], 7 - i);
+    }
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_ALGORITHM_REMOVE
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::algorithm::remove {
+
+// TESTS
+/// \brief Tests the std::remove_if function.
+test(algorithm_remove, remove_if)
+{
+    // Create a range.
+    int values[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    // Remove multiples of three.
+    int* end = std::remove_if(values, values + 8, [](int value) { return value % 3 == 0; });
+
+    // Verify kept values are compacted in order.
+    int expected[6] = {1, 2, 4, 5, 7, 8};
+    assertEqual(end - values, 6);
+    for(std::size_t i = 0; i < 6; ++i)
+    {
+        assertEqual(values[i], expected[i]);
+    }
+}
+/// \brief Tests the std::remove function.
+test(algorithm_remove, remove)
+{
+    // Create a range.
+    int values[6] = {4, 1, 4, 4, 2, 4};
+
+    // Remove all fours.
+    int* end = std::remove(values, values + 6, 4);
+
+    // Verify kept values are compacted in order.
+    assertEqual(end - values, 2);
+    assertEqual(values[0], 1);
+    assertEqual(values[1], 2);
+
+    // Verify removing an absent value keeps the range.
+    assertEqual(std::remove(values, end, 9), end);
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,158 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_ALGORITHM_SORT
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::algorithm::sort {
+
+// UTILITY
+/// \brief Fills an array with pseudo-random values.
+/// \param[in] array The array to fill.
+/// \param[in] size The number of values to fill.
+/// \param[in] range The exclusive upper bound of the values.
+void fill_random(int* array, std::size_t size, int range)
+{
+    uint16_t state = 0xACE1;
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        state = state * 25173 + 13849;
+        array[i] = (state >> 4) % range;
+    }
+}
+/// \brief A value with a key to sort by, and an order to check stability with.
+struct keyed
+{
+    /// \brief The key to sort by.
+    int key;
+    /// \brief The original order of the value.
+    int order;
+};
+/// \brief Compares keyed values by key only.
+/// \param[in] a The first value.
+/// \param[in] b The second value.
+/// \return TRUE if a's key is less than b's key, otherwise FALSE.
+bool key_less(const keyed& a, const keyed& b)
+{
+    return a.key < b.key;
+}
+
+// TESTS
+/// \brief Tests the std::sort function across insertion sort and introsort sizes.
+test(algorithm_sort, sort)
+{
+    int array[100];
+    for(std::size_t size = 0; size <= 100; size += 11)
+    {
+        // Sort random values with many duplicates.
+        fill_random(array, size, 20);
+        std::sort(array, array + size);
+        assertTrue(std::is_sorted(array, array + size));
+    }
+
+    // Sort a descending range.
+    for(int i = 0; i < 100; ++i)
+    {
+        array[i] = 100 - i;
+    }
+    std::sort(array, array + 100);
+    for(int i = 0; i < 100; ++i)
+    {
+        assertEqual(array[i], i + 1);
+    }
+}
+/// \brief Tests the std::sort function with a custom comparison on a vector.
+test(algorithm_sort, sort_compare)
+{
+    // Create vector.
+    std::vector<int> vector(40);
+    for(int i = 0; i < 40; ++i)
+    {
+        vector.push_back((i * 17) % 40);
+    }
+
+    // Sort descending.
+    std::sort(vector.begin(), vector.end(), std::greater<int>());
+    assertTrue(std::is_sorted(vector.begin(), vector.end(), std::greater<int>()));
+    assertEqual(vector.front(), 39);
+    assertEqual(vector.back(), 0);
+}
+/// \brief Tests the std::stable_sort function preserves the order of equal elements.
+test(algorithm_sort, stable_sort)
+{
+    // Create values with few distinct keys.
+    int keys[60];
+    fill_random(keys, 60, 5);
+    keyed array[60];
+    for(int i = 0; i < 60; ++i)
+    {
+        array[i].key = keys[i];
+        array[i].order = i;
+    }
+
+    // Sort by key.
+    std::stable_sort(array, array + 60, key_less);
+
+    // Verify sorted by key, then by original order.
+    for(int i = 1; i < 60; ++i)
+    {
+        assertTrue(array[i - 1].key <= array[i].key);
+        if(array[i - 1].key == array[i].key)
+        {
+            assertTrue(array[i - 1].order < array[i].order);
+        }
+    }
+}
+/// \brief Tests the std::partial_sort function.
+test(algorithm_sort, partial_sort)
+{
+    // Create a permutation of 0-49.
+    int array[50];
+    for(int i = 0; i < 50; ++i)
+    {
+        array[i] = (i * 31) % 50;
+    }
+
+    // Sort the smallest ten.
+    std::partial_sort(array, array + 10, array + 50);
+
+    // Verify.
+    for(int i = 0; i < 10; ++i)
+    {
+        assertEqual(array[i], i);
+    }
+}
+/// \brief Tests the std::nth_element function selecting the median of a window.
+test(algorithm_sort, nth_element)
+{
+    int array[64];
+    for(std::size_t nth = 0; nth < 64; nth += 9)
+    {
+        // Select the nth element.
+        fill_random(array, 64, 1000);
+        int sorted[64];
+        for(std::size_t i = 0; i < 64; ++i)
+        {
+            sorted[i] = array[i];
+        }
+        std::sort(sorted, sorted + 64);
+        std::nth_element(array, array + nth, array + 64);
+
+        // Verify the element and the partitions around it.
+        assertEqual(array[nth], sorted[nth]);
+        for(std::size_t i = 0; i < 64; ++i)
+        {
+            assertTrue(i < nth ? array[i] <= array[nth] : array[i] >= array[nth]);
+        }
+    }
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -292,8 +292,8 @@ test(container_dynamic_base, erase_range)
     derived container(7);
     container.fill(5);
 
-    // Erase from indices 1-3 from the container.
-    auto next_iterator = container.erase(container.begin() + 1, container.begin() + 3);
+    // Erase indices [1, 4) from the container.
+    auto next_iterator = container.erase(container.begin() + 1, container.begin() + 4);
 
     // Validate size.
     assertEqual(container.size(), std::size_t(2));
@@ -318,8 +318,8 @@ test(container_dynamic_base, erase_range_const)
     derived container(7);
     container.fill(5);
 
-    // Erase from indices 1-3 from the container.
-    auto next_iterator = container.erase(container.cbegin() + 1, container.cbegin() + 3);
+    // Erase indices [1, 4) from the container.
+    auto next_iterator = container.erase(container.cbegin() + 1, container.cbegin() + 4);
 
     // Validate size.
     assertEqual(container.size(), std::size_t(2));
@@ -489,6 +489,58 @@ test(container_dynamic_base, operator_unequal_equal)
     // Verify operator!= returns false.
     assertFalse(container_a != container_b);
 }
+/// \brief Tests the std::container::dynamic::base::operator< function.
+test(container_dynamic_base, operator_less)
+{
+    // Create two containers with equal values.
+    derived container_a(5), container_b(5);
+    container_a.fill(container_a.capacity());
+    container_b.fill(container_b.capacity());
+
+    // Verify equal containers are not less than each other.
+    assertFalse(container_a < container_b);
+    assertFalse(container_b < container_a);
+
+    // Increase the last value of container_b.
+    *(container_b.end() - 1) = 0xFF;
+
+    // Verify the first differing value decides the order.
+    assertTrue(container_a < container_b);
+    assertFalse(container_b < container_a);
+}
+/// \brief Tests the std::container::dynamic::base::operator< function with a prefix container.
+test(container_dynamic_base, operator_less_prefix)
+{
+    // Create a container that is a prefix of another.
+    derived container_a(5), container_b(5);
+    container_a.fill(3);
+    container_b.fill(container_b.capacity());
+
+    // Verify the shorter container is ordered first.
+    assertTrue(container_a < container_b);
+    assertFalse(container_b < container_a);
+}
+/// \brief Tests the std::container::dynamic::base::operator<=, operator>, and operator>= functions.
+test(container_dynamic_base, operator_ordering)
+{
+    // Create two containers where container_a is ordered before container_b.
+    derived container_a(5), container_b(5);
+    container_a.fill(container_a.capacity());
+    container_b.fill(container_b.capacity());
+    *container_b.begin() = 1;
+
+    // Verify orderings.
+    assertTrue(container_a <= container_b);
+    assertFalse(container_a > container_b);
+    assertFalse(container_a >= container_b);
+    assertTrue(container_b > container_a);
+    assertTrue(container_b >= container_a);
+
+    // Verify orderings of equal containers.
+    derived container_c(container_a);
+    assertTrue(container_a <= container_c);
+    assertTrue(container_a >= container_c);
+}
 
 // TESTS: CAPACITY
 /// \brief Tests the std::container::dynamic::base::size function.
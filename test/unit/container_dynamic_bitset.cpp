@@ -0,0 +1,190 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_BITSET
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::bitset {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::dynamic_bitset default constructor.
+test(container_dynamic_bitset, constructor_default)
+{
+    // Create bitset.
+    std::dynamic_bitset bitset(100);
+
+    // Verify empty with capacity.
+    assertTrue(bitset.empty());
+    assertEqual(bitset.capacity(), std::size_t(100));
+}
+/// \brief Tests the std::dynamic_bitset copy constructor.
+test(container_dynamic_bitset, constructor_copy)
+{
+    // Create and populate bitset_a.
+    std::dynamic_bitset bitset_a(50);
+    bitset_a.resize(40);
+    bitset_a.set(7);
+    bitset_a.set(39);
+
+    // Copy construct bitset_b.
+    std::dynamic_bitset bitset_b(bitset_a);
+
+    // Verify equal.
+    assertEqual(bitset_b.capacity(), std::size_t(50));
+    assertTrue(bitset_b == bitset_a);
+}
+/// \brief Tests the std::dynamic_bitset move constructor.
+test(container_dynamic_bitset, constructor_move)
+{
+    // Create and populate bitset_a.
+    std::dynamic_bitset bitset_a(50);
+    bitset_a.resize(40, true);
+
+    // Move construct bitset_b.
+    std::dynamic_bitset bitset_b(std::move(bitset_a));
+
+    // Verify bitset_a was reset and bitset_b holds the bits.
+    assertTrue(bitset_a.empty());
+    assertEqual(bitset_a.capacity(), std::size_t(50));
+    assertEqual(bitset_b.size(), std::size_t(40));
+    assertTrue(bitset_b.all());
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::dynamic_bitset::push_back and pop_back functions.
+test(container_dynamic_bitset, push_pop)
+{
+    // Create bitset.
+    std::dynamic_bitset bitset(20);
+
+    // Push alternating bits until full.
+    for(std::size_t i = 0; i < 20; ++i)
+    {
+        assertTrue(bitset.push_back(i % 2 == 0));
+    }
+    assertTrue(bitset.full());
+    assertFalse(bitset.push_back(true));
+
+    // Verify contents.
+    assertEqual(bitset.count(), std::size_t(10));
+    assertTrue(bitset[18]);
+    assertFalse(bitset[19]);
+
+    // Pop a set bit and verify count.
+    bitset.pop_back();
+    bitset.pop_back();
+    assertEqual(bitset.size(), std::size_t(18));
+    assertEqual(bitset.count(), std::size_t(9));
+}
+/// \brief Tests the std::dynamic_bitset::resize function.
+test(container_dynamic_bitset, resize)
+{
+    // Create bitset.
+    std::dynamic_bitset bitset(100);
+
+    // Grow with set bits across words.
+    assertTrue(bitset.resize(5, false));
+    assertTrue(bitset.resize(70, true));
+    assertEqual(bitset.count(), std::size_t(65));
+    assertEqual(bitset.find_first(), std::size_t(5));
+
+    // Shrink and verify count.
+    assertTrue(bitset.resize(10));
+    assertEqual(bitset.count(), std::size_t(5));
+
+    // Grow with clear bits and verify the shrunk bits did not reappear.
+    assertTrue(bitset.resize(70));
+    assertEqual(bitset.count(), std::size_t(5));
+
+    // Verify capacity limit.
+    assertFalse(bitset.resize(101));
+    assertEqual(bitset.size(), std::size_t(70));
+}
+/// \brief Tests the std::dynamic_bitset::set, reset and flip functions.
+test(container_dynamic_bitset, set_reset_flip)
+{
+    // Create bitset.
+    std::dynamic_bitset bitset(40);
+    bitset.resize(35);
+
+    // Set all and verify.
+    bitset.set();
+    assertTrue(bitset.all());
+    assertEqual(bitset.count(), std::size_t(35));
+
+    // Reset one and flip all.
+    bitset.reset(34);
+    bitset.flip();
+    assertEqual(bitset.count(), std::size_t(1));
+    assertEqual(bitset.find_first(), std::size_t(34));
+
+    // Reset all.
+    bitset.reset();
+    assertTrue(bitset.none());
+}
+/// \brief Tests the std::dynamic_bitset::swap function.
+test(container_dynamic_bitset, swap)
+{
+    // Create bitsets.
+    std::dynamic_bitset bitset_a(10), bitset_b(20);
+    bitset_a.resize(5, true);
+    bitset_b.resize(15);
+
+    // Swap.
+    bitset_a.swap(bitset_b);
+
+    // Verify.
+    assertEqual(bitset_a.capacity(), std::size_t(20));
+    assertEqual(bitset_a.size(), std::size_t(15));
+    assertTrue(bitset_a.none());
+    assertEqual(bitset_b.capacity(), std::size_t(10));
+    assertTrue(bitset_b.all());
+}
+
+// TESTS: OPERATORS
+/// \brief Tests the std::dynamic_bitset bitwise and shift operators.
+test(container_dynamic_bitset, operators)
+{
+    // Create bitsets.
+    std::dynamic_bitset bitset_a(64), bitset_b(64);
+    bitset_a.resize(48);
+    bitset_b.resize(48);
+    bitset_a.set(1);
+    bitset_a.set(40);
+    bitset_b.set(40);
+    bitset_b.set(47);
+
+    // AND and verify.
+    std::dynamic_bitset result(bitset_a);
+    result &= bitset_b;
+    assertEqual(result.count(), std::size_t(1));
+    assertTrue(result[40]);
+
+    // OR and verify.
+    result = bitset_a;
+    result |= bitset_b;
+    assertEqual(result.count(), std::size_t(3));
+
+    // XOR and verify.
+    result = bitset_a;
+    result ^= bitset_b;
+    assertEqual(result.count(), std::size_t(2));
+    assertFalse(result[40]);
+
+    // Shift and verify bits beyond the size are discarded.
+    result <<= 1;
+    assertEqual(result.count(), std::size_t(1));
+    assertTrue(result[2]);
+    result >>= 2;
+    assertEqual(result.find_first(), std::size_t(0));
+}
+
+}
+
+#endif
\ No newline at end of file
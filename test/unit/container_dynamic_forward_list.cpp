@@ -0,0 +1,108 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_FORWARD_LIST
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::forward_list {
+
+/// \brief Checks if a forward list contains a sequence of values.
+/// \param[in] list The list to check.
+/// \param[in] values The expected values.
+/// \param[in] count The number of expected values.
+/// \return TRUE if the list contains the values, otherwise FALSE.
+bool equals(const std::forward_list<int>& list, const int* values, std::size_t count)
+{
+    if(list.size() != count)
+    {
+        return false;
+    }
+    for(auto entry = list.cbegin(); entry != list.cend(); ++entry)
+    {
+        if(*entry != *values++)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::forward_list copy and move constructors.
+test(container_dynamic_forward_list, constructor_copy_move)
+{
+    // Create and populate list_a.
+    std::forward_list<int> list_a(4);
+    list_a.push_front(2);
+    list_a.push_front(1);
+
+    // Copy and move construct.
+    std::forward_list<int> list_b(list_a);
+    std::forward_list<int> list_c(std::move(list_a));
+
+    // Verify contents.
+    int expected[2] = {1, 2};
+    assertTrue(equals(list_b, expected, 2));
+    assertTrue(equals(list_c, expected, 2));
+    assertTrue(list_a.empty());
+    assertEqual(list_a.capacity(), std::size_t(4));
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::forward_list::push_front and pop_front functions.
+test(container_dynamic_forward_list, push_pop)
+{
+    // Create list.
+    std::forward_list<int> list(2);
+
+    // Push until full.
+    assertTrue(list.push_front(1));
+    assertTrue(list.push_front(2));
+    assertFalse(list.push_front(3));
+    assertEqual(list.front(), 2);
+
+    // Pop and reuse.
+    list.pop_front();
+    assertEqual(list.front(), 1);
+    assertTrue(list.push_front(4));
+    assertTrue(list.full());
+}
+/// \brief Tests the std::forward_list::insert_after and erase_after functions.
+test(container_dynamic_forward_list, insert_erase_after)
+{
+    // Create list.
+    std::forward_list<int> list(8);
+
+    // Insert in order.
+    auto last = list.insert_after(list.cbefore_begin(), 1);
+    last = list.insert_after(last, 2);
+    last = list.insert_after(last, 3);
+    list.insert_after(last, 4);
+    int expected[4] = {1, 2, 3, 4};
+    assertTrue(equals(list, expected, 4));
+
+    // Erase after the first.
+    auto next = list.erase_after(list.cbegin());
+    assertEqual(*next, 3);
+    int erased[3] = {1, 3, 4};
+    assertTrue(equals(list, erased, 3));
+
+    // Erase a range.
+    list.erase_after(list.cbegin(), list.cend());
+    int remaining[1] = {1};
+    assertTrue(equals(list, remaining, 1));
+
+    // Clear.
+    list.clear();
+    assertTrue(list.empty());
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,175 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_GROWABLE_VECTOR
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::growable_vector {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::growable_vector default constructor.
+test(container_dynamic_growable_vector, constructor_default)
+{
+    // Create growable vector.
+    std::growable_vector<int> vector(4, 100);
+
+    // Verify empty with initial capacity.
+    assertTrue(vector.empty());
+    assertEqual(vector.capacity(), std::size_t(4));
+    assertEqual(vector.max_capacity(), std::size_t(100));
+}
+/// \brief Tests the std::growable_vector copy and move constructors.
+test(container_dynamic_growable_vector, constructor_copy_move)
+{
+    // Create and grow vector_a.
+    std::growable_vector<int> vector_a(2, 20);
+    vector_a.resize(5, 3);
+
+    // Copy construct vector_b.
+    std::growable_vector<int> vector_b(vector_a);
+    assertTrue(vector_b == vector_a);
+    assertEqual(vector_b.max_capacity(), std::size_t(20));
+
+    // Move construct vector_c.
+    std::growable_vector<int> vector_c(std::move(vector_a));
+    assertTrue(vector_a.empty());
+    assertTrue(vector_c == vector_b);
+    assertEqual(vector_c.max_capacity(), std::size_t(20));
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::growable_vector::push_back function growing geometrically.
+test(container_dynamic_growable_vector, push_back)
+{
+    // Create growable vector.
+    std::growable_vector<int> vector(4, 10);
+
+    // Fill the initial capacity.
+    for(int i = 0; i < 4; ++i)
+    {
+        assertTrue(vector.push_back(i));
+    }
+    assertEqual(vector.capacity(), std::size_t(4));
+
+    // Grow by 1.5x.
+    assertTrue(vector.push_back(4));
+    assertEqual(vector.capacity(), std::size_t(6));
+
+    // Grow again, clamped to the maximum capacity.
+    for(int i = 5; i < 10; ++i)
+    {
+        assertTrue(vector.push_back(i));
+    }
+    assertEqual(vector.capacity(), std::size_t(10));
+    assertTrue(vector.full());
+    assertFalse(vector.push_back(10));
+
+    // Verify contents survived relocation.
+    for(int i = 0; i < 10; ++i)
+    {
+        assertEqual(vector[i], i);
+    }
+}
+/// \brief Tests the std::growable_vector::insert function growing geometrically.
+test(container_dynamic_growable_vector, insert)
+{
+    // Create and fill growable vector.
+    std::growable_vector<int> vector(2, 4);
+    vector.push_back(1);
+    vector.push_back(3);
+
+    // Insert in the middle, forcing growth.
+    auto position = vector.insert(vector.begin() + 1, 2);
+
+    // Verify the returned position refers to the new storage.
+    assertEqual(*position, 2);
+    assertEqual(vector.capacity(), std::size_t(3));
+    assertEqual(vector[0], 1);
+    assertEqual(vector[2], 3);
+}
+/// \brief Tests the std::growable_vector::assign and resize functions.
+test(container_dynamic_growable_vector, assign_resize)
+{
+    // Create growable vector.
+    std::growable_vector<int> vector(2, 16);
+
+    // Resize beyond the current capacity.
+    assertTrue(vector.resize(7, 1));
+    assertEqual(vector.capacity(), std::size_t(7));
+
+    // Assign beyond the maximum capacity.
+    assertFalse(vector.assign(2, 17));
+    assertEqual(vector.size(), std::size_t(7));
+    assertEqual(vector.capacity(), std::size_t(7));
+
+    // Assign within the maximum capacity.
+    assertTrue(vector.assign(2, 12));
+    assertEqual(vector.size(), std::size_t(12));
+    assertEqual(vector[11], 2);
+}
+
+// TESTS: CAPACITY
+/// \brief Tests the std::growable_vector::reserve and shrink_to_fit functions.
+test(container_dynamic_growable_vector, reserve_shrink_to_fit)
+{
+    // Create growable vector.
+    std::growable_vector<int> vector(1, 50);
+    vector.push_back(5);
+
+    // Reserve and verify.
+    assertTrue(vector.reserve(40));
+    assertEqual(vector.capacity(), std::size_t(40));
+    assertFalse(vector.reserve(51));
+    assertTrue(vector.reserve(10));
+    assertEqual(vector.capacity(), std::size_t(40));
+
+    // Shrink and verify.
+    vector.push_back(6);
+    vector.shrink_to_fit();
+    assertEqual(vector.capacity(), std::size_t(2));
+    assertEqual(vector[0], 5);
+    assertEqual(vector[1], 6);
+}
+/// \brief Tests the std::growable_vector::swap function.
+test(container_dynamic_growable_vector, swap)
+{
+    // Create growable vectors.
+    std::growable_vector<int> vector_a(2, 10), vector_b(3, 20);
+    vector_a.push_back(1);
+
+    // Swap.
+    vector_a.swap(vector_b);
+
+    // Verify.
+    assertTrue(vector_a.empty());
+    assertEqual(vector_a.max_capacity(), std::size_t(20));
+    assertEqual(vector_b.size(), std::size_t(1));
+    assertEqual(vector_b.max_capacity(), std::size_t(10));
+}
+
+/// \brief Tests the std::growable_vector::try_push_back function growing.
+test(container_dynamic_growable_vector, try_push_back)
+{
+    // Create a vector that can grow to 3 objects.
+    std::growable_vector<int> vector(1, 3);
+
+    // Push past the initial capacity.
+    for(int i = 0; i < 3; ++i)
+    {
+        auto result = vector.try_push_back(i);
+        assertTrue(result.has_value());
+        assertEqual(**result, i);
+    }
+
+    // Verify pushing past the maximum capacity reports the error.
+    assertTrue(vector.try_push_back(3).error() == std::errc::no_buffer_space);
+}
+}
+
+#endif
\ No newline at end of file
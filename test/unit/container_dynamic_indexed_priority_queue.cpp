@@ -0,0 +1,122 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_INDEXED_PRIORITY_QUEUE
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::indexed_priority_queue {
+
+/// \brief A min-first indexed priority queue of integers.
+using queue = std::indexed_priority_queue<int, std::greater<int>>;
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::indexed_priority_queue copy constructor.
+test(container_dynamic_indexed_priority_queue, constructor_copy)
+{
+    // Create and populate queue_a.
+    queue queue_a(4);
+    queue::handle_type handle = queue_a.push(5);
+    queue_a.push(3);
+
+    // Copy construct queue_b.
+    queue queue_b(queue_a);
+
+    // Verify handles are valid for the copy.
+    assertEqual(queue_b.top(), 3);
+    assertEqual(queue_b[handle], 5);
+    assertTrue(queue_b.decrease_key(handle, 1));
+    assertEqual(queue_b.top(), 1);
+    assertEqual(queue_a.top(), 3);
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::indexed_priority_queue::push and pop functions.
+test(container_dynamic_indexed_priority_queue, push_pop)
+{
+    // Create queue.
+    queue queue(3);
+
+    // Push until full.
+    queue::handle_type a = queue.push(30);
+    queue::handle_type b = queue.push(10);
+    queue::handle_type c = queue.push(20);
+    assertEqual(queue.push(40), queue::npos);
+
+    // Pop in ascending order.
+    assertEqual(queue.top_handle(), b);
+    queue.pop();
+    assertFalse(queue.contains(b));
+    assertEqual(queue.top_handle(), c);
+    queue.pop();
+    assertEqual(queue.top_handle(), a);
+    queue.pop();
+    assertTrue(queue.empty());
+    assertEqual(queue.top_handle(), queue::npos);
+
+    // Verify freed slots are reused.
+    assertTrue(queue.push(1) != queue::npos);
+    assertTrue(queue.push(2) != queue::npos);
+    assertTrue(queue.push(3) != queue::npos);
+    assertTrue(queue.full());
+}
+/// \brief Tests the std::indexed_priority_queue::decrease_key and update functions.
+test(container_dynamic_indexed_priority_queue, decrease_key_update)
+{
+    // Create and populate queue.
+    queue queue(8);
+    queue::handle_type handles[6];
+    for(int i = 0; i < 6; ++i)
+    {
+        handles[i] = queue.push(10 * (i + 1));
+    }
+
+    // Decrease the last key to the top.
+    assertTrue(queue.decrease_key(handles[5], 5));
+    assertEqual(queue.top_handle(), handles[5]);
+
+    // Update the top key to the bottom.
+    assertTrue(queue.update(handles[5], 100));
+    assertEqual(queue.top_handle(), handles[0]);
+
+    // Verify pop order.
+    int expected[6] = {10, 20, 30, 40, 50, 100};
+    for(int i = 0; i < 6; ++i)
+    {
+        assertEqual(queue.top(), expected[i]);
+        queue.pop();
+    }
+}
+/// \brief Tests the std::indexed_priority_queue::erase function.
+test(container_dynamic_indexed_priority_queue, erase)
+{
+    // Create and populate queue.
+    queue queue(8);
+    queue::handle_type handles[5];
+    for(int i = 0; i < 5; ++i)
+    {
+        handles[i] = queue.push(i);
+    }
+
+    // Erase from the middle of the heap.
+    assertTrue(queue.erase(handles[2]));
+    assertFalse(queue.erase(handles[2]));
+    assertEqual(queue.size(), std::size_t(4));
+
+    // Verify pop order skips the erased value.
+    int expected[4] = {0, 1, 3, 4};
+    for(int i = 0; i < 4; ++i)
+    {
+        assertEqual(queue.top(), expected[i]);
+        queue.pop();
+    }
+}
+
+}
+
+#endif
\ No newline at end of file
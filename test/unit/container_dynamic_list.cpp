@@ -0,0 +1,172 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_LIST
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::list {
+
+/// \brief Checks if a list contains a sequence of values.
+/// \param[in] list The list to check.
+/// \param[in] values The expected values.
+/// \param[in] count The number of expected values.
+/// \return TRUE if the list contains the values, otherwise FALSE.
+bool equals(const std::list<int>& list, const int* values, std::size_t count)
+{
+    if(list.size() != count)
+    {
+        return false;
+    }
+    for(auto entry = list.cbegin(); entry != list.cend(); ++entry)
+    {
+        if(*entry != *values++)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::list copy constructor.
+test(container_dynamic_list, constructor_copy)
+{
+    // Create and populate list_a.
+    std::list<int> list_a(5);
+    list_a.push_back(1);
+    list_a.push_back(2);
+
+    // Copy construct list_b and modify list_a.
+    std::list<int> list_b(list_a);
+    list_a.front() = 10;
+
+    // Verify deep copy.
+    int expected[2] = {1, 2};
+    assertTrue(equals(list_b, expected, 2));
+    assertEqual(list_b.capacity(), std::size_t(5));
+}
+/// \brief Tests the std::list move constructor.
+test(container_dynamic_list, constructor_move)
+{
+    // Create and populate list_a.
+    std::list<int> list_a(5);
+    list_a.push_back(1);
+    list_a.push_back(2);
+    auto position = list_a.begin();
+
+    // Move construct list_b.
+    std::list<int> list_b(std::move(list_a));
+
+    // Verify list_a was reset and list_b holds the nodes, with iterators still valid.
+    assertTrue(list_a.empty());
+    assertEqual(list_a.capacity(), std::size_t(5));
+    int expected[2] = {1, 2};
+    assertTrue(equals(list_b, expected, 2));
+    assertTrue(position == list_b.begin());
+    assertTrue(++position == --list_b.end());
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::list push and pop functions.
+test(container_dynamic_list, push_pop)
+{
+    // Create list.
+    std::list<int> list(3);
+
+    // Push until full.
+    assertTrue(list.push_back(2));
+    assertTrue(list.push_front(1));
+    assertTrue(list.push_back(3));
+    assertTrue(list.full());
+    assertFalse(list.push_back(4));
+
+    // Verify order.
+    int expected[3] = {1, 2, 3};
+    assertTrue(equals(list, expected, 3));
+
+    // Pop and verify freed nodes are reused.
+    list.pop_front();
+    list.pop_back();
+    assertEqual(list.front(), 2);
+    assertEqual(list.back(), 2);
+    assertTrue(list.push_back(5));
+    assertTrue(list.push_back(6));
+    assertTrue(list.full());
+}
+/// \brief Tests the std::list::insert and erase functions.
+test(container_dynamic_list, insert_erase)
+{
+    // Create and populate list.
+    std::list<int> list(8);
+    for(int i = 0; i < 5; ++i)
+    {
+        list.push_back(i);
+    }
+    auto two = ++++list.begin();
+
+    // Insert before two and erase after it.
+    list.insert(two, 10);
+    auto next = list.erase(++std::list<int>::iterator(two));
+
+    // Verify order and that iterators remain valid.
+    int expected[5] = {0, 1, 10, 2, 4};
+    assertTrue(equals(list, expected, 5));
+    assertEqual(*two, 2);
+    assertEqual(*next, 4);
+
+    // Erase a range.
+    list.erase(list.begin(), two);
+    int remaining[2] = {2, 4};
+    assertTrue(equals(list, remaining, 2));
+
+    // Clear.
+    list.clear();
+    assertTrue(list.empty());
+}
+/// \brief Tests the std::list::splice function.
+test(container_dynamic_list, splice)
+{
+    // Create and populate list.
+    std::list<int> list(4);
+    for(int i = 1; i <= 4; ++i)
+    {
+        list.push_back(i);
+    }
+
+    // Move the first object to the back.
+    list.splice(list.cend(), list.cbegin());
+
+    // Verify order.
+    int expected[4] = {2, 3, 4, 1};
+    assertTrue(equals(list, expected, 4));
+}
+/// \brief Tests the std::list copy and move assignment operators.
+test(container_dynamic_list, operator_assign)
+{
+    // Create lists.
+    std::list<int> list_a(4);
+    list_a.push_back(7);
+    std::list<int> list_b(2);
+    std::list<int> list_c(3);
+
+    // Copy assign.
+    list_b = list_a;
+    assertTrue(list_b == list_a);
+    assertEqual(list_b.capacity(), std::size_t(4));
+
+    // Move assign.
+    list_c = std::move(list_a);
+    assertEqual(list_c.front(), 7);
+    assertTrue(list_a.empty());
+    assertTrue(list_c != list_a);
+}
+
+}
+
+#endif
\ No newline at end of file
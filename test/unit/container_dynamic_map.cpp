@@ -203,6 +203,39 @@ test(container_dynamic_map, erase_key_nonexisting)
     assertTrue(map.contains(4));
 }
 
+/// \brief Tests the std::map::get function.
+test(container_dynamic_map, get)
+{
+    // Create and populate a map.
+    std::map<uint8_t,uint8_t> map(5);
+    map.insert(1, 10);
+    map.insert(2, 20);
+
+    // Get an existing and a nonexisting key.
+    auto existing = map.get(2);
+    auto nonexisting = map.get(3);
+
+    // Verify the results.
+    assertTrue(existing.has_value());
+    assertEqual(*existing, 20);
+    assertFalse(nonexisting.has_value());
+
+    // Verify the value can be modified through the result.
+    *existing = 25;
+    assertEqual(map.find(2)->second, 25);
+}
+/// \brief Tests the std::map::get const function.
+test(container_dynamic_map, get_const)
+{
+    // Create and populate a map.
+    std::map<uint8_t,uint8_t> map(5);
+    map.insert(1, 10);
+    const std::map<uint8_t,uint8_t>& reference = map;
+
+    // Verify the results.
+    assertEqual(reference.get(1).value_or(0), 10);
+    assertEqual(reference.get(2).value_or(0), 0);
+}
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,83 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_PRIORITY_QUEUE
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::priority_queue {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::priority_queue copy and move constructors.
+test(container_dynamic_priority_queue, constructor_copy_move)
+{
+    // Create and populate priority_queue_a.
+    std::priority_queue<int> priority_queue_a(5);
+    priority_queue_a.push(2);
+    priority_queue_a.push(8);
+
+    // Copy and move construct.
+    std::priority_queue<int> priority_queue_b(priority_queue_a);
+    std::priority_queue<int> priority_queue_c(std::move(priority_queue_a));
+
+    // Verify contents.
+    assertEqual(priority_queue_b.top(), 8);
+    assertEqual(priority_queue_c.top(), 8);
+    assertEqual(priority_queue_c.size(), std::size_t(2));
+    assertTrue(priority_queue_a.empty());
+    assertEqual(priority_queue_a.capacity(), std::size_t(5));
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::priority_queue::push and pop functions.
+test(container_dynamic_priority_queue, push_pop)
+{
+    // Create priority queue.
+    std::priority_queue<int> priority_queue(4);
+
+    // Push until full.
+    assertTrue(priority_queue.push(3));
+    assertTrue(priority_queue.push(9));
+    assertTrue(priority_queue.push(1));
+    assertTrue(priority_queue.push(5));
+    assertTrue(priority_queue.full());
+    assertFalse(priority_queue.push(7));
+
+    // Pop in descending order.
+    assertEqual(priority_queue.top(), 9);
+    priority_queue.pop();
+    assertEqual(priority_queue.top(), 5);
+    priority_queue.pop();
+    assertEqual(priority_queue.top(), 3);
+    priority_queue.pop();
+    assertEqual(priority_queue.top(), 1);
+    priority_queue.pop();
+    assertTrue(priority_queue.empty());
+
+    // Verify pop on empty is safe.
+    priority_queue.pop();
+    assertTrue(priority_queue.empty());
+}
+/// \brief Tests the std::priority_queue with std::greater for earliest-first ordering.
+test(container_dynamic_priority_queue, compare_greater)
+{
+    // Create priority queue of deadlines.
+    std::priority_queue<unsigned long, std::greater<unsigned long>> priority_queue(8);
+    priority_queue.push(500);
+    priority_queue.push(100);
+    priority_queue.push(300);
+
+    // Verify earliest first.
+    assertEqual(priority_queue.top(), 100UL);
+    priority_queue.pop();
+    assertEqual(priority_queue.top(), 300UL);
+}
+
+}
+
+#endif
\ No newline at end of file
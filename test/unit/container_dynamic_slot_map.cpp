@@ -0,0 +1,116 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_SLOT_MAP
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::slot_map {
+
+/// \brief A slot map of integers.
+using map = std::slot_map<int>;
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::slot_map copy and move constructors.
+test(container_dynamic_slot_map, constructor_copy_move)
+{
+    // Create and populate map_a.
+    map map_a(4);
+    map::key_type key = map_a.insert(5);
+
+    // Copy and move construct.
+    map map_b(map_a);
+    map map_c(std::move(map_a));
+
+    // Verify keys are valid for the copies.
+    assertEqual(map_b[key], 5);
+    assertEqual(map_c[key], 5);
+    assertTrue(map_a.empty());
+    assertFalse(map_a.contains(key));
+    assertEqual(map_a.capacity(), std::size_t(4));
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::slot_map::insert and find functions.
+test(container_dynamic_slot_map, insert_find)
+{
+    // Create map.
+    map map(2);
+
+    // Insert until full.
+    map::key_type a = map.insert(10);
+    map::key_type b = map.insert(20);
+    map::key_type c = map.insert(30);
+    assertEqual(c.index, map::npos);
+    assertTrue(map.full());
+
+    // Verify lookups.
+    assertEqual(*map.find(a), 10);
+    assertEqual(*map.find(b), 20);
+    assertTrue(map.find(c) == nullptr);
+}
+/// \brief Tests the std::slot_map::erase function and stale key detection.
+test(container_dynamic_slot_map, erase)
+{
+    // Create and populate map.
+    map map(4);
+    map::key_type keys[4];
+    for(int i = 0; i < 4; ++i)
+    {
+        keys[i] = map.insert(i * 10);
+    }
+
+    // Erase from the front, which moves the last object into its place.
+    assertTrue(map.erase(keys[0]));
+    assertFalse(map.erase(keys[0]));
+    assertEqual(map.size(), std::size_t(3));
+    assertEqual(*map.begin(), 30);
+    assertEqual(map[keys[3]], 30);
+
+    // Reuse the freed slot and verify the stale key is rejected.
+    map::key_type reused = map.insert(99);
+    assertEqual(reused.index, keys[0].index);
+    assertTrue(reused != keys[0]);
+    assertTrue(map.find(keys[0]) == nullptr);
+    assertEqual(*map.find(reused), 99);
+}
+/// \brief Tests iterating a std::slot_map and recovering keys from positions.
+test(container_dynamic_slot_map, iterate)
+{
+    // Create and populate map.
+    map map(8);
+    map::key_type keys[5];
+    for(int i = 0; i < 5; ++i)
+    {
+        keys[i] = map.insert(i);
+    }
+    map.erase(keys[1]);
+    map.erase(keys[3]);
+
+    // Verify the dense storage is contiguous, and each position maps back to its key.
+    int sum = 0;
+    for(auto entry = map.begin(); entry != map.end(); ++entry)
+    {
+        sum += *entry;
+    }
+    assertEqual(sum, 0 + 2 + 4);
+    for(std::size_t position = 0; position < map.size(); ++position)
+    {
+        assertEqual(map[map.key(position)], *(map.begin() + position));
+    }
+
+    // Clear and verify all keys are invalidated.
+    map.clear();
+    assertTrue(map.empty());
+    assertFalse(map.contains(keys[0]));
+    assertFalse(map.contains(keys[4]));
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,267 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_SMALL_VECTOR
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::small_vector {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::small_vector default constructor.
+test(container_dynamic_small_vector, constructor_default)
+{
+    // Create small vector.
+    std::small_vector<int,4> vector(10);
+
+    // Verify empty on inline storage.
+    assertTrue(vector.empty());
+    assertFalse(vector.spilled());
+    assertEqual(vector.capacity(), std::size_t(4));
+    assertEqual(vector.max_capacity(), std::size_t(10));
+}
+/// \brief Tests the std::small_vector copy constructor.
+test(container_dynamic_small_vector, constructor_copy)
+{
+    // Create and spill vector_a.
+    std::small_vector<int,2> vector_a(5);
+    for(int i = 0; i < 3; ++i)
+    {
+        vector_a.push_back(i);
+    }
+
+    // Copy construct vector_b.
+    std::small_vector<int,2> vector_b(vector_a);
+
+    // Verify deep copy.
+    assertTrue(vector_b.spilled());
+    assertTrue(vector_b == vector_a);
+    assertNotEqual(vector_b.data(), vector_a.data());
+    assertEqual(vector_b.max_capacity(), std::size_t(5));
+}
+/// \brief Tests the std::small_vector move constructor.
+test(container_dynamic_small_vector, constructor_move)
+{
+    // Create an inline vector_a and a spilled vector_b.
+    std::small_vector<int,2> vector_a(5), vector_b(5);
+    vector_a.push_back(1);
+    for(int i = 0; i < 4; ++i)
+    {
+        vector_b.push_back(i);
+    }
+    const int* heap = vector_b.data();
+
+    // Move construct both.
+    std::small_vector<int,2> vector_c(std::move(vector_a));
+    std::small_vector<int,2> vector_d(std::move(vector_b));
+
+    // Verify inline objects were moved and the heap allocation was taken.
+    assertTrue(vector_a.empty());
+    assertEqual(vector_c.size(), std::size_t(1));
+    assertFalse(vector_c.spilled());
+    assertEqual(vector_c[0], 1);
+    assertTrue(vector_b.empty());
+    assertFalse(vector_b.spilled());
+    assertEqual(vector_d.data(), heap);
+    assertEqual(vector_d[3], 3);
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::small_vector::push_back function spilling to the heap.
+test(container_dynamic_small_vector, push_back)
+{
+    // Create small vector.
+    std::small_vector<int,3> vector(6);
+
+    // Fill the inline storage.
+    for(int i = 0; i < 3; ++i)
+    {
+        assertTrue(vector.push_back(i));
+    }
+    assertFalse(vector.spilled());
+
+    // Spill and fill to the maximum capacity.
+    for(int i = 3; i < 6; ++i)
+    {
+        assertTrue(vector.push_back(i));
+    }
+    assertTrue(vector.spilled());
+    assertEqual(vector.capacity(), std::size_t(6));
+    assertTrue(vector.full());
+    assertFalse(vector.push_back(6));
+
+    // Verify contents survived the spill.
+    for(int i = 0; i < 6; ++i)
+    {
+        assertEqual(vector[i], i);
+    }
+}
+/// \brief Tests the std::small_vector::insert function spilling to the heap.
+test(container_dynamic_small_vector, insert)
+{
+    // Create and fill small vector's inline storage.
+    std::small_vector<int,2> vector(4);
+    vector.push_back(1);
+    vector.push_back(3);
+
+    // Insert in the middle, forcing a spill.
+    auto position = vector.insert(vector.begin() + 1, 2);
+
+    // Verify the returned position refers to the new storage.
+    assertTrue(vector.spilled());
+    assertEqual(*position, 2);
+    assertEqual(vector.size(), std::size_t(3));
+    assertEqual(vector[0], 1);
+    assertEqual(vector[2], 3);
+
+    // Fill and verify failure at maximum capacity.
+    assertTrue(vector.insert(vector.begin(), 0) != nullptr);
+    assertTrue(vector.insert(vector.begin(), -1) == nullptr);
+}
+/// \brief Tests the std::small_vector bulk insert and append functions spilling to the heap.
+test(container_dynamic_small_vector, insert_range)
+{
+    // Create small vector.
+    std::small_vector<int,2> vector(8);
+    vector.push_back(1);
+    int source[3] = {2, 3, 4};
+
+    // Append and insert in bulk, forcing a spill.
+    assertTrue(vector.append(source, source + 3));
+    assertTrue(vector.spilled());
+    auto position = vector.insert(vector.begin() + 1, 2, 0);
+
+    // Verify contents.
+    assertEqual(*position, 0);
+    assertEqual(vector.size(), std::size_t(6));
+    assertEqual(vector[3], 2);
+    assertEqual(vector[5], 4);
+
+    // Verify insertion beyond the maximum capacity fails.
+    assertTrue(vector.insert(vector.end(), source, source + 3) == nullptr);
+}
+/// \brief Tests the std::small_vector::assign and resize functions.
+test(container_dynamic_small_vector, assign_resize)
+{
+    // Create small vector.
+    std::small_vector<int,2> vector(8);
+
+    // Resize within inline storage.
+    assertTrue(vector.resize(2, 7));
+    assertFalse(vector.spilled());
+
+    // Resize beyond inline storage.
+    assertTrue(vector.resize(5, 9));
+    assertTrue(vector.spilled());
+    assertEqual(vector[1], 7);
+    assertEqual(vector[4], 9);
+
+    // Assign beyond the maximum capacity.
+    assertFalse(vector.assign(1, 9));
+    assertEqual(vector.size(), std::size_t(5));
+
+    // Assign within the maximum capacity.
+    assertTrue(vector.assign(1, 8));
+    assertTrue(vector.full());
+}
+/// \brief Tests the std::small_vector::swap function.
+test(container_dynamic_small_vector, swap)
+{
+    // Create an inline vector_a and a spilled vector_b.
+    std::small_vector<int,2> vector_a(4), vector_b(6);
+    vector_a.push_back(1);
+    vector_b.resize(3, 2);
+
+    // Swap.
+    vector_a.swap(vector_b);
+
+    // Verify.
+    assertEqual(vector_a.size(), std::size_t(3));
+    assertTrue(vector_a.spilled());
+    assertEqual(vector_a.max_capacity(), std::size_t(6));
+    assertEqual(vector_b.size(), std::size_t(1));
+    assertFalse(vector_b.spilled());
+    assertEqual(vector_b.max_capacity(), std::size_t(4));
+    assertEqual(vector_b[0], 1);
+}
+/// \brief Tests the std::small_vector copy assignment operator.
+test(container_dynamic_small_vector, operator_assign_copy)
+{
+    // Create a spilled vector_a and a small vector_b.
+    std::small_vector<int,2> vector_a(5), vector_b(3);
+    vector_a.resize(4, 1);
+    vector_b.push_back(2);
+
+    // Copy assign.
+    vector_b = vector_a;
+
+    // Verify.
+    assertTrue(vector_b == vector_a);
+    assertEqual(vector_b.max_capacity(), std::size_t(5));
+
+    // Copy assign an inline vector back and verify the heap allocation is released.
+    std::small_vector<int,2> vector_c(5);
+    vector_c.push_back(3);
+    vector_b = vector_c;
+    assertFalse(vector_b.spilled());
+    assertEqual(vector_b[0], 3);
+}
+
+/// \brief Tests the std::small_vector::try_push_back function spilling to the heap.
+test(container_dynamic_small_vector, try_push_back)
+{
+    // Create a vector with more maximum capacity than inline storage.
+    std::small_vector<int,2> vector(3);
+
+    // Push past the inline storage.
+    for(int i = 0; i < 3; ++i)
+    {
+        auto result = vector.try_push_back(i);
+        assertTrue(result.has_value());
+        assertEqual(**result, i);
+    }
+    assertTrue(vector.spilled());
+
+    // Verify pushing past the maximum capacity reports the error.
+    assertTrue(vector.try_push_back(3).error() == std::errc::no_buffer_space);
+}
+/// \brief Tests the std::erase and std::erase_if functions on a spilled std::small_vector.
+test(container_dynamic_small_vector, erase_if)
+{
+    // Create a spilled vector.
+    std::small_vector<int,2> vector(6);
+    int values[] = {1, 2, 3, 2, 5};
+    vector.append(values, values + 5);
+
+    // Erase and verify.
+    assertEqual(std::erase(vector, 2), std::size_t(2));
+    assertEqual(std::erase_if(vector, [](int value) { return value > 4; }), std::size_t(1));
+    assertEqual(vector.size(), std::size_t(2));
+    assertEqual(vector[0], 1);
+    assertEqual(vector[1], 3);
+    assertTrue(vector.spilled());
+}
+/// \brief Tests the std::small_vector comparison operators.
+test(container_dynamic_small_vector, operator_compare)
+{
+    // Create an inline vector_a and a spilled vector_b.
+    std::small_vector<int,2> vector_a(4), vector_b(4);
+    vector_a.assign(1, 2);
+    vector_b.assign(1, 3);
+
+    // Verify.
+    assertTrue(vector_a != vector_b);
+    assertTrue(vector_a < vector_b);
+    assertTrue(vector_a <= vector_b);
+    assertTrue(vector_b > vector_a);
+    assertTrue(vector_b >= vector_a);
+    assertFalse(vector_a == vector_b);
+}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_SPARSE_SET
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::sparse_set {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::sparse_set copy and move constructors.
+test(container_dynamic_sparse_set, constructor_copy_move)
+{
+    // Create and populate set_a.
+    std::sparse_set<int> set_a(4, 100);
+    set_a.insert(42, 7);
+
+    // Copy and move construct.
+    std::sparse_set<int> set_b(set_a);
+    std::sparse_set<int> set_c(std::move(set_a));
+
+    // Verify contents.
+    assertEqual(set_b[42], 7);
+    assertEqual(set_c[42], 7);
+    assertTrue(set_a.empty());
+    assertFalse(set_a.contains(42));
+    assertEqual(set_a.id_limit(), std::size_t(100));
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::sparse_set::insert and find functions.
+test(container_dynamic_sparse_set, insert_find)
+{
+    // Create set.
+    std::sparse_set<int> set(2, 50);
+
+    // Insert, rejecting duplicates, out of range IDs, and overflow.
+    assertTrue(set.insert(10, 1));
+    assertFalse(set.insert(10, 2));
+    assertFalse(set.insert(50, 3));
+    assertTrue(set.insert(3, 4));
+    assertFalse(set.insert(4, 5));
+
+    // Verify lookups.
+    assertEqual(*set.find(10), 1);
+    assertEqual(*set.find(3), 4);
+    assertTrue(set.find(4) == nullptr);
+    assertTrue(set.find(1000) == nullptr);
+}
+/// \brief Tests the std::sparse_set::erase and clear functions.
+test(container_dynamic_sparse_set, erase_clear)
+{
+    // Create and populate set.
+    std::sparse_set<int> set(8, 64);
+    for(int id = 0; id < 5; ++id)
+    {
+        set.insert(id * 10, id);
+    }
+
+    // Erase from the front, which moves the last object into its place.
+    assertTrue(set.erase(0));
+    assertFalse(set.erase(0));
+    assertEqual(set.size(), std::size_t(4));
+    assertEqual(*set.begin(), 4);
+    assertEqual(set.id(0), std::size_t(40));
+    assertEqual(set[40], 4);
+
+    // Verify dense iteration.
+    int sum = 0;
+    for(auto entry = set.begin(); entry != set.end(); ++entry)
+    {
+        sum += *entry;
+    }
+    assertEqual(sum, 1 + 2 + 3 + 4);
+
+    // Clear and reinsert.
+    set.clear();
+    assertFalse(set.contains(40));
+    assertTrue(set.insert(40, 9));
+    assertEqual(set[40], 9);
+}
+
+}
+
+#endif
\ No newline at end of file
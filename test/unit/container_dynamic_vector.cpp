@@ -342,6 +342,91 @@ test(container_dynamic_vector, insert_over_capacity)
         assertEqual(*entry, 0);
     }
 }
+/// \brief Tests the std::vector::insert count function.
+test(container_dynamic_vector, insert_count)
+{
+    // Create a vector.
+    std::vector<uint8_t> vector(6);
+    vector.push_back(1);
+    vector.push_back(2);
+
+    // Insert copies in the middle.
+    auto position = vector.insert(vector.begin() + 1, 3, 0x12);
+
+    // Verify vector contents.
+    assertEqual(position, vector.begin() + 1);
+    assertEqual(vector.size(), std::size_t(5));
+    assertEqual(vector[0], 1);
+    assertEqual(vector[1], 0x12);
+    assertEqual(vector[3], 0x12);
+    assertEqual(vector[4], 2);
+
+    // Verify insertion over capacity fails without modifying the vector.
+    assertEqual(vector.insert(vector.begin(), 2, 0x34), nullptr);
+    assertEqual(vector.size(), std::size_t(5));
+}
+/// \brief Tests the std::vector::insert range function.
+test(container_dynamic_vector, insert_range)
+{
+    // Create a vector and a source range.
+    std::vector<uint8_t> vector(6);
+    vector.push_back(1);
+    vector.push_back(5);
+    uint8_t source[3] = {2, 3, 4};
+
+    // Insert the range in the middle.
+    auto position = vector.insert(vector.begin() + 1, source, source + 3);
+
+    // Verify vector contents.
+    assertEqual(position, vector.begin() + 1);
+    assertEqual(vector.size(), std::size_t(5));
+    for(std::size_t i = 0; i < vector.size(); ++i)
+    {
+        assertEqual(vector[i], i + 1);
+    }
+
+    // Verify insertion over capacity fails.
+    assertEqual(vector.insert(vector.end(), source, source + 2), nullptr);
+}
+/// \brief Tests the std::vector::append function.
+test(container_dynamic_vector, append)
+{
+    // Create a vector and a source range.
+    std::vector<uint8_t> vector(4);
+    vector.push_back(1);
+    uint8_t source[3] = {2, 3, 4};
+
+    // Append and verify.
+    assertTrue(vector.append(source, source + 3));
+    assertTrue(vector.full());
+    assertEqual(vector[3], 4);
+
+    // Verify appending over capacity fails.
+    assertFalse(vector.append(source, source + 1));
+}
+/// \brief Tests the std::erase_if and std::erase functions.
+test(container_dynamic_vector, erase_if)
+{
+    // Create a vector.
+    std::vector<uint8_t> vector(10);
+    for(uint8_t i = 0; i < 10; ++i)
+    {
+        vector.push_back(i);
+    }
+
+    // Erase odd values and verify.
+    assertEqual(std::erase_if(vector, [](uint8_t value) { return value % 2 == 1; }), std::size_t(5));
+    assertEqual(vector.size(), std::size_t(5));
+    for(std::size_t i = 0; i < vector.size(); ++i)
+    {
+        assertEqual(vector[i], 2 * i);
+    }
+
+    // Erase a single value and verify.
+    assertEqual(std::erase(vector, uint8_t(4)), std::size_t(1));
+    assertEqual(vector.size(), std::size_t(4));
+    assertEqual(vector[2], 6);
+}
 /// \brief Tests the std::vector::assign value function with a valid configuration.
 test(container_dynamic_vector, assign_value)
 {
@@ -521,6 +606,26 @@ test(container_dynamic_vector, resize_value_over_capacity)
     assertTrue(vector.empty());
 }
 
+/// \brief Tests the std::vector::try_push_back function.
+test(container_dynamic_vector, try_push_back)
+{
+    // Create an empty vector.
+    std::vector<uint8_t> vector(2);
+
+    // Fill the vector.
+    auto first = vector.try_push_back(1);
+    auto second = vector.try_push_back(2);
+    assertTrue(first.has_value());
+    assertTrue(second.has_value());
+    assertEqual(*first, vector.begin());
+    assertEqual(**second, 2);
+
+    // Verify pushing over capacity reports the error.
+    auto third = vector.try_push_back(3);
+    assertFalse(third.has_value());
+    assertTrue(third.error() == std::errc::no_buffer_space);
+    assertEqual(vector.size(), std::size_t(2));
+}
 }
 
 #endif
\ No newline at end of file
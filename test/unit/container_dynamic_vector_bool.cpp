@@ -0,0 +1,292 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_DYNAMIC_VECTOR_BOOL
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::dynamic::vector_bool {
+
+// UTILITY
+/// \brief Checks if a vector matches a pattern where every third value is true.
+/// \param[in] vector The vector to check.
+/// \param[in] offset The index of the first true value.
+/// \return TRUE if the vector matches the pattern, otherwise FALSE.
+bool matches_pattern(const std::vector<bool>& vector, std::size_t offset)
+{
+    for(std::size_t i = 0; i < vector.size(); ++i)
+    {
+        if(vector[i] != ((i + 3 - offset % 3) % 3 == 0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::vector<bool> default constructor.
+test(container_dynamic_vector_bool, constructor_default)
+{
+    // Create vector.
+    std::vector<bool> vector(4096);
+
+    // Verify empty with capacity.
+    assertTrue(vector.empty());
+    assertEqual(vector.capacity(), std::size_t(4096));
+}
+/// \brief Tests the std::vector<bool> copy and move constructors.
+test(container_dynamic_vector_bool, constructor_copy_move)
+{
+    // Create and populate vector_a.
+    std::vector<bool> vector_a(10);
+    vector_a.push_back(true);
+    vector_a.push_back(false);
+
+    // Copy and verify.
+    std::vector<bool> vector_b(vector_a);
+    assertTrue(vector_b == vector_a);
+
+    // Move and verify.
+    std::vector<bool> vector_c(std::move(vector_a));
+    assertTrue(vector_c == vector_b);
+    assertTrue(vector_a.empty());
+}
+
+// TESTS: ACCESS
+/// \brief Tests the std::vector<bool> element access functions.
+test(container_dynamic_vector_bool, access)
+{
+    // Create and populate vector.
+    std::vector<bool> vector(10);
+    vector.resize(5);
+
+    // Write through references.
+    vector[1] = true;
+    vector.at(2) = true;
+    vector.front() = true;
+    vector.back() = true;
+    vector.back() = vector[3];
+
+    // Verify values.
+    assertTrue(vector[0]);
+    assertTrue(vector.at(1));
+    assertTrue(vector[2]);
+    assertFalse(vector[3]);
+    assertFalse(vector.back());
+}
+/// \brief Tests iterating over a std::vector<bool>.
+test(container_dynamic_vector_bool, iterate)
+{
+    // Create and populate vector.
+    std::vector<bool> vector(40);
+    vector.resize(40);
+
+    // Set every third value through iterators.
+    for(auto entry = vector.begin(); entry < vector.end(); entry += 3)
+    {
+        *entry = true;
+    }
+
+    // Verify with const iterators.
+    std::size_t i = 0;
+    for(auto entry = vector.cbegin(); entry != vector.cend(); ++entry, ++i)
+    {
+        assertEqual(*entry, i % 3 == 0);
+    }
+    assertEqual(vector.end() - vector.begin(), std::ptrdiff_t(40));
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::vector<bool>::assign function with a value.
+test(container_dynamic_vector_bool, assign_value)
+{
+    // Create vector.
+    std::vector<bool> vector(100);
+
+    // Assign set values and verify.
+    assertTrue(vector.assign(true, 70));
+    assertEqual(vector.size(), std::size_t(70));
+    assertEqual(vector.count(), std::size_t(70));
+
+    // Assign clear values and verify.
+    assertTrue(vector.assign(false, 90));
+    assertTrue(vector.none());
+
+    // Verify capacity limit.
+    assertFalse(vector.assign(true, 101));
+}
+/// \brief Tests the std::vector<bool>::assign function with ranges.
+test(container_dynamic_vector_bool, assign_range)
+{
+    // Create source vector.
+    std::vector<bool> source(10);
+    source.assign(false, 10);
+    source[4] = true;
+
+    // Assign from the vector's range and verify.
+    std::vector<bool> vector(10);
+    assertTrue(vector.assign(source.cbegin() + 2, source.cend()));
+    assertEqual(vector.size(), std::size_t(8));
+    assertTrue(vector[2]);
+    assertEqual(vector.count(), std::size_t(1));
+
+    // Assign from a bool array and verify.
+    const bool values[3] = {true, false, true};
+    assertTrue(vector.assign(values, values + 3));
+    assertEqual(vector.size(), std::size_t(3));
+    assertTrue(vector[0]);
+    assertFalse(vector[1]);
+    assertTrue(vector[2]);
+}
+/// \brief Tests the std::vector<bool>::insert function across word boundaries.
+test(container_dynamic_vector_bool, insert)
+{
+    // Create vector with every third value set.
+    std::vector<bool> vector(100);
+    for(std::size_t i = 0; i < 70; ++i)
+    {
+        vector.push_back(i % 3 == 0);
+    }
+
+    // Insert a clear value at the front and verify the pattern shifted.
+    auto position = vector.insert(vector.cbegin(), false);
+    assertTrue(position == vector.begin());
+    assertEqual(vector.size(), std::size_t(71));
+    assertTrue(matches_pattern(vector, 1));
+
+    // Insert a set value in the middle and verify.
+    position = vector.insert(vector.cbegin() + 40, true);
+    assertTrue(*position);
+    assertEqual(vector.size(), std::size_t(72));
+    assertEqual(vector.count(), std::size_t(25));
+    assertTrue(vector[40]);
+    assertTrue(vector[41]);
+
+    // Insert at the end and verify.
+    vector.insert(vector.cend(), true);
+    assertTrue(vector.back());
+}
+/// \brief Tests the std::vector<bool>::insert function at capacity.
+test(container_dynamic_vector_bool, insert_full)
+{
+    // Create a full vector.
+    std::vector<bool> vector(5);
+    vector.assign(true, 5);
+
+    // Verify insertion fails.
+    assertTrue(vector.insert(vector.cbegin(), false) == vector.end());
+    assertEqual(vector.count(), std::size_t(5));
+}
+/// \brief Tests that the std::vector<bool>::insert function rejects positions past the end.
+test(container_dynamic_vector_bool, insert_past_end)
+{
+    // Create a vector of two values.
+    std::vector<bool> vector(8);
+    vector.assign(false, 2);
+
+    // Verify insertion past the end fails and leaves the vector unchanged.
+    assertTrue(vector.insert(vector.cbegin() + 3, true) == vector.end());
+    assertEqual(vector.size(), std::size_t(2));
+    assertTrue(vector.none());
+}
+/// \brief Tests the std::vector<bool>::erase function across word boundaries.
+test(container_dynamic_vector_bool, erase)
+{
+    // Create vector with every third value set.
+    std::vector<bool> vector(100);
+    for(std::size_t i = 0; i < 70; ++i)
+    {
+        vector.push_back(i % 3 == 0);
+    }
+
+    // Erase the front and verify the pattern shifted.
+    auto position = vector.erase(vector.cbegin());
+    assertTrue(position == vector.begin());
+    assertEqual(vector.size(), std::size_t(69));
+    assertTrue(matches_pattern(vector, 2));
+
+    // Erase the last value and verify.
+    vector.erase(vector.cend() - 1);
+    assertEqual(vector.size(), std::size_t(68));
+    assertTrue(matches_pattern(vector, 2));
+
+    // Verify erasing the end leaves the vector unchanged.
+    assertTrue(vector.erase(vector.cend()) == vector.end());
+    assertEqual(vector.size(), std::size_t(68));
+
+    // Verify erasing from an empty vector leaves it empty.
+    std::vector<bool> empty(8);
+    assertTrue(empty.erase(empty.cbegin()) == empty.end());
+    assertEqual(empty.size(), std::size_t(0));
+}
+/// \brief Tests the std::vector<bool>::erase range function across word boundaries.
+test(container_dynamic_vector_bool, erase_range)
+{
+    // Create vector with every third value set.
+    std::vector<bool> vector(100);
+    for(std::size_t i = 0; i < 70; ++i)
+    {
+        vector.push_back(i % 3 == 0);
+    }
+
+    // Erase a range spanning several words whose size is a multiple of three, and verify the pattern is kept.
+    auto position = vector.erase(vector.cbegin() + 5, vector.cbegin() + 47);
+    assertTrue(position == vector.begin() + 5);
+    assertEqual(vector.size(), std::size_t(28));
+    assertTrue(matches_pattern(vector, 0));
+
+    // Erase a range of one, and verify values after it shifted down.
+    vector.erase(vector.cbegin() + 2, vector.cbegin() + 3);
+    assertEqual(vector.size(), std::size_t(27));
+    assertTrue(vector[0]);
+    assertTrue(vector[2]);
+    assertFalse(vector[3]);
+    assertTrue(vector[5]);
+    assertEqual(vector.count(), std::size_t(10));
+
+    // Erase an empty range and the remainder.
+    vector.erase(vector.cbegin() + 1, vector.cbegin() + 1);
+    assertEqual(vector.size(), std::size_t(27));
+    vector.erase(vector.cbegin(), vector.cend());
+    assertTrue(vector.empty());
+    assertTrue(vector.none());
+}
+/// \brief Tests that the std::vector<bool>::erase range function ignores ranges outside the vector.
+test(container_dynamic_vector_bool, erase_range_invalid)
+{
+    // Create vector of four set values.
+    std::vector<bool> vector(64);
+    vector.assign(true, 4);
+
+    // Verify ranges past the end, starting at the end, and reversed leave the vector unchanged.
+    assertTrue(vector.erase(vector.cbegin(), vector.cbegin() + 6) == vector.end());
+    assertTrue(vector.erase(vector.cend(), vector.cend()) == vector.end());
+    assertTrue(vector.erase(vector.cbegin() + 3, vector.cbegin() + 1) == vector.begin() + 3);
+    assertEqual(vector.size(), std::size_t(4));
+    assertEqual(vector.count(), std::size_t(4));
+}
+/// \brief Tests the std::vector<bool>::resize function.
+test(container_dynamic_vector_bool, resize)
+{
+    // Create vector.
+    std::vector<bool> vector(4096);
+
+    // Resize with set values and verify.
+    assertTrue(vector.resize(4096, true));
+    assertTrue(vector.all());
+
+    // Shrink and grow with clear values.
+    assertTrue(vector.resize(10));
+    assertTrue(vector.resize(20));
+    assertEqual(vector.count(), std::size_t(10));
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -13,6 +13,35 @@
 namespace test::container::fixed::array {
 
 // UTILITY
+/// \brief A non-trivially copyable type that counts the copies made into it.
+struct non_trivial
+{
+    /// \brief Creates a new non_trivial instance.
+    non_trivial()
+        : value(0),
+          copies(0)
+    {}
+    /// \brief Copy-constructs a new non_trivial instance.
+    /// \param[in] other The instance to copy.
+    non_trivial(const non_trivial& other)
+        : value(other.value),
+          copies(other.copies + 1)
+    {}
+    /// \brief Copy-assigns another instance to this instance.
+    /// \param[in] other The instance to copy.
+    /// \return A reference to this instance.
+    non_trivial& operator=(const non_trivial& other)
+    {
+        non_trivial::value = other.value;
+        non_trivial::copies = other.copies + 1;
+        return *this;
+    }
+
+    /// \brief The value of the instance.
+    uint8_t value;
+    /// \brief The number of copies made into the instance.
+    uint8_t copies;
+};
 /// \brief Populates an array with incremental values.
 /// \param[in] begin The begin iterator of the array.
 /// \param[in] end The end iterator of the array.
@@ -27,6 +56,81 @@ void populate_array(std::iterator<uint8_t> begin, std::iterator<uint8_t> end, ui
     }
 }
 
+/// \brief A constexpr generator that squares an index.
+/// \param[in] index The index to square.
+/// \return The square of the index.
+constexpr uint8_t square(std::size_t index)
+{
+    return index * index;
+}
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::array brace initialization.
+test(container_fixed_array, constructor_brace)
+{
+    // Brace initialize an array.
+    std::array<uint8_t,5> array = {0, 1, 2, 3, 4};
+
+    // Verify contents of the array.
+    for(std::size_t i = 0; i < array.size(); ++i)
+    {
+        assertEqual(array[i], uint8_t(i));
+    }
+}
+/// \brief Tests the std::array value initialization with empty braces.
+test(container_fixed_array, constructor_brace_empty)
+{
+    // Value initialize an array.
+    std::array<uint8_t,5> array{};
+
+    // Verify all values were value-initialized.
+    for(std::size_t i = 0; i < array.size(); ++i)
+    {
+        assertEqual(array[i], uint8_t(0));
+    }
+}
+/// \brief Tests a std::array with no elements.
+test(container_fixed_array, constructor_zero_size)
+{
+    // Create an empty array.
+    std::array<int,0> array;
+
+    // Verify the array has no elements.
+    assertEqual(array.size(), std::size_t(0));
+    assertTrue(array.begin() == array.end());
+}
+/// \brief Tests the std::array constexpr construction and access.
+test(container_fixed_array, constexpr_access)
+{
+    // Create a constexpr array.
+    constexpr std::array<uint8_t,4> array = {10, 20, 30, 40};
+
+    // Verify compile-time access.
+    static_assert(array.size() == 4, "constexpr size failed");
+    static_assert(array[1] == 20, "constexpr operator[] failed");
+    static_assert(array.at(2) == 30, "constexpr at failed");
+    static_assert(array.front() == 10, "constexpr front failed");
+    static_assert(array.back() == 40, "constexpr back failed");
+
+    // Verify runtime access.
+    assertEqual(array[3], uint8_t(40));
+}
+/// \brief Tests the std::generate_array function.
+test(container_fixed_array, generate_array)
+{
+    // Generate a table of squares at compile time.
+    constexpr std::array<uint8_t,16> array = std::generate_array<uint8_t,16>(square);
+
+    // Verify compile-time contents.
+    static_assert(array[15] == 225, "constexpr generate_array failed");
+
+    // Verify runtime contents.
+    for(std::size_t i = 0; i < array.size(); ++i)
+    {
+        assertEqual(array[i], uint8_t(i * i));
+    }
+}
+
 // TESTS: ACCESS
 /// \brief Tests the std::array::operator[] function.
 test(container_fixed_array, bracket_operator)
@@ -242,6 +346,110 @@ test(container_fixed_array, swap)
     }
 }
 
+/// \brief Tests the std::array::fill function with a value whose bytes differ.
+test(container_fixed_array, fill_non_uniform)
+{
+    // Specify fill value.
+    const uint16_t value = 0x1234;
+
+    // Create an array larger than the unroll limit.
+    std::array<uint16_t,20> array;
+
+    // Fill array.
+    array.fill(value);
+
+    // Verify contents of the array.
+    for(auto entry = array.begin(); entry != array.end(); ++entry)
+    {
+        assertEqual(*entry, value);
+    }
+}
+/// \brief Tests the std::array::swap function with a non-trivial type.
+test(container_fixed_array, swap_non_trivial)
+{
+    // Create two arrays of non-trivial elements.
+    std::array<test::container::fixed::array::non_trivial,3> array_a, array_b;
+    for(uint8_t i = 0; i < 3; ++i)
+    {
+        array_a[i].value = i;
+        array_b[i].value = 100 + i;
+    }
+
+    // Swap the two arrays.
+    array_a.swap(array_b);
+
+    // Verify contents of both arrays.
+    for(uint8_t i = 0; i < 3; ++i)
+    {
+        assertEqual(array_a[i].value, 100 + i);
+        assertEqual(array_b[i].value, i);
+    }
+}
+/// \brief Tests the std::array::swap function with an array larger than the unroll limit.
+test(container_fixed_array, swap_large)
+{
+    // Create two arrays.
+    std::array<uint8_t,20> array_a, array_b;
+
+    // Populate A starting from 0 and B starting from 100.
+    populate_array(array_a.begin(), array_a.end(), 0);
+    populate_array(array_b.begin(), array_b.end(), 100);
+
+    // Swap the two arrays.
+    array_a.swap(array_b);
+
+    // Verify contents of both arrays.
+    for(uint8_t i = 0; i < 20; ++i)
+    {
+        assertEqual(array_a[i], 100 + i);
+        assertEqual(array_b[i], i);
+    }
+}
+/// \brief Tests the std::array::operator= function with a non-trivial type.
+test(container_fixed_array, assignment_operator_non_trivial)
+{
+    // Create an array of non-trivial elements.
+    std::array<test::container::fixed::array::non_trivial,3> array_a;
+    for(uint8_t i = 0; i < 3; ++i)
+    {
+        array_a[i].value = i;
+    }
+
+    // Copy A into B.
+    std::array<test::container::fixed::array::non_trivial,3> array_b;
+    array_b = array_a;
+
+    // Verify that each element was copied through its copy assignment operator.
+    for(uint8_t i = 0; i < 3; ++i)
+    {
+        assertEqual(array_b[i].value, i);
+        assertEqual(array_b[i].copies, 1);
+    }
+}
+/// \brief Tests the std::array::operator== and operator!= functions.
+test(container_fixed_array, equality)
+{
+    // Create two equal arrays larger than the unroll limit.
+    std::array<uint16_t,20> array_a, array_b;
+    array_a.fill(0x1234);
+    array_b.fill(0x1234);
+    assertTrue(array_a == array_b);
+    assertFalse(array_a != array_b);
+
+    // Change the last element.
+    array_b[19] = 0x1235;
+    assertFalse(array_a == array_b);
+    assertTrue(array_a != array_b);
+}
+/// \brief Tests the std::array::operator== function with floating point values.
+test(container_fixed_array, equality_float)
+{
+    // Positive and negative zero compare equal despite having different bytes.
+    std::array<float,2> array_a = {0.0F, 1.0F};
+    std::array<float,2> array_b = {-0.0F, 1.0F};
+    assertTrue(array_a == array_b);
+    assertFalse(array_a != array_b);
+}
 }
 
 #endif
\ No newline at end of file
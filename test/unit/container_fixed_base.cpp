@@ -23,7 +23,7 @@ public:
     void fill()
     {
         uint8_t i = 0;
-        for(auto entry = derived::m_begin; entry != derived::m_end; ++entry)
+        for(auto entry = derived::begin(); entry != derived::end(); ++entry)
         {
             *entry = i++;
         }
@@ -40,7 +40,7 @@ test(container_fixed_base, constructor_default)
     const std::size_t size = 5;
 
     // Create container.
-    std::container::fixed::base<uint8_t,size> container;
+    std::container::fixed::base<uint8_t,size> container{};
     
     // Verify container size.
     assertEqual(container.size(), size);
@@ -51,11 +51,23 @@ test(container_fixed_base, constructor_default)
     // Verify valid end iterator.
     assertEqual(container.end(), container.begin() + size);
 }
+/// \brief Tests the std::container::fixed::base value list constructor.
+test(container_fixed_base, constructor_values)
+{
+    // Create a container from a value for each element.
+    std::container::fixed::base<uint8_t,5> container(1, 2, 3, 4, 5);
+
+    // Verify values.
+    for(std::size_t i = 0; i < container.size(); ++i)
+    {
+        assertEqual(*(container.cbegin() + i), uint8_t(i + 1));
+    }
+}
 /// \brief Tests the std::container::fixed::base copy constructor.
 test(container_fixed_base, constructor_copy)
 {
     // Create and populate container_a.
-    std::container::fixed::base<uint8_t,5> container_a;
+    std::container::fixed::base<uint8_t,5> container_a{};
 
     // Populate container_a.
     uint8_t i = 0;
@@ -84,7 +96,7 @@ test(container_fixed_base, constructor_copy)
 test(container_fixed_base, begin)
 {
     // Create container.
-    std::container::fixed::base<uint8_t,5> container;
+    std::container::fixed::base<uint8_t,5> container{};
 
     // Verify begin points to a valid memory location.
     assertNotEqual(container.begin(), nullptr);
@@ -96,7 +108,7 @@ test(container_fixed_base, end)
     const std::size_t size = 5;
 
     // Create container.
-    std::container::fixed::base<uint8_t,size> container;
+    std::container::fixed::base<uint8_t,size> container{};
 
     // Verify end points to a valid memory location.
     assertEqual(container.end(), container.begin() + size);
@@ -105,7 +117,7 @@ test(container_fixed_base, end)
 test(container_fixed_base, cbegin)
 {
     // Create container.
-    std::container::fixed::base<uint8_t,5> container;
+    std::container::fixed::base<uint8_t,5> container{};
 
     // Verify cbegin points to a valid memory location.
     assertNotEqual(container.cbegin(), nullptr);
@@ -117,12 +129,31 @@ test(container_fixed_base, cend)
     const std::size_t size = 5;
 
     // Create container.
-    std::container::fixed::base<uint8_t,size> container;
+    std::container::fixed::base<uint8_t,size> container{};
 
     // Verify cend points to a valid memory location.
     assertEqual(container.cend(), container.cbegin() + size);
 }
 
+/// \brief Tests the std::container::fixed::base::begin const function.
+test(container_fixed_base, begin_const)
+{
+    // Create a const container.
+    const std::container::fixed::base<uint8_t,5> container(1, 2, 3, 4, 5);
+
+    // Verify begin matches cbegin.
+    assertEqual(container.begin(), container.cbegin());
+}
+/// \brief Tests the std::container::fixed::base::end const function.
+test(container_fixed_base, end_const)
+{
+    // Create a const container.
+    const std::container::fixed::base<uint8_t,5> container(1, 2, 3, 4, 5);
+
+    // Verify end matches cend.
+    assertEqual(container.end(), container.cend());
+}
+
 // TESTS: CAPACITY
 /// \brief Tests the std::container::fixed::base::size value.
 test(container_fixed_base, size)
@@ -131,7 +162,7 @@ test(container_fixed_base, size)
     const std::size_t size = 5;
 
     // Create container.
-    std::container::fixed::base<uint8_t,size> container;
+    std::container::fixed::base<uint8_t,size> container{};
     
     // Verify container size.
     assertEqual(container.size(), size);
@@ -189,6 +220,41 @@ test(container_fixed_base, operater_unequal_equal)
     assertFalse(container_a != container_b);
 }
 
+/// \brief Tests the std::container::fixed::base::operator< function.
+test(container_fixed_base, operator_less)
+{
+    // Create and populate two containers.
+    derived container_a, container_b;
+    container_a.fill();
+    container_b.fill();
+
+    // Verify equal containers are not less than each other.
+    assertFalse(container_a < container_b);
+    assertFalse(container_b < container_a);
+
+    // Increase the last value of container_b.
+    *(container_b.end() - 1) = 0xFF;
+
+    // Verify the first differing value decides the order.
+    assertTrue(container_a < container_b);
+    assertFalse(container_b < container_a);
+}
+/// \brief Tests the std::container::fixed::base::operator<=, operator>, and operator>= functions.
+test(container_fixed_base, operator_ordering)
+{
+    // Create two containers where container_a is ordered before container_b.
+    derived container_a, container_b;
+    container_a.fill();
+    container_b.fill();
+    *container_b.begin() = 0xFF;
+
+    // Verify orderings.
+    assertTrue(container_a <= container_b);
+    assertFalse(container_a > container_b);
+    assertFalse(container_a >= container_b);
+    assertTrue(container_b > container_a);
+    assertTrue(container_b >= container_a);
+}
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,186 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_FIXED_BITSET
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::fixed::bitset {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::bitset default constructor.
+test(container_fixed_bitset, constructor_default)
+{
+    // Create a bitset spanning multiple words.
+    std::bitset<70> bitset;
+
+    // Verify all bits are clear.
+    assertEqual(bitset.size(), std::size_t(70));
+    assertTrue(bitset.none());
+    assertEqual(bitset.count(), std::size_t(0));
+}
+/// \brief Tests the std::bitset value constructor.
+test(container_fixed_bitset, constructor_value)
+{
+    // Create a bitset from a value.
+    std::bitset<12> bitset(0xF0A5UL);
+
+    // Verify the value was truncated to the bitset's size.
+    // NOTE: test() calls are parenthesized to avoid expansion by AUnit's test macro.
+    assertEqual(bitset.to_ulong(), 0x0A5UL);
+    assertTrue((bitset.test)(0));
+    assertFalse((bitset.test)(1));
+    assertTrue(bitset[7]);
+}
+
+// TESTS: ACCESS
+/// \brief Tests the std::bitset::operator[] reference function.
+test(container_fixed_bitset, bracket_operator)
+{
+    // Create bitset.
+    std::bitset<40> bitset;
+
+    // Set and clear bits through references.
+    bitset[3] = true;
+    bitset[35] = true;
+    bitset[36] = bitset[35];
+    bitset[35] = false;
+
+    // Verify bits.
+    assertTrue((bitset.test)(3));
+    assertFalse((bitset.test)(35));
+    assertTrue((bitset.test)(36));
+    assertEqual(bitset.count(), std::size_t(2));
+}
+/// \brief Tests the std::bitset::all, any and none functions.
+test(container_fixed_bitset, all_any_none)
+{
+    // Create bitset.
+    std::bitset<20> bitset;
+
+    // Verify empty state.
+    assertFalse(bitset.all());
+    assertFalse(bitset.any());
+    assertTrue(bitset.none());
+
+    // Set one bit and verify.
+    bitset.set(19);
+    assertFalse(bitset.all());
+    assertTrue(bitset.any());
+    assertFalse(bitset.none());
+
+    // Set all bits and verify.
+    bitset.set();
+    assertTrue(bitset.all());
+    assertEqual(bitset.count(), std::size_t(20));
+}
+/// \brief Tests the std::bitset::find_first and find_next functions.
+test(container_fixed_bitset, find)
+{
+    // Create bitset with bits set across multiple words.
+    std::bitset<100> bitset;
+    bitset.set(5);
+    bitset.set(33);
+    bitset.set(64);
+    bitset.set(99);
+
+    // Verify iteration over set bits.
+    std::size_t expected[4] = {5, 33, 64, 99};
+    std::size_t i = 0;
+    for(auto position = bitset.find_first(); position != bitset.size(); position = bitset.find_next(position))
+    {
+        assertEqual(position, expected[i++]);
+    }
+    assertEqual(i, std::size_t(4));
+
+    // Verify search on an empty bitset.
+    bitset.reset();
+    assertEqual(bitset.find_first(), bitset.size());
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::bitset::reset and flip functions.
+test(container_fixed_bitset, reset_flip)
+{
+    // Create bitset.
+    std::bitset<10> bitset(0x3UL);
+
+    // Reset and flip individual bits.
+    bitset.reset(0);
+    bitset.flip(2);
+    assertEqual(bitset.to_ulong(), 0x6UL);
+
+    // Flip all bits and verify unused bits stay clear.
+    bitset.flip();
+    assertEqual(bitset.to_ulong(), 0x3F9UL);
+    assertEqual(bitset.count(), std::size_t(8));
+}
+
+// TESTS: OPERATORS
+/// \brief Tests the std::bitset bitwise operators.
+test(container_fixed_bitset, bitwise_operators)
+{
+    // Create bitsets.
+    std::bitset<16> bitset_a(0xFF00UL), bitset_b(0x0FF0UL);
+
+    // Verify operators.
+    assertEqual((bitset_a & bitset_b).to_ulong(), 0x0F00UL);
+    assertEqual((bitset_a | bitset_b).to_ulong(), 0xFFF0UL);
+    assertEqual((bitset_a ^ bitset_b).to_ulong(), 0xF0F0UL);
+    assertEqual((~bitset_a).to_ulong(), 0x00FFUL);
+}
+/// \brief Tests the std::bitset shift operators across word boundaries.
+test(container_fixed_bitset, shift_operators)
+{
+    // Create bitset with a bit set.
+    std::bitset<100> bitset;
+    bitset.set(3);
+    bitset.set(10);
+
+    // Shift left across words and verify.
+    bitset <<= 50;
+    assertTrue((bitset.test)(53));
+    assertTrue((bitset.test)(60));
+    assertEqual(bitset.count(), std::size_t(2));
+
+    // Shift bits past the end and verify they are discarded.
+    bitset <<= 45;
+    assertTrue((bitset.test)(98));
+    assertEqual(bitset.count(), std::size_t(1));
+
+    // Shift right and verify.
+    bitset >>= 97;
+    assertEqual(bitset.to_ulong(), 0x2UL);
+
+    // Shift by more than the size and verify.
+    assertTrue((bitset << 200).none());
+    assertTrue((bitset >> 200).none());
+}
+
+// TESTS: COMPARISON
+/// \brief Tests the std::bitset::operator== and operator!= functions.
+test(container_fixed_bitset, comparison)
+{
+    // Create bitsets.
+    std::bitset<40> bitset_a, bitset_b;
+    bitset_a.set(39);
+    bitset_b.set(39);
+
+    // Verify equal.
+    assertTrue(bitset_a == bitset_b);
+    assertFalse(bitset_a != bitset_b);
+
+    // Verify unequal.
+    bitset_b.set(0);
+    assertFalse(bitset_a == bitset_b);
+    assertTrue(bitset_a != bitset_b);
+}
+
+}
+
+#endif
\ No newline at end of file
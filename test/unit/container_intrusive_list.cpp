@@ -0,0 +1,166 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_INTRUSIVE_LIST
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::intrusive::list {
+
+/// \brief An object that can be linked into an intrusive list.
+struct task
+{
+    // CONSTRUCTORS
+    /// \brief Constructs a new unlinked task instance.
+    /// \param[in] value The task's value.
+    task(int value)
+        : value(value)
+    {}
+
+    /// \brief The task's value.
+    int value;
+    /// \brief The hook for linking the task into a list.
+    std::intrusive_list_hook hook;
+};
+
+/// \brief An intrusive list of tasks.
+using list = std::intrusive_list<task, &task::hook>;
+
+/// \brief Checks if a list contains a sequence of values.
+/// \param[in] list The list to check.
+/// \param[in] values The expected values.
+/// \param[in] count The number of expected values.
+/// \return TRUE if the list contains the values, otherwise FALSE.
+bool equals(const list& list, const int* values, std::size_t count)
+{
+    if(list.size() != count)
+    {
+        return false;
+    }
+    for(auto entry = list.cbegin(); entry != list.cend(); ++entry)
+    {
+        if(entry->value != *values++)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::intrusive_list::push_front and push_back functions.
+test(container_intrusive_list, push)
+{
+    // Create tasks and list.
+    task tasks[3] = {{1}, {2}, {3}};
+    list list;
+
+    // Link tasks.
+    list.push_back(tasks[1]);
+    list.push_back(tasks[2]);
+    list.push_front(tasks[0]);
+
+    // Verify order and linkage.
+    int expected[3] = {1, 2, 3};
+    assertTrue(equals(list, expected, 3));
+    assertEqual(list.front().value, 1);
+    assertEqual(list.back().value, 3);
+    assertTrue(tasks[1].hook.linked());
+}
+/// \brief Tests the std::intrusive_list::erase functions.
+test(container_intrusive_list, erase)
+{
+    // Create tasks and list.
+    task tasks[4] = {{1}, {2}, {3}, {4}};
+    list list;
+    for(std::size_t i = 0; i < 4; ++i)
+    {
+        list.push_back(tasks[i]);
+    }
+
+    // Erase by object and by iterator.
+    list.erase(tasks[1]);
+    auto next = list.erase(list.iterator_to(tasks[2]));
+
+    // Verify remaining order.
+    int expected[2] = {1, 4};
+    assertTrue(equals(list, expected, 2));
+    assertEqual(next->value, 4);
+    assertFalse(tasks[1].hook.linked());
+    assertFalse(tasks[2].hook.linked());
+
+    // Pop the rest.
+    list.pop_front();
+    list.pop_back();
+    assertTrue(list.empty());
+}
+/// \brief Tests the std::intrusive_list::insert function.
+test(container_intrusive_list, insert)
+{
+    // Create tasks and list.
+    task tasks[3] = {{1}, {2}, {3}};
+    list list;
+    list.push_back(tasks[0]);
+    list.push_back(tasks[2]);
+
+    // Insert in the middle.
+    auto position = list.insert(list.iterator_to(tasks[2]), tasks[1]);
+
+    // Verify order.
+    int expected[3] = {1, 2, 3};
+    assertTrue(equals(list, expected, 3));
+    assertEqual(position->value, 2);
+}
+/// \brief Tests the std::intrusive_list::splice functions.
+test(container_intrusive_list, splice)
+{
+    // Create tasks and lists.
+    task tasks[5] = {{1}, {2}, {3}, {4}, {5}};
+    list list_a;
+    list list_b;
+    list_a.push_back(tasks[0]);
+    list_a.push_back(tasks[4]);
+    list_b.push_back(tasks[1]);
+    list_b.push_back(tasks[2]);
+    list_b.push_back(tasks[3]);
+
+    // Splice one object, then the rest of list_b.
+    list_a.splice(list_a.iterator_to(tasks[4]), list_b, list_b.iterator_to(tasks[1]));
+    list_a.splice(list_a.iterator_to(tasks[4]), list_b);
+
+    // Verify order.
+    int expected[5] = {1, 2, 3, 4, 5};
+    assertTrue(equals(list_a, expected, 5));
+    assertTrue(list_b.empty());
+
+    // Move an object to the back of the same list.
+    list_a.splice(list_a.end(), list_a, list_a.begin());
+    int rotated[5] = {2, 3, 4, 5, 1};
+    assertTrue(equals(list_a, rotated, 5));
+}
+/// \brief Tests that destroying or clearing a std::intrusive_list unlinks its objects.
+test(container_intrusive_list, clear)
+{
+    // Create tasks.
+    task tasks[2] = {{1}, {2}};
+
+    // Link tasks into a list that goes out of scope.
+    {
+        list list;
+        list.push_back(tasks[0]);
+        list.push_back(tasks[1]);
+    }
+
+    // Verify unlinked.
+    assertFalse(tasks[0].hook.linked());
+    assertFalse(tasks[1].hook.linked());
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,147 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_PROGMEM_ARRAY
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::progmem::array {
+
+// UTILITY
+/// \brief A C array of bytes stored in flash.
+const uint8_t bytes[5] PROGMEM = {10, 20, 30, 40, 50};
+/// \brief A C array of words stored in flash.
+const uint16_t words[4] PROGMEM = {1000, 2000, 3000, 4000};
+/// \brief A std::array of double words stored in flash.
+const std::array<uint32_t,3> dwords PROGMEM = {100000, 200000, 300000};
+/// \brief A multi-byte structure stored in flash.
+struct calibration
+{
+    /// \brief The calibration offset.
+    int16_t offset;
+    /// \brief The calibration scale.
+    float scale;
+    /// \brief The calibration identifier.
+    uint8_t id;
+};
+/// \brief A C array of structures stored in flash.
+const calibration calibrations[2] PROGMEM = {{-5, 1.5f, 1}, {7, 0.25f, 2}};
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::progmem_array C array constructor.
+test(container_progmem_array, constructor_c_array)
+{
+    // Create a view over the flash array.
+    std::progmem_array<uint8_t,5> array(bytes);
+
+    // Verify the view points to the flash array.
+    assertEqual(array.data(), &bytes[0]);
+    assertEqual(array.size(), std::size_t(5));
+}
+/// \brief Tests the std::progmem_array std::array constructor.
+test(container_progmem_array, constructor_std_array)
+{
+    // Create a view over the flash std::array.
+    std::progmem_array<uint32_t,3> array(dwords);
+
+    // Verify the view points to the flash array.
+    assertEqual(array.data(), dwords.data());
+    assertEqual(array.size(), std::size_t(3));
+}
+
+// TESTS: ACCESS
+/// \brief Tests the std::progmem_array::operator[] function with all element sizes.
+test(container_progmem_array, bracket_operator)
+{
+    // Create views over each flash array.
+    std::progmem_array<uint8_t,5> byte_array(bytes);
+    std::progmem_array<uint16_t,4> word_array(words);
+    std::progmem_array<uint32_t,3> dword_array(dwords);
+    std::progmem_array<calibration,2> calibration_array(calibrations);
+
+    // Verify values.
+    assertEqual(byte_array[2], uint8_t(30));
+    assertEqual(word_array[3], uint16_t(4000));
+    assertEqual(dword_array[1], uint32_t(200000));
+    assertEqual(calibration_array[1].offset, int16_t(7));
+    assertEqual(calibration_array[1].scale, 0.25f);
+    assertEqual(calibration_array[1].id, uint8_t(2));
+}
+/// \brief Tests the std::progmem_array::at function.
+test(container_progmem_array, at)
+{
+    // Create view.
+    std::progmem_array<uint16_t,4> array(words);
+
+    // Verify values.
+    for(std::size_t i = 0; i < array.size(); ++i)
+    {
+        assertEqual(array.at(i), uint16_t((i + 1) * 1000));
+    }
+}
+/// \brief Tests the std::progmem_array::front and back functions.
+test(container_progmem_array, front_back)
+{
+    // Create view.
+    std::progmem_array<uint8_t,5> array(bytes);
+
+    // Verify values.
+    assertEqual(array.front(), uint8_t(10));
+    assertEqual(array.back(), uint8_t(50));
+}
+/// \brief Tests iterating over a std::progmem_array.
+test(container_progmem_array, iterate)
+{
+    // Create view.
+    std::progmem_array<uint8_t,5> array(bytes);
+
+    // Verify iterator distance.
+    assertEqual(array.end() - array.begin(), std::ptrdiff_t(5));
+
+    // Verify values with range-based for.
+    uint8_t expected = 10;
+    for(auto value : array)
+    {
+        assertEqual(value, expected);
+        expected += 10;
+    }
+}
+/// \brief Tests the std::progmem_iterator member access operator.
+test(container_progmem_array, iterator_arrow)
+{
+    // Create view.
+    std::progmem_array<calibration,2> array(calibrations);
+
+    // Verify member access through the iterator.
+    auto entry = array.begin();
+    assertEqual(entry->offset, int16_t(-5));
+    ++entry;
+    assertEqual(entry->id, uint8_t(2));
+}
+
+// TESTS: OPERATIONS
+/// \brief Tests the std::progmem_array::copy function.
+test(container_progmem_array, copy)
+{
+    // Create view.
+    std::progmem_array<uint16_t,4> array(words);
+
+    // Copy the array into RAM.
+    std::array<uint16_t,4> destination;
+    array.copy(destination);
+
+    // Verify values.
+    for(std::size_t i = 0; i < destination.size(); ++i)
+    {
+        assertEqual(destination[i], uint16_t((i + 1) * 1000));
+    }
+}
+
+}
+
+#endif
\ No newline at end of file
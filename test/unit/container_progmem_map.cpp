@@ -0,0 +1,102 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_PROGMEM_MAP
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::progmem::map {
+
+// UTILITY
+/// \brief A sorted key/value table stored in flash.
+const std::pair<uint8_t,uint16_t> table[6] PROGMEM =
+{
+    {2, 200},
+    {3, 300},
+    {5, 500},
+    {7, 700},
+    {11, 1100},
+    {13, 1300}
+};
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::progmem_map C array constructor.
+test(container_progmem_map, constructor_c_array)
+{
+    // Create a view over the table.
+    std::progmem_map<uint8_t,uint16_t> map(table);
+
+    // Verify size.
+    assertEqual(map.size(), std::size_t(6));
+    assertFalse(map.empty());
+}
+/// \brief Tests the std::progmem_map pointer/size constructor.
+test(container_progmem_map, constructor_pointer)
+{
+    // Create a view over part of the table.
+    std::progmem_map<uint8_t,uint16_t> map(table, 3);
+
+    // Verify size.
+    assertEqual(map.size(), std::size_t(3));
+
+    // Verify keys outside of the view are not found.
+    assertFalse(map.contains(7));
+}
+
+// TESTS: LOOKUP
+/// \brief Tests the std::progmem_map::find function with present keys.
+test(container_progmem_map, find)
+{
+    // Create a view over the table.
+    std::progmem_map<uint8_t,uint16_t> map(table);
+
+    // Verify each key is found with its value.
+    for(auto entry = map.begin(); entry != map.end(); ++entry)
+    {
+        auto found = map.find(entry->first);
+        assertTrue(found == entry);
+        assertEqual(found->second, uint16_t(entry->first * 100));
+    }
+}
+/// \brief Tests the std::progmem_map::find function with missing keys.
+test(container_progmem_map, find_missing)
+{
+    // Create a view over the table.
+    std::progmem_map<uint8_t,uint16_t> map(table);
+
+    // Verify missing keys return end, including keys before, between and after table keys.
+    assertTrue(map.find(0) == map.end());
+    assertTrue(map.find(4) == map.end());
+    assertTrue(map.find(12) == map.end());
+    assertTrue(map.find(255) == map.end());
+}
+/// \brief Tests the std::progmem_map::contains function.
+test(container_progmem_map, contains)
+{
+    // Create a view over the table.
+    std::progmem_map<uint8_t,uint16_t> map(table);
+
+    // Verify present and missing keys.
+    assertTrue(map.contains(2));
+    assertTrue(map.contains(13));
+    assertFalse(map.contains(6));
+}
+/// \brief Tests the std::progmem_map with an empty table.
+test(container_progmem_map, empty)
+{
+    // Create an empty view.
+    std::progmem_map<uint8_t,uint16_t> map(table, 0);
+
+    // Verify empty.
+    assertTrue(map.empty());
+    assertFalse(map.contains(2));
+}
+
+}
+
+#endif
\ No newline at end of file
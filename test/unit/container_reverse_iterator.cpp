@@ -0,0 +1,174 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_REVERSE_ITERATOR
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::reverse_iterator {
+
+// UTILITY
+/// \brief Checks if an iterator category tag is the random access category.
+/// \return TRUE.
+bool random_access(std::random_access_iterator_tag)
+{
+    return true;
+}
+/// \brief Checks if an iterator category tag is the random access category.
+/// \return FALSE.
+bool random_access(std::input_iterator_tag)
+{
+    return false;
+}
+
+// TESTS
+/// \brief Tests the std::array::rbegin and std::array::rend functions.
+test(container_reverse_iterator, array)
+{
+    // Create an array.
+    std::array<int,4> array = {1, 2, 3, 4};
+
+    // Verify values are iterated in reverse order.
+    int expected = 4;
+    for(auto entry = array.rbegin(); entry != array.rend(); ++entry)
+    {
+        assertEqual(*entry, expected--);
+    }
+    assertEqual(expected, 0);
+
+    // Verify values can be written through a reverse iterator.
+    *array.rbegin() = 40;
+    assertEqual(array[3], 40);
+
+    // Verify const reverse iterators.
+    const std::array<int,4>& constant = array;
+    assertEqual(*constant.rbegin(), 40);
+    assertEqual(*(constant.crend() - 1), 1);
+    assertEqual(constant.crend() - constant.crbegin(), 4);
+}
+/// \brief Tests the std::vector::rbegin and std::vector::rend functions.
+test(container_reverse_iterator, vector)
+{
+    // Create a vector of samples.
+    std::vector<int> vector(6);
+    int samples[6] = {5, 12, 7, 15, 3, 9};
+    for(std::size_t i = 0; i < 6; ++i)
+    {
+        vector.push_back(samples[i]);
+    }
+
+    // Find the most recent sample above 10.
+    auto entry = vector.rbegin();
+    while(entry != vector.rend() && *entry <= 10)
+    {
+        ++entry;
+    }
+    assertEqual(*entry, 15);
+
+    // Verify the base iterator points one past the found sample.
+    assertTrue(entry.base() - 1 == vector.begin() + 3);
+
+    // Verify a const vector iterates in reverse through rbegin and rend.
+    const std::vector<int>& constant = vector;
+    assertEqual(*constant.rbegin(), 9);
+    assertEqual(*(constant.rend() - 1), 5);
+    assertEqual(constant.rend() - constant.rbegin(), 6);
+
+    // Verify an empty vector has an empty reverse range.
+    std::vector<int> empty(2);
+    assertTrue(empty.crbegin() == empty.crend());
+}
+/// \brief Tests the std::reverse_iterator random access operations.
+test(container_reverse_iterator, random_access)
+{
+    // Create a range.
+    int values[5] = {1, 2, 3, 4, 5};
+    std::reverse_iterator<int*> first = std::make_reverse_iterator(values + 5);
+    std::reverse_iterator<int*> last = std::make_reverse_iterator(values);
+
+    // Verify offsets and distances.
+    assertEqual(first[0], 5);
+    assertEqual(first[4], 1);
+    assertEqual(*(first + 2), 3);
+    assertEqual(*(last - 1), 1);
+    assertEqual(last - first, 5);
+
+    // Verify ordering.
+    assertTrue(first < last);
+    assertTrue(first <= first);
+    assertTrue(last > first);
+    assertTrue(last >= last);
+
+    // Verify compound assignment and postfix operators.
+    first += 3;
+    assertEqual(*first, 2);
+    first -= 1;
+    assertEqual(*first--, 3);
+    assertEqual(*first++, 4);
+    assertEqual(*first, 3);
+}
+/// \brief Tests the std::reverse_iterator with a bidirectional iterator.
+test(container_reverse_iterator, bidirectional)
+{
+    // Create a list.
+    std::list<int> list(3);
+    list.push_back(1);
+    list.push_back(2);
+    list.push_back(3);
+
+    // Verify values are iterated in reverse order.
+    int expected = 3;
+    for(auto entry = std::make_reverse_iterator(list.end()); entry != std::make_reverse_iterator(list.begin()); ++entry)
+    {
+        assertEqual(*entry, expected--);
+    }
+    assertEqual(expected, 0);
+}
+/// \brief Tests the std::iterator_traits categories.
+test(container_reverse_iterator, iterator_traits)
+{
+    // Verify pointers and bit iterators are random access.
+    assertTrue(random_access(std::iterator_traits<int*>::iterator_category()));
+    assertTrue(random_access(std::iterator_traits<const int*>::iterator_category()));
+    assertTrue(random_access(std::iterator_traits<std::container::bits::iterator>::iterator_category()));
+    assertTrue(random_access(std::iterator_traits<std::reverse_iterator<int*>>::iterator_category()));
+
+    // Verify list iterators are not random access.
+    assertFalse(random_access(std::iterator_traits<std::list<int>::iterator>::iterator_category()));
+    assertFalse(random_access(std::iterator_traits<std::forward_list<int>::const_iterator>::iterator_category()));
+}
+/// \brief Tests the std::distance, std::advance, std::next, and std::prev functions.
+test(container_reverse_iterator, distance_advance)
+{
+    // Create a list and a range.
+    std::list<int> list(4);
+    for(int i = 0; i < 4; ++i)
+    {
+        list.push_back(i);
+    }
+    int values[4] = {0, 1, 2, 3};
+
+    // Verify distances.
+    assertEqual(std::distance(list.begin(), list.end()), 4);
+    assertEqual(std::distance(values, values + 4), 4);
+
+    // Verify advancing forwards and backwards.
+    auto entry = list.begin();
+    std::advance(entry, 3);
+    assertEqual(*entry, 3);
+    std::advance(entry, -2);
+    assertEqual(*entry, 1);
+    assertEqual(*std::next(list.begin(), 2), 2);
+    assertEqual(*std::prev(list.end()), 3);
+    assertEqual(*std::next(values), 1);
+    assertEqual(*std::prev(values + 4, 2), 2);
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,132 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_SPAN
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::span {
+
+/// \brief Sums the values in a span.
+/// \param[in] values The span of values to sum.
+/// \return The sum of the values.
+int sum(std::span<const int> values)
+{
+    int sum = 0;
+    for(auto value = values.begin(); value != values.end(); ++value)
+    {
+        sum += *value;
+    }
+    return sum;
+}
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::span C array constructor.
+test(container_span, constructor_c_array)
+{
+    // Create C array and span.
+    int array[4] = {1, 2, 3, 4};
+    std::span<int> span(array);
+
+    // Verify span views the array.
+    assertEqual(span.size(), std::size_t(4));
+    assertTrue(span.data() == array);
+    assertEqual(sum(array), 10);
+}
+/// \brief Tests the std::span std::array constructor.
+test(container_span, constructor_array)
+{
+    // Create array and spans.
+    std::array<int,3> array = {1, 2, 3};
+    std::span<int> span_a(array);
+    std::span<int,3> span_b(array);
+    const std::array<int,3>& const_array = array;
+    std::span<const int> span_c(const_array);
+
+    // Verify spans view the array.
+    assertEqual(span_a.size(), std::size_t(3));
+    assertEqual(span_b.size(), std::size_t(3));
+    assertEqual(span_c.back(), 3);
+    assertEqual(sum(array), 6);
+
+    // Verify writes through the span modify the array.
+    span_a[1] = 20;
+    assertEqual(array[1], 20);
+}
+/// \brief Tests the std::span std::vector constructor.
+test(container_span, constructor_vector)
+{
+    // Create and populate vector.
+    std::vector<int> vector(10);
+    vector.push_back(5);
+    vector.push_back(6);
+
+    // Create span.
+    std::span<int> span(vector);
+
+    // Verify span views the vector's populated elements.
+    assertEqual(span.size(), std::size_t(2));
+    assertEqual(span.front(), 5);
+    assertEqual(sum(vector), 11);
+}
+/// \brief Tests that a static-extent std::span stores only a pointer.
+test(container_span, static_extent)
+{
+    // Verify sizes.
+    static_assert(sizeof(std::span<int,4>) == sizeof(int*), "static-extent span is not pointer sized");
+    assertEqual((std::span<int,4>::extent), std::size_t(4));
+    assertEqual((std::span<int>::extent), std::dynamic_extent);
+}
+/// \brief Tests the explicit conversions from a std::vector and a dynamic-extent std::span to a static extent.
+test(container_span, static_extent_conversion)
+{
+    // Create and populate vector.
+    std::vector<int> vector(4);
+    vector.push_back(1);
+    vector.push_back(2);
+
+    // Convert to static-extent spans.
+    std::span<int,2> span_a(vector);
+    std::span<int> span_b(span_a);
+    std::span<const int,2> span_c(span_b);
+
+    // Verify.
+    assertEqual(span_a.size(), std::size_t(2));
+    assertEqual(span_b.size(), std::size_t(2));
+    assertEqual(span_c.back(), 2);
+}
+
+// TESTS: OPERATIONS
+/// \brief Tests the std::span::first, last, and subspan functions.
+test(container_span, subspan)
+{
+    // Create C array and span.
+    int array[6] = {0, 1, 2, 3, 4, 5};
+    std::span<int> span(array);
+
+    // Verify dynamic slices.
+    assertEqual(span.first(2).size(), std::size_t(2));
+    assertEqual(span.first(2).back(), 1);
+    assertEqual(span.last(2).front(), 4);
+    assertEqual(span.subspan(2, 3).size(), std::size_t(3));
+    assertEqual(span.subspan(2, 3).front(), 2);
+    assertEqual(span.subspan(4).size(), std::size_t(2));
+    assertTrue(span.subspan(10).empty());
+    assertEqual(span.first(10).size(), std::size_t(6));
+
+    // Verify static slices.
+    std::span<int,2> header = span.first<2>();
+    std::span<int,3> trailer = span.last<3>();
+    assertEqual(header[1], 1);
+    assertEqual(trailer[0], 3);
+    assertEqual(trailer.size_bytes(), sizeof(int) * 3);
+}
+
+}
+
+#endif
\ No newline at end of file
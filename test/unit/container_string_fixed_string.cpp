@@ -0,0 +1,81 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_STRING_FIXED_STRING
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::string::fixed_string {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::fixed_string constructors.
+test(container_string_fixed_string, constructor)
+{
+    // Create strings.
+    std::fixed_string<8> string_a;
+    std::fixed_string<8> string_b("hello");
+    std::fixed_string<4> string_c("hello");
+
+    // Verify contents.
+    assertTrue(string_a.empty());
+    assertEqual(string_a.capacity(), std::size_t(8));
+    assertTrue(string_b == "hello");
+    assertTrue(string_c.empty());
+}
+/// \brief Tests the std::fixed_string copy constructor.
+test(container_string_fixed_string, constructor_copy)
+{
+    // Create string_a.
+    std::fixed_string<8> string_a("hello");
+
+    // Copy construct string_b and modify string_a.
+    std::fixed_string<8> string_b(string_a);
+    string_a.clear();
+
+    // Verify string_b uses its own storage.
+    assertTrue(string_b == "hello");
+    assertTrue(string_b.data() != string_a.data());
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::fixed_string copy assignment operator.
+test(container_string_fixed_string, operator_assign)
+{
+    // Create strings.
+    std::fixed_string<8> string_a("hello");
+    std::fixed_string<8> string_b("world");
+
+    // Copy assign and modify string_a.
+    string_b = string_a;
+    string_a += '!';
+
+    // Verify string_b uses its own storage.
+    assertTrue(string_b == "hello");
+    assertTrue(string_a == "hello!");
+}
+/// \brief Tests composing a std::fixed_string from text and numbers.
+test(container_string_fixed_string, compose)
+{
+    // Create string.
+    std::fixed_string<16> string;
+
+    // Compose a message.
+    string += "t=";
+    string.append_float(21.5, 1);
+    string += ",n=";
+    string.append_integer(7);
+
+    // Verify contents.
+    assertTrue(string == "t=21.5,n=7");
+    assertTrue(string.starts_with("t="));
+    assertTrue(string.ends_with("n=7"));
+}
+
+}
+
+#endif
\ No newline at end of file
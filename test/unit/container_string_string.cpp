@@ -0,0 +1,216 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_STRING_STRING
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::string::string {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::string capacity constructor.
+test(container_string_string, constructor_capacity)
+{
+    // Create string.
+    std::string string(16);
+
+    // Verify empty, terminated, and with capacity.
+    assertTrue(string.empty());
+    assertEqual(string.capacity(), std::size_t(16));
+    assertEqual(string.c_str()[0], '\0');
+}
+/// \brief Tests the std::string copy constructor.
+test(container_string_string, constructor_copy)
+{
+    // Create string_a.
+    std::string string_a(16, "hello");
+
+    // Copy construct string_b and modify string_a.
+    std::string string_b(string_a);
+    string_a[0] = 'j';
+
+    // Verify deep copy.
+    assertTrue(string_b == "hello");
+    assertEqual(string_b.capacity(), std::size_t(16));
+}
+/// \brief Tests the std::string move constructor.
+test(container_string_string, constructor_move)
+{
+    // Create string_a.
+    std::string string_a(16, "hello");
+
+    // Move construct string_b.
+    std::string string_b(std::move(string_a));
+
+    // Verify string_a was reset and string_b holds the characters.
+    assertTrue(string_a.empty());
+    assertEqual(string_a.capacity(), std::size_t(16));
+    assertTrue(string_b == "hello");
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::string::append functions.
+test(container_string_string, append)
+{
+    // Create string.
+    std::string string(8);
+
+    // Append within capacity.
+    assertTrue(string.append("abc"));
+    assertTrue(string.push_back('d'));
+    assertTrue(string.append(2, 'e'));
+
+    // Verify an append beyond capacity fails and leaves the string unchanged.
+    assertFalse(string.append("xyz"));
+    assertTrue(string == "abcdee");
+
+    // Fill to capacity.
+    string += "fg";
+    assertTrue(string.full());
+    assertFalse(string.push_back('h'));
+    assertTrue(string == "abcdeefg");
+    assertEqual(string.c_str()[8], '\0');
+}
+/// \brief Tests the std::string numeric append functions.
+test(container_string_string, append_numeric)
+{
+    // Create string.
+    std::string string(32);
+
+    // Append integers.
+    assertTrue(string.append_integer(-42));
+    assertTrue(string.push_back(' '));
+    assertTrue(string.append_unsigned(255, 16));
+    assertTrue(string.push_back(' '));
+    assertTrue(string.append_integer(0));
+    assertTrue(string.push_back(' '));
+
+    // Append floats.
+    assertTrue(string.append_float(3.14159));
+    assertTrue(string.push_back(' '));
+    assertTrue(string.append_float(-0.05, 3));
+
+    // Verify contents.
+    assertTrue(string == "-42 ff 0 3.14 -0.050");
+}
+/// \brief Tests that the std::string numeric append functions fail without partial writes.
+test(container_string_string, append_numeric_capacity)
+{
+    // Create string.
+    std::string string(4);
+    string.append("ab");
+
+    // Verify appends that don't fit fail.
+    assertFalse(string.append_integer(-10));
+    assertFalse(string.append_float(1.5, 1));
+    assertTrue(string == "ab");
+}
+/// \brief Tests the std::string::append_float function with infinite and out of range values.
+test(container_string_string, append_float_special)
+{
+    // Create string.
+    std::string string(16);
+
+    // Append infinities.
+    assertTrue(string.append_float(1.0 / 0.0));
+    assertTrue(string.push_back(' '));
+    assertTrue(string.append_float(-1.0 / 0.0));
+    assertTrue(string == "inf -inf");
+
+    // Verify a value beyond an unsigned long fails without partial writes.
+    assertFalse(string.append_float(1e30));
+    assertFalse(string.append_float(-1e30));
+    assertTrue(string == "inf -inf");
+}
+/// \brief Tests that the std::string numeric append functions reject out of range radixes and decimals.
+test(container_string_string, append_numeric_range)
+{
+    // Create string.
+    std::string string(32);
+
+    // Verify radixes outside 2 to 36 fail.
+    assertFalse(string.append_integer(5, 0));
+    assertFalse(string.append_unsigned(5, 1));
+    assertFalse(string.append_unsigned(5, 37));
+    assertTrue(string.append_unsigned(35, 36));
+
+    // Verify more than 9 decimals fail.
+    assertFalse(string.append_float(0.5, 10));
+    assertTrue(string.push_back(' '));
+    assertTrue(string.append_float(0.5, 9));
+    assertTrue(string == "z 0.500000000");
+}
+/// \brief Tests the std::string::erase, pop_back, resize, and clear functions.
+test(container_string_string, erase)
+{
+    // Create string.
+    std::string string(16, "hello world");
+
+    // Erase the middle.
+    string.erase(5, 6);
+    assertTrue(string == "hello");
+
+    // Pop back.
+    string.pop_back();
+    assertTrue(string == "hell");
+
+    // Resize.
+    assertTrue(string.resize(6, 'o'));
+    assertTrue(string == "helloo");
+    assertTrue(string.resize(2));
+    assertTrue(string == "he");
+    assertFalse(string.resize(17));
+
+    // Clear.
+    string.clear();
+    assertTrue(string.empty());
+    assertEqual(string.c_str()[0], '\0');
+}
+/// \brief Tests the std::string copy and move assignment operators.
+test(container_string_string, operator_assign)
+{
+    // Create strings.
+    std::string string_a(16, "hello");
+    std::string string_b(4);
+    std::string string_c(8);
+
+    // Copy assign.
+    string_b = string_a;
+    assertTrue(string_b == "hello");
+    assertEqual(string_b.capacity(), std::size_t(16));
+
+    // Move assign.
+    string_c = std::move(string_a);
+    assertTrue(string_c == "hello");
+    assertTrue(string_a.empty());
+}
+
+// TESTS: OPERATIONS
+/// \brief Tests the std::string::substr and find functions.
+test(container_string_string, substr)
+{
+    // Create string.
+    std::string string(16, "key=value");
+
+    // Split at the separator.
+    std::size_t separator = string.find('=');
+    assertEqual(separator, std::size_t(3));
+    std::string_view key = string.substr(0, separator);
+    std::string_view value = string.substr(separator + 1);
+
+    // Verify views reference the string's characters.
+    assertTrue(key == std::string_view("key"));
+    assertTrue(value == std::string_view("value"));
+    assertTrue(value.data() == string.data() + 4);
+    assertEqual(string.find("val"), std::size_t(4));
+    assertEqual(string.find('x'), std::string::npos);
+}
+
+}
+
+#endif
\ No newline at end of file
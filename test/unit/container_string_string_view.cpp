@@ -0,0 +1,123 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_CONTAINER_STRING_STRING_VIEW
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::container::string::string_view {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::string_view constructors.
+test(container_string_string_view, constructor)
+{
+    // Create views.
+    std::string_view view_a;
+    std::string_view view_b("hello");
+    std::string_view view_c("hello", 3);
+
+    // Verify sizes.
+    assertTrue(view_a.empty());
+    assertEqual(view_b.size(), std::size_t(5));
+    assertEqual(view_c.size(), std::size_t(3));
+    assertEqual(view_c.back(), 'l');
+}
+
+/// \brief Tests the std::string_view container constructors.
+test(container_string_string_view, constructor_container)
+{
+    // Create containers.
+    std::array<char,3> array = {'a', 'b', 'c'};
+    std::vector<char> vector(8);
+    vector.push_back('x');
+    vector.push_back('y');
+
+    // Create views.
+    std::string_view view_a(array);
+    std::string_view view_b = vector;
+
+    // Verify contents.
+    assertTrue(view_a == std::string_view("abc"));
+    assertTrue(view_b == std::string_view("xy"));
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::string_view::remove_prefix and remove_suffix functions.
+test(container_string_string_view, remove_prefix_suffix)
+{
+    // Create view.
+    std::string_view view("[value]");
+
+    // Trim the brackets.
+    view.remove_prefix(1);
+    view.remove_suffix(1);
+
+    // Verify contents.
+    assertTrue(view == std::string_view("value"));
+}
+
+// TESTS: OPERATIONS
+/// \brief Tests the std::string_view::substr function.
+test(container_string_string_view, substr)
+{
+    // Create view.
+    std::string_view view("key=value");
+
+    // Verify substrings, including clamping past the end.
+    assertTrue(view.substr(0, 3) == std::string_view("key"));
+    assertTrue(view.substr(4) == std::string_view("value"));
+    assertTrue(view.substr(4, 100) == std::string_view("value"));
+    assertTrue(view.substr(100).empty());
+}
+/// \brief Tests the std::string_view::first and last functions.
+test(container_string_string_view, first_last)
+{
+    // Create view.
+    std::string_view view("header:body");
+
+    // Verify slices, including clamping past the end.
+    assertTrue(view.first(6) == std::string_view("header"));
+    assertTrue(view.last(4) == std::string_view("body"));
+    assertTrue(view.first(100) == view);
+    assertTrue(view.last(100) == view);
+}
+/// \brief Tests the std::string_view::compare, starts_with, and ends_with functions.
+test(container_string_string_view, compare)
+{
+    // Create view.
+    std::string_view view("abc");
+
+    // Verify comparisons.
+    assertEqual(view.compare("abc"), 0);
+    assertTrue(view.compare("abd") < 0);
+    assertTrue(view.compare("ab") > 0);
+    assertTrue(view.starts_with("ab"));
+    assertFalse(view.starts_with("b"));
+    assertTrue(view.ends_with("bc"));
+    assertFalse(view.ends_with("abcd"));
+}
+
+// TESTS: LOOKUP
+/// \brief Tests the std::string_view::find and rfind functions.
+test(container_string_string_view, find)
+{
+    // Create view.
+    std::string_view view("a,b,c");
+
+    // Verify character and substring searches.
+    assertEqual(view.find(','), std::size_t(1));
+    assertEqual(view.find(',', 2), std::size_t(3));
+    assertEqual(view.rfind(','), std::size_t(3));
+    assertEqual(view.find(';'), std::string_view::npos);
+    assertEqual(view.find("b,c"), std::size_t(2));
+    assertEqual(view.find("c,"), std::string_view::npos);
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,88 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_NUMERIC_ACCUMULATE
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::numeric::accumulate {
+
+// TESTS
+/// \brief Tests the std::accumulate function over an iterator range.
+test(numeric_accumulate, accumulate)
+{
+    // Create vector.
+    std::vector<int> vector(10);
+    vector.resize(10);
+    std::iota(vector.begin(), vector.end(), 1);
+
+    // Verify sum and product.
+    assertEqual(std::accumulate(vector.cbegin(), vector.cend(), 0), 55);
+    assertEqual(std::accumulate(vector.cbegin(), vector.cbegin() + 5, 1L, [](long a, int b) { return a * b; }), 120L);
+    assertEqual(std::accumulate(vector.cbegin(), vector.cbegin(), 7), 7);
+}
+/// \brief Tests the std::accumulate function over arrays of every unrolled remainder.
+test(numeric_accumulate, accumulate_array)
+{
+    // Sum arrays whose sizes cover each remainder of the unroll factor.
+    std::array<int,1> array_1 = {5};
+    std::array<int,6> array_6 = {1, 2, 3, 4, 5, 6};
+    std::array<int,7> array_7 = {1, 2, 3, 4, 5, 6, 7};
+    std::array<int,8> array_8 = {1, 2, 3, 4, 5, 6, 7, 8};
+    assertEqual(std::accumulate(array_1, 0), 5);
+    assertEqual(std::accumulate(array_6, 0), 21);
+    assertEqual(std::accumulate(array_7, 0), 28);
+    assertEqual(std::accumulate(array_8, 10), 46);
+}
+/// \brief Tests the std::accumulate function with a widened accumulator.
+test(numeric_accumulate, accumulate_array_widened)
+{
+    // Create array whose sum overflows int16_t.
+    std::array<int16_t,5> array;
+    array.fill(30000);
+
+    // Verify the sum is widened.
+    auto sum = std::accumulate(array);
+    assertEqual(sizeof(sum), std::size_t(4));
+    assertEqual(sum, int32_t(150000));
+
+    // Verify unsigned bytes are widened.
+    std::array<uint8_t,3> bytes = {200, 200, 200};
+    assertEqual(std::accumulate(bytes), uint16_t(600));
+}
+/// \brief Tests the std::inner_product function over an iterator range.
+test(numeric_accumulate, inner_product)
+{
+    // Create ranges.
+    int a[4] = {1, 2, 3, 4};
+    int b[4] = {5, 6, 7, 8};
+
+    // Verify dot product.
+    assertEqual(std::inner_product(a, a + 4, b, 0), 70);
+
+    // Verify custom operations count matching elements.
+    int c[4] = {1, 0, 3, 0};
+    assertEqual(std::inner_product(a, a + 4, c, 0, [](int sum, bool equal) { return sum + equal; }, [](int x, int y) { return x == y; }), 2);
+}
+/// \brief Tests the std::inner_product function over arrays with a widened accumulator.
+test(numeric_accumulate, inner_product_array)
+{
+    // Create arrays whose products overflow int16_t.
+    std::array<int16_t,9> a, b;
+    a.fill(1000);
+    b.fill(-300);
+    b[8] = 2;
+
+    // Verify widened and explicit accumulators.
+    assertEqual(std::inner_product(a, b), int32_t(-2398000));
+    assertEqual(std::inner_product(a, b, int32_t(1)), int32_t(-2397999));
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_NUMERIC_PARTIAL_SUM
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::numeric::partial_sum {
+
+// TESTS
+/// \brief Tests the std::partial_sum function.
+test(numeric_partial_sum, partial_sum)
+{
+    // Create range.
+    int input[5] = {1, 2, 3, 4, 5};
+    int output[5];
+
+    // Compute running sums and verify.
+    assertEqual(std::partial_sum(input, input + 5, output), output + 5);
+    int expected[5] = {1, 3, 6, 10, 15};
+    for(int i = 0; i < 5; ++i)
+    {
+        assertEqual(output[i], expected[i]);
+    }
+
+    // Compute running maximum in place and verify.
+    int values[5] = {3, 1, 4, 1, 5};
+    std::partial_sum(values, values + 5, values, [](int a, int b) { return a > b ? a : b; });
+    assertEqual(values[1], 3);
+    assertEqual(values[3], 4);
+    assertEqual(values[4], 5);
+}
+/// \brief Tests the std::adjacent_difference function.
+test(numeric_partial_sum, adjacent_difference)
+{
+    // Create range.
+    std::array<int,5> array = {2, 3, 5, 9, 8};
+
+    // Compute differences in place and verify.
+    assertEqual(std::adjacent_difference(array.begin(), array.end(), array.begin()), array.end());
+    int expected[5] = {2, 1, 2, 4, -1};
+    for(int i = 0; i < 5; ++i)
+    {
+        assertEqual(array[i], expected[i]);
+    }
+
+    // Verify the partial sum of the differences restores the range.
+    std::partial_sum(array.cbegin(), array.cend(), array.begin());
+    assertEqual(array[3], 9);
+    assertEqual(array[4], 8);
+}
+/// \brief Tests the std::iota function.
+test(numeric_partial_sum, iota)
+{
+    // Fill and verify.
+    uint8_t array[4];
+    std::iota(array, array + 4, 'a');
+    assertEqual(array[0], 'a');
+    assertEqual(array[3], 'd');
+}
+
+}
+
+#endif
\ No newline at end of file
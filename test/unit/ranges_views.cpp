@@ -0,0 +1,188 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_RANGES_VIEWS
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::ranges::views {
+
+// TESTS
+/// \brief Tests the std::views::filter adaptor.
+test(ranges_views, filter)
+{
+    // Create a vector.
+    std::vector<int> vector(8);
+    for(int i = 1; i <= 8; ++i)
+    {
+        vector.push_back(i);
+    }
+
+    // Verify only even values are iterated.
+    int expected = 2;
+    for(int value : std::views::filter(vector, [](int value) { return value % 2 == 0; }))
+    {
+        assertEqual(value, expected);
+        expected += 2;
+    }
+    assertEqual(expected, 10);
+
+    // Verify a view with no satisfying elements is empty.
+    auto none = vector | std::views::filter([](int value) { return value > 8; });
+    assertTrue(none.begin() == none.end());
+}
+/// \brief Tests that std::views::filter iterates references to the underlying elements.
+test(ranges_views, filter_modify)
+{
+    // Create an array.
+    int array[5] = {1, -2, 3, -4, 5};
+
+    // Clamp negative values to zero through the view.
+    for(int& value : array | std::views::filter([](int value) { return value < 0; }))
+    {
+        value = 0;
+    }
+
+    // Verify the array was modified in place.
+    int expected[5] = {1, 0, 3, 0, 5};
+    for(std::size_t i = 0; i < 5; ++i)
+    {
+        assertEqual(array[i], expected[i]);
+    }
+}
+/// \brief Tests the std::views::transform adaptor.
+test(ranges_views, transform)
+{
+    // Create an array.
+    std::array<int16_t,4> array = {1, 2, 3, 4};
+
+    // Verify each value is scaled.
+    int32_t expected = 10;
+    for(int32_t value : std::views::transform(array, [](int16_t value) { return int32_t(value) * 10; }))
+    {
+        assertEqual(value, expected);
+        expected += 10;
+    }
+    assertEqual(expected, 50L);
+}
+/// \brief Tests the std::views::take adaptor.
+test(ranges_views, take)
+{
+    // Create an array.
+    int array[5] = {1, 2, 3, 4, 5};
+
+    // Verify the first three values are iterated.
+    int count = 0;
+    for(int value : array | std::views::take(3))
+    {
+        assertEqual(value, ++count);
+    }
+    assertEqual(count, 3);
+
+    // Verify taking more than the size takes all values.
+    count = 0;
+    for(int value : std::views::take(array, 10))
+    {
+        assertEqual(value, ++count);
+    }
+    assertEqual(count, 5);
+}
+/// \brief Tests the std::views::drop adaptor.
+test(ranges_views, drop)
+{
+    // Create an array.
+    int array[5] = {1, 2, 3, 4, 5};
+
+    // Verify the values after the first two are iterated.
+    int count = 2;
+    for(int value : array | std::views::drop(2))
+    {
+        assertEqual(value, ++count);
+    }
+    assertEqual(count, 5);
+
+    // Verify dropping more than the size leaves an empty view.
+    assertTrue(std::views::drop(array, 10).empty());
+}
+/// \brief Tests the std::views::reverse adaptor.
+test(ranges_views, reverse)
+{
+    // Create a vector.
+    std::vector<int> vector(4);
+    for(int i = 1; i <= 4; ++i)
+    {
+        vector.push_back(i);
+    }
+
+    // Verify values are iterated in reverse order.
+    int expected = 4;
+    for(int value : vector | std::views::reverse())
+    {
+        assertEqual(value, expected--);
+    }
+    assertEqual(expected, 0);
+}
+/// \brief Tests the std::views::zip adaptor.
+test(ranges_views, zip)
+{
+    // Create two ranges of different lengths.
+    int a[4] = {1, 2, 3, 4};
+    std::array<char,3> b = {'a', 'b', 'c'};
+
+    // Verify elements are paired until the shorter range ends.
+    int count = 0;
+    for(auto element : std::views::zip(a, b))
+    {
+        assertEqual(element.first, count + 1);
+        assertEqual(element.second, char('a' + count));
+        ++count;
+    }
+    assertEqual(count, 3);
+
+    // Verify elements can be written through the view.
+    for(auto element : std::views::zip(a, b))
+    {
+        element.first = element.second;
+    }
+    assertEqual(a[0], int('a'));
+    assertEqual(a[3], 4);
+}
+/// \brief Tests a pipeline of chained views.
+test(ranges_views, pipeline)
+{
+    // Create a buffer of samples, where negative samples are invalid.
+    const int16_t samples[8] = {5, -1, 10, 15, -1, 20, 25, 30};
+
+    // Filter valid samples, scale them, and take the first three.
+    auto pipeline = samples
+        | std::views::filter([](int16_t sample) { return sample >= 0; })
+        | std::views::transform([](int16_t sample) { return sample * 2; })
+        | std::views::take(3);
+
+    // Verify the results.
+    int expected[3] = {10, 20, 30};
+    std::size_t i = 0;
+    for(int value : pipeline)
+    {
+        assertEqual(value, expected[i++]);
+    }
+    assertEqual(i, 3U);
+
+    // Verify the filtered values can be iterated in reverse.
+    int reversed[6] = {30, 25, 20, 15, 10, 5};
+    i = 0;
+    for(int value : samples | std::views::filter([](int16_t sample) { return sample >= 0; }) | std::views::reverse())
+    {
+        assertEqual(value, reversed[i++]);
+    }
+    assertEqual(i, 6U);
+}
+
+}
+
+#endif
\ No newline at end of file
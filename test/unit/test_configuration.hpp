@@ -1,16 +1,57 @@
 #ifndef TEST_CONFIGURATION_H
 #define TEST_CONFIGURATION_H
 
+// std/container
+// #define TEST_CONTAINER_SPAN
+// #define TEST_CONTAINER_REVERSE_ITERATOR
+
 // std/container/fixed
 // #define TEST_CONTAINER_FIXED_BASE
 // #define TEST_CONTAINER_FIXED_ARRAY
+// #define TEST_CONTAINER_FIXED_BITSET
 
 // std/container/dynamic
 // #define TEST_CONTAINER_DYNAMIC_BASE
+// #define TEST_CONTAINER_DYNAMIC_BITSET
 // #define TEST_CONTAINER_DYNAMIC_VECTOR
+// #define TEST_CONTAINER_DYNAMIC_VECTOR_BOOL
+// #define TEST_CONTAINER_DYNAMIC_SMALL_VECTOR
+// #define TEST_CONTAINER_DYNAMIC_GROWABLE_VECTOR
+// #define TEST_CONTAINER_DYNAMIC_PRIORITY_QUEUE
+// #define TEST_CONTAINER_DYNAMIC_INDEXED_PRIORITY_QUEUE
+// #define TEST_CONTAINER_DYNAMIC_LIST
+// #define TEST_CONTAINER_DYNAMIC_FORWARD_LIST
 // #define TEST_CONTAINER_DYNAMIC_SET
+// #define TEST_CONTAINER_DYNAMIC_SLOT_MAP
+// #define TEST_CONTAINER_DYNAMIC_SPARSE_SET
 // #define TEST_CONTAINER_DYNAMIC_MAP
 
+// std/container/intrusive
+// #define TEST_CONTAINER_INTRUSIVE_LIST
+
+// std/container/progmem
+// #define TEST_CONTAINER_PROGMEM_ARRAY
+// #define TEST_CONTAINER_PROGMEM_MAP
+
+// std/container/string
+// #define TEST_CONTAINER_STRING_STRING_VIEW
+// #define TEST_CONTAINER_STRING_STRING
+// #define TEST_CONTAINER_STRING_FIXED_STRING
+
+// std/algorithm
+// #define TEST_ALGORITHM_BINARY_SEARCH
+// #define TEST_ALGORITHM_COMPARE
+// #define TEST_ALGORITHM_HEAP
+// #define TEST_ALGORITHM_REMOVE
+// #define TEST_ALGORITHM_SORT
+
+// std/numeric
+// #define TEST_NUMERIC_ACCUMULATE
+// #define TEST_NUMERIC_PARTIAL_SUM
+
+// std/ranges
+// #define TEST_RANGES_VIEWS
+
 // std/memory
 // #define TEST_MEMORY_SMART_PTR_BASE
 // #define TEST_MEMORY_SMART_PTR_UNIQUE_PTR
@@ -22,6 +63,10 @@
 // #define TEST_FUNCTIONAL_FUNCTION
 
 // std/utility
+// #define TEST_UTILITY_EXPECTED
+// #define TEST_UTILITY_OPTIONAL
 // #define TEST_UTILITY_PAIR
+// #define TEST_UTILITY_TUPLE
+// #define TEST_UTILITY_VARIANT
 
 #endif
\ No newline at end of file
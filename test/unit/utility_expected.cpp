@@ -0,0 +1,71 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_UTILITY_EXPECTED
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::utility::expected {
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::expected value constructor.
+test(utility_expected, constructor_value)
+{
+    std::expected<int,std::errc> expected(3);
+
+    assertTrue(expected.has_value());
+    assertTrue(static_cast<bool>(expected));
+    assertEqual(*expected, 3);
+    assertEqual(expected.value_or(5), 3);
+}
+/// \brief Tests the std::expected error constructor.
+test(utility_expected, constructor_error)
+{
+    std::expected<int,std::errc> expected = std::make_unexpected(std::errc::invalid_argument);
+
+    assertFalse(expected.has_value());
+    assertTrue(expected.error() == std::errc::invalid_argument);
+    assertEqual(expected.value_or(5), 5);
+}
+/// \brief Tests the std::expected copy constructor and assignment operator.
+test(utility_expected, copy)
+{
+    std::expected<int,std::errc> a(3);
+    std::expected<int,std::errc> b(a);
+    std::expected<int,std::errc> c = std::make_unexpected(std::errc::result_out_of_range);
+
+    assertEqual(*b, 3);
+    b = c;
+    assertFalse(b.has_value());
+    assertTrue(b.error() == std::errc::result_out_of_range);
+    c = a;
+    assertEqual(*c, 3);
+}
+/// \brief Tests std::expected with a value type that owns a resource.
+test(utility_expected, owning_value)
+{
+    std::expected<std::unique_ptr<int>,std::errc> expected(std::make_unique<int>(3));
+    std::expected<std::unique_ptr<int>,std::errc> moved(std::move(expected));
+
+    assertEqual(**moved, 3);
+    moved = std::make_unexpected(std::errc::invalid_argument);
+    assertFalse(moved.has_value());
+}
+
+/// \brief Tests that std::expected is trivially copyable when its value and error are.
+test(utility_expected, trivially_copyable)
+{
+    using trivial_expected = std::expected<int,std::errc>;
+    using owning_expected = std::expected<std::unique_ptr<int>,std::errc>;
+
+    assertTrue(std::is_trivially_copyable<trivial_expected>::value);
+    assertFalse(std::is_trivially_copyable<owning_expected>::value);
+}
+}
+
+#endif
\ No newline at end of file
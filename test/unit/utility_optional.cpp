@@ -0,0 +1,172 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_UTILITY_OPTIONAL
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::utility::optional {
+
+// UTILITY
+/// \brief An object that counts how many instances are alive.
+struct counted
+{
+    // CONSTRUCTORS
+    /// \brief Constructs a new counted instance.
+    /// \param[in] value The value of the instance.
+    counted(int value = 0)
+        : value(value)
+    {
+        ++counted::alive;
+    }
+    /// \brief Copy-constructs a new counted instance.
+    /// \param[in] other The other instance to copy-construct from.
+    counted(const counted& other)
+        : value(other.value)
+    {
+        ++counted::alive;
+    }
+    ~counted()
+    {
+        --counted::alive;
+    }
+
+    /// \brief Copy-assigns another instance to this instance.
+    /// \param[in] other The other instance to copy.
+    /// \return A reference to this instance.
+    counted& operator=(const counted& other) = default;
+
+    // DATA
+    /// \brief The value of the instance.
+    int value;
+    /// \brief The number of instances alive.
+    static int alive;
+};
+int counted::alive = 0;
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::optional default and nullopt constructors.
+test(utility_optional, constructor_empty)
+{
+    std::optional<int> a;
+    std::optional<int> b(std::nullopt);
+
+    assertFalse(a.has_value());
+    assertFalse(static_cast<bool>(b));
+    assertEqual(a.value_or(5), 5);
+}
+/// \brief Tests the std::optional value constructor.
+test(utility_optional, constructor_value)
+{
+    std::optional<int> optional(3);
+
+    assertTrue(optional.has_value());
+    assertEqual(*optional, 3);
+    assertEqual(optional.value_or(5), 3);
+}
+/// \brief Tests the std::optional copy and move constructors.
+test(utility_optional, constructor_copy_move)
+{
+    std::optional<int> a(3);
+    std::optional<int> b(a);
+    std::optional<int> c(std::move(b));
+    std::optional<int> empty;
+    std::optional<int> d(empty);
+
+    assertEqual(*b, 3);
+    assertEqual(*c, 3);
+    assertFalse(d.has_value());
+}
+/// \brief Tests that std::optional does not construct a value until one is given, and destroys it.
+test(utility_optional, lifetime)
+{
+    counted::alive = 0;
+    {
+        std::optional<counted> optional;
+        assertEqual(counted::alive, 0);
+
+        optional.emplace(4);
+        assertEqual(counted::alive, 1);
+        assertEqual(optional->value, 4);
+
+        optional.emplace(5);
+        assertEqual(counted::alive, 1);
+        assertEqual(optional->value, 5);
+
+        optional.reset();
+        assertEqual(counted::alive, 0);
+
+        optional = counted(6);
+        assertEqual(counted::alive, 1);
+    }
+    assertEqual(counted::alive, 0);
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::optional assignment operators.
+test(utility_optional, operator_assign)
+{
+    std::optional<int> a(3);
+    std::optional<int> b;
+
+    b = a;
+    assertEqual(*b, 3);
+    a = std::nullopt;
+    assertFalse(a.has_value());
+    b = a;
+    assertFalse(b.has_value());
+    b = std::optional<int>(7);
+    assertEqual(*b, 7);
+}
+/// \brief Tests the std::optional::swap function.
+test(utility_optional, swap)
+{
+    std::optional<int> a(3);
+    std::optional<int> b;
+
+    a.swap(b);
+
+    assertFalse(a.has_value());
+    assertEqual(*b, 3);
+}
+/// \brief Tests that std::optional is trivially copyable when its value is.
+test(utility_optional, trivially_copyable)
+{
+    assertTrue(std::is_trivially_copyable<std::optional<int>>::value);
+    assertFalse(std::is_trivially_copyable<std::optional<counted>>::value);
+}
+
+// TESTS: COMPARISON
+/// \brief Tests the std::optional equality operators.
+test(utility_optional, operator_equal)
+{
+    assertTrue(std::optional<int>(3) == std::optional<int>(3));
+    assertTrue(std::optional<int>(3) != std::optional<int>(4));
+    assertTrue(std::optional<int>(3) != std::optional<int>());
+    assertTrue(std::optional<int>() == std::optional<int>());
+}
+
+// TESTS: REFERENCE
+/// \brief Tests std::optional of a reference type.
+test(utility_optional, reference)
+{
+    int value = 3;
+    std::optional<int&> optional(value);
+    std::optional<int&> empty;
+
+    assertTrue(optional.has_value());
+    *optional = 4;
+    assertEqual(value, 4);
+    assertFalse(empty.has_value());
+    assertEqual(empty.value_or(5), 5);
+    assertEqual(sizeof(optional), sizeof(int*));
+}
+
+}
+
+#endif
\ No newline at end of file
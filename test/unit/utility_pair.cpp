@@ -143,6 +143,22 @@ test(utility_pair, swap)
     assertEqual(pair_b.first, 0x12);
     assertEqual(pair_b.second, 0x34);
 }
+/// \brief Tests the std::pair::swap function with values that can only be moved.
+test(utility_pair, swap_move)
+{
+    // Create two pairs owning heap objects.
+    std::pair<std::unique_ptr<int>,int> pair_a(std::make_unique<int>(1), 2);
+    std::pair<std::unique_ptr<int>,int> pair_b(std::make_unique<int>(3), 4);
+
+    // Swap the two pairs.
+    pair_a.swap(pair_b);
+
+    // Verify swap.
+    assertEqual(*pair_a.first, 3);
+    assertEqual(pair_a.second, 4);
+    assertEqual(*pair_b.first, 1);
+    assertEqual(pair_b.second, 2);
+}
 
 // COMPARISON
 /// \brief Tests the std::pair::operator== function with equal pairs.
@@ -185,6 +201,13 @@ test(utility_pair, operator_unequal_equal)
     // Verify the two pairs are equal.
     assertFalse(pair_a != pair_b);
 }
+/// \brief Tests that std::pair is trivially copyable when its values are.
+test(utility_pair, trivially_copyable)
+{
+    using trivial_pair = std::pair<uint8_t,uint16_t>;
+
+    assertTrue(std::is_trivially_copyable<trivial_pair>::value);
+}
 
 }
 
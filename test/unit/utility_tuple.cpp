@@ -0,0 +1,185 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_UTILITY_TUPLE
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::utility::tuple {
+
+// UTILITY
+/// \brief A stateless comparator, which should occupy no storage within a tuple.
+struct stateless
+{
+    /// \brief Compares two values.
+    /// \param[in] a The first value.
+    /// \param[in] b The second value.
+    /// \return TRUE if the first value is less than the second value, otherwise FALSE.
+    bool operator()(int a, int b) const
+    {
+        return a < b;
+    }
+};
+
+/// \brief Adds three values.
+/// \param[in] a The first value.
+/// \param[in] b The second value.
+/// \param[in] c The third value.
+/// \return The sum of the values.
+int add(int a, int b, int c)
+{
+    return a + b + c;
+}
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::tuple default constructor.
+test(utility_tuple, constructor_default)
+{
+    std::tuple<int,uint8_t> tuple;
+
+    assertEqual(std::get<0>(tuple), 0);
+    assertEqual(std::get<1>(tuple), 0);
+}
+/// \brief Tests the std::tuple value constructor.
+test(utility_tuple, constructor_value)
+{
+    std::tuple<int,char,float> tuple(1, 'a', 2.5f);
+
+    assertEqual(std::get<0>(tuple), 1);
+    assertEqual(std::get<1>(tuple), 'a');
+    assertEqual(std::get<2>(tuple), 2.5f);
+}
+/// \brief Tests the std::tuple constructor with values that can only be moved.
+test(utility_tuple, constructor_move)
+{
+    std::tuple<std::unique_ptr<int>,int> a(std::make_unique<int>(3), 4);
+    std::tuple<std::unique_ptr<int>,int> b(std::move(a));
+
+    assertTrue(std::get<0>(a) == nullptr);
+    assertEqual(*std::get<0>(b), 3);
+    assertEqual(std::get<1>(b), 4);
+}
+/// \brief Tests the std::tuple copy constructor.
+test(utility_tuple, constructor_copy)
+{
+    std::tuple<int,int> a(1, 2);
+    std::tuple<int,int> b(a);
+
+    assertTrue(a == b);
+}
+
+// TESTS: STORAGE
+/// \brief Tests that empty elements of a std::tuple occupy no storage.
+test(utility_tuple, empty_base_optimization)
+{
+    assertEqual(sizeof(std::tuple<int,stateless>), sizeof(int));
+    assertEqual(sizeof(std::tuple<stateless,uint32_t>), sizeof(uint32_t));
+
+    std::tuple<int,stateless> tuple(1, stateless());
+    assertTrue(std::get<1>(tuple)(1, 2));
+}
+
+// TESTS: TRAITS
+/// \brief Tests the std::tuple_size and std::tuple_element traits.
+test(utility_tuple, traits)
+{
+    using triple = std::tuple<int,char,float>;
+    using double_pair = std::pair<double,char>;
+
+    assertEqual(std::tuple_size<triple>::value, std::size_t(3));
+    assertEqual(std::tuple_size<const triple>::value, std::size_t(3));
+    assertEqual(std::tuple_size<double_pair>::value, std::size_t(2));
+    assertEqual(sizeof(std::tuple_element<1, triple>::type), sizeof(char));
+    assertEqual(sizeof(std::tuple_element<0, double_pair>::type), sizeof(double));
+}
+
+// TESTS: ACCESS
+/// \brief Tests the std::get function on tuples and pairs.
+test(utility_tuple, get)
+{
+    std::tuple<int,char> tuple(1, 'a');
+    std::pair<int,char> pair(2, 'b');
+    const std::tuple<int,char>& reference = tuple;
+
+    std::get<0>(tuple) = 3;
+    std::get<1>(pair) = 'c';
+
+    assertEqual(std::get<0>(reference), 3);
+    assertEqual(std::get<0>(pair), 2);
+    assertEqual(pair.second, 'c');
+}
+/// \brief Tests the std::apply function.
+test(utility_tuple, apply)
+{
+    std::tuple<int,int,int> tuple(1, 2, 3);
+    std::pair<int,int> pair(4, 5);
+
+    assertEqual(std::apply(add, tuple), 6);
+    assertEqual(std::apply(stateless(), pair), true);
+}
+/// \brief Tests the std::tie function unpacking a tuple.
+test(utility_tuple, tie)
+{
+    int a = 0;
+    char b = 0;
+
+    std::tie(a, b) = std::make_tuple(4, 'd');
+
+    assertEqual(a, 4);
+    assertEqual(b, 'd');
+}
+#if __cplusplus >= 201703L
+/// \brief Tests structured bindings of tuples and pairs.
+test(utility_tuple, structured_binding)
+{
+    std::tuple<int,char> tuple(1, 'a');
+    auto& [number, letter] = tuple;
+    number = 2;
+    auto [first, second] = std::pair<int,int>(3, 4);
+
+    assertEqual(std::get<0>(tuple), 2);
+    assertEqual(letter, 'a');
+    assertEqual(first, 3);
+    assertEqual(second, 4);
+}
+#endif
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::tuple::swap function with values that can only be moved.
+test(utility_tuple, swap)
+{
+    std::tuple<std::unique_ptr<int>,int> a(std::make_unique<int>(1), 2);
+    std::tuple<std::unique_ptr<int>,int> b(std::make_unique<int>(3), 4);
+
+    a.swap(b);
+
+    assertEqual(*std::get<0>(a), 3);
+    assertEqual(std::get<1>(a), 4);
+    assertEqual(*std::get<0>(b), 1);
+    assertEqual(std::get<1>(b), 2);
+}
+
+// TESTS: COMPARISON
+/// \brief Tests the std::tuple comparison operators.
+test(utility_tuple, operator_compare)
+{
+    using key = std::tuple<uint8_t,uint16_t>;
+
+    assertTrue(key(1, 2) == key(1, 2));
+    assertTrue(key(1, 2) != key(1, 3));
+    assertTrue(key(1, 9) < key(2, 0));
+    assertTrue(key(1, 2) < key(1, 3));
+    assertFalse(key(1, 2) < key(1, 2));
+    assertTrue(key(1, 2) <= key(1, 2));
+    assertTrue(key(2, 0) > key(1, 9));
+    assertTrue(key(1, 2) >= key(1, 2));
+}
+
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,272 @@
+// test_configuration
+#include "test_configuration.hpp"
+
+// Compile only if this test is selected.
+#ifdef TEST_UTILITY_VARIANT
+
+// aunit
+#include <AUnit.h>
+
+// std
+#include <std.hpp>
+
+namespace test::utility::variant {
+
+// UTILITY
+/// \brief An object that counts how many instances are alive.
+struct counted
+{
+    // CONSTRUCTORS
+    /// \brief Constructs a new counted instance.
+    /// \param[in] value The value of the instance.
+    counted(int value = 0)
+        : value(value)
+    {
+        ++counted::alive;
+    }
+    /// \brief Copy-constructs a new counted instance.
+    /// \param[in] other The other instance to copy-construct from.
+    counted(const counted& other)
+        : value(other.value)
+    {
+        ++counted::alive;
+    }
+    ~counted()
+    {
+        --counted::alive;
+    }
+
+    /// \brief Copy-assigns another instance to this instance.
+    /// \param[in] other The other instance to copy.
+    /// \return A reference to this instance.
+    counted& operator=(const counted& other) = default;
+
+    // DATA
+    /// \brief The value of the instance.
+    int value;
+    /// \brief The number of instances alive.
+    static int alive;
+};
+int counted::alive = 0;
+
+/// \brief A message that sets a value.
+struct set_message
+{
+    /// \brief The value to set.
+    int value;
+};
+/// \brief A message that adds to a value.
+struct add_message
+{
+    /// \brief The amount to add.
+    int amount;
+};
+/// \brief A message that resets a value.
+struct reset_message
+{};
+
+/// \brief A visitor that applies messages to a value.
+struct handler
+{
+    /// \brief The value the messages apply to.
+    int value;
+
+    /// \brief Applies a set message.
+    /// \param[in] message The message.
+    /// \return The message's identifier.
+    char operator()(const set_message& message)
+    {
+        handler::value = message.value;
+        return 's';
+    }
+    /// \brief Applies an add message.
+    /// \param[in] message The message.
+    /// \return The message's identifier.
+    char operator()(const add_message& message)
+    {
+        handler::value += message.amount;
+        return 'a';
+    }
+    /// \brief Applies a reset message.
+    /// \return The message's identifier.
+    char operator()(const reset_message&)
+    {
+        handler::value = 0;
+        return 'r';
+    }
+};
+
+/// \brief A visitor that gets the size of an alternative.
+struct size_of
+{
+    /// \brief Gets the size of an alternative.
+    /// \tparam object_type The type of the alternative.
+    /// \return The size of the alternative.
+    template <typename object_type>
+    std::size_t operator()(const object_type&) const
+    {
+        return sizeof(object_type);
+    }
+};
+
+/// \brief A visitor that doubles a numeric alternative.
+struct doubler
+{
+    /// \brief Doubles an alternative.
+    /// \tparam object_type The type of the alternative.
+    /// \param[in] object The alternative.
+    template <typename object_type>
+    void operator()(object_type& object) const
+    {
+        object *= 2;
+    }
+};
+
+// TESTS: CONSTRUCTORS
+/// \brief Tests the std::variant default constructor.
+test(utility_variant, constructor_default)
+{
+    std::variant<int,float> variant;
+
+    assertEqual(variant.index(), std::size_t(0));
+    assertEqual(std::get<int>(variant), 0);
+}
+/// \brief Tests the std::variant value constructor.
+test(utility_variant, constructor_value)
+{
+    std::variant<int,float> a(3);
+    std::variant<int,float> b(2.5f);
+
+    assertEqual(a.index(), std::size_t(0));
+    assertEqual(b.index(), std::size_t(1));
+    assertTrue(std::holds_alternative<float>(b));
+    assertEqual(std::get<1>(b), 2.5f);
+}
+/// \brief Tests the std::variant copy and move constructors.
+test(utility_variant, constructor_copy_move)
+{
+    std::variant<int,float> a(2.5f);
+    std::variant<int,float> b(a);
+    std::variant<int,float> c(std::move(b));
+
+    assertEqual(std::get<float>(b), 2.5f);
+    assertEqual(std::get<float>(c), 2.5f);
+}
+/// \brief Tests that std::variant destroys its alternative when replaced or destroyed.
+test(utility_variant, lifetime)
+{
+    counted::alive = 0;
+    {
+        std::variant<counted,int> variant(counted(4));
+        assertEqual(counted::alive, 1);
+
+        variant = 5;
+        assertEqual(counted::alive, 0);
+
+        variant.emplace<counted>(6);
+        assertEqual(counted::alive, 1);
+        assertEqual(std::get<counted>(variant).value, 6);
+
+        std::variant<counted,int> copy(variant);
+        assertEqual(counted::alive, 2);
+    }
+    assertEqual(counted::alive, 0);
+}
+/// \brief Tests that std::variant stores its alternatives inline.
+test(utility_variant, size)
+{
+    assertTrue(sizeof(std::variant<uint8_t,uint16_t,uint32_t>) <= 2 * sizeof(uint32_t));
+    using triple = std::variant<int,float,char>;
+    assertEqual(std::variant_size<triple>::value, std::size_t(3));
+}
+
+// TESTS: ACCESS
+/// \brief Tests the std::get_if function.
+test(utility_variant, get_if)
+{
+    std::variant<int,float> variant(3);
+    const std::variant<int,float>& reference = variant;
+
+    assertTrue(std::get_if<int>(&variant) != nullptr);
+    assertEqual(*std::get_if<0>(&variant), 3);
+    assertTrue(std::get_if<float>(&variant) == nullptr);
+    assertTrue(std::get_if<1>(&reference) == nullptr);
+    assertEqual(*std::get_if<int>(&reference), 3);
+    assertTrue(std::get_if<int>(static_cast<std::variant<int,float>*>(nullptr)) == nullptr);
+}
+/// \brief Tests the std::visit function dispatching messages.
+test(utility_variant, visit)
+{
+    using message = std::variant<set_message,add_message,reset_message>;
+    handler handler{0};
+
+    assertEqual(std::visit(handler, message(set_message{4})), 's');
+    assertEqual(handler.value, 4);
+    assertEqual(std::visit(handler, message(add_message{3})), 'a');
+    assertEqual(handler.value, 7);
+    assertEqual(std::visit(handler, message(reset_message{})), 'r');
+    assertEqual(handler.value, 0);
+}
+/// \brief Tests the std::visit function with generic and mutating visitors.
+test(utility_variant, visit_generic)
+{
+    std::variant<uint8_t,uint32_t> variant(uint32_t(5));
+    const std::variant<uint8_t,uint32_t>& reference = variant;
+
+    assertEqual(std::visit(size_of(), reference), sizeof(uint32_t));
+    std::visit(doubler(), variant);
+    assertEqual(std::get<uint32_t>(variant), uint32_t(10));
+    assertEqual(variant.visit(size_of()), sizeof(uint32_t));
+}
+/// \brief Tests std::variant stored contiguously in a std::vector.
+test(utility_variant, vector)
+{
+    using message = std::variant<set_message,add_message,reset_message>;
+    std::vector<message> queue(4);
+    queue.push_back(set_message{2});
+    queue.push_back(add_message{5});
+    queue.push_back(reset_message{});
+    queue.push_back(add_message{1});
+
+    handler handler{0};
+    for(auto entry = queue.begin(); entry != queue.end(); ++entry)
+    {
+        std::visit(handler, *entry);
+    }
+
+    assertEqual(handler.value, 1);
+}
+
+// TESTS: MODIFIERS
+/// \brief Tests the std::variant assignment operators.
+test(utility_variant, operator_assign)
+{
+    std::variant<int,float> a(3);
+    std::variant<int,float> b(2.5f);
+
+    a = b;
+    assertEqual(std::get<float>(a), 2.5f);
+    a = 4;
+    assertEqual(std::get<int>(a), 4);
+    a = 5;
+    assertEqual(std::get<int>(a), 5);
+    b = std::variant<int,float>(6);
+    assertEqual(std::get<int>(b), 6);
+}
+
+// TESTS: COMPARISON
+/// \brief Tests the std::variant equality operators.
+test(utility_variant, operator_equal)
+{
+    using number = std::variant<int,float>;
+    using optional_number = std::variant<std::monostate,int>;
+
+    assertTrue(number(3) == number(3));
+    assertTrue(number(3) != number(4));
+    assertTrue(number(3) != number(3.0f));
+    assertTrue(optional_number() == optional_number());
+}
+
+}
+
+#endif
\ No newline at end of file